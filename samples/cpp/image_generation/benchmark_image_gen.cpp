@@ -6,6 +6,7 @@
 #include "openvino/genai/image_generation/inpainting_pipeline.hpp"
 #include <cxxopts.hpp>
 #include <chrono>
+#include <fstream>
 #include "imwrite.hpp"
 #include "load_image.hpp"
 #include "progress_bar.hpp"
@@ -51,6 +52,47 @@ inline void print_one_generate(ov::genai::ImageGenerationPerfMetrics& metrics, s
               << " ms, vae decoder infer time:" << metrics.get_vae_decoder_infer_duration() << " ms" << std::endl;
 }
 
+
+// Appends one JSON-lines record per generate() call with the full per-stage breakdown, so runs
+// are machine-comparable across commits (resolution/steps sweeps gate regressions the way
+// llm_bench does for text pipelines).
+inline void dump_metrics_json(const std::string& json_path,
+                              const std::string& label,
+                              int idx,
+                              ov::genai::ImageGenerationPerfMetrics& metrics) {
+    if (json_path.empty()) {
+        return;
+    }
+    std::ofstream out(json_path, std::ios::app);
+    if (!out.good()) {
+        std::cerr << "cannot open json output file: " << json_path << std::endl;
+        return;
+    }
+    auto dump_series = [&out](const char* name, const std::vector<ov::genai::MicroSeconds>& series, bool& first_field) {
+        if (!first_field)
+            out << ",";
+        first_field = false;
+        out << "\"" << name << "\":[";
+        for (size_t i = 0; i < series.size(); ++i) {
+            out << (i ? "," : "") << series[i].count() / 1000.0;  // ms
+        }
+        out << "]";
+    };
+    bool first_field = true;
+    out << "{";
+    out << "\"label\":\"" << label << "\",\"index\":" << idx;
+    first_field = false;
+    out << ",\"generate_ms\":" << metrics.get_generate_duration();
+    out << ",\"inference_ms\":" << metrics.get_inference_duration();
+    out << ",\"text_encoder_ms\":" << get_total_text_encoder_infer_duration(metrics);
+    out << ",\"vae_encoder_ms\":" << metrics.get_vae_encoder_infer_duration();
+    out << ",\"vae_decoder_ms\":" << metrics.get_vae_decoder_infer_duration();
+    dump_series("iteration_ms", metrics.raw_metrics.iteration_durations, first_field);
+    dump_series("unet_inference_ms", metrics.raw_metrics.unet_inference_durations, first_field);
+    dump_series("transformer_inference_ms", metrics.raw_metrics.transformer_inference_durations, first_field);
+    out << "}" << std::endl;
+}
+
 inline float calculate_average(std::vector<float>& durations) {
     float duration_mean = std::accumulate(durations.begin(),
                                            durations.end(),
@@ -164,6 +206,7 @@ void text2image(cxxopts::ParseResult& result) {
         ov::genai::ImageGenerationPerfMetrics metrics = pipe.get_performance_metrics();
         warmup_metrics.emplace_back(metrics);
         print_one_generate(metrics, "warmup", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "warmup", i, metrics);
     }
 
     std::vector<ov::genai::ImageGenerationPerfMetrics> iter_metrics;
@@ -174,6 +217,7 @@ void text2image(cxxopts::ParseResult& result) {
         std::string image_name = output_dir + "/image_" + std::to_string(i) + ".bmp";
         imwrite(image_name, image, true);
         print_one_generate(metrics, "iter", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "iter", i, metrics);
     }
 
     print_statistic(warmup_metrics, iter_metrics);
@@ -206,6 +250,7 @@ void image2image(cxxopts::ParseResult& result) {
         ov::genai::ImageGenerationPerfMetrics metrics = pipe.get_performance_metrics();
         warmup_metrics.emplace_back(metrics);
         print_one_generate(metrics, "warmup", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "warmup", i, metrics);
     }
 
     std::vector<ov::genai::ImageGenerationPerfMetrics> iter_metrics;
@@ -216,6 +261,7 @@ void image2image(cxxopts::ParseResult& result) {
         std::string image_name = output_dir + "/image_" + std::to_string(i) + ".bmp";
         imwrite(image_name, image, true);
         print_one_generate(metrics, "iter", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "iter", i, metrics);
     }
 
     print_statistic(warmup_metrics, iter_metrics);
@@ -249,6 +295,7 @@ void inpainting(cxxopts::ParseResult& result) {
         ov::genai::ImageGenerationPerfMetrics metrics = pipe.get_performance_metrics();
         warmup_metrics.emplace_back(metrics);
         print_one_generate(metrics, "warmup", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "warmup", i, metrics);
     }
 
     std::vector<ov::genai::ImageGenerationPerfMetrics> iter_metrics;
@@ -259,6 +306,7 @@ void inpainting(cxxopts::ParseResult& result) {
         std::string image_name = output_dir + "/image_" + std::to_string(i) + ".bmp";
         imwrite(image_name, image, true);
         print_one_generate(metrics, "iter", i);
+        dump_metrics_json(result["json_output"].as<std::string>(), "iter", i, metrics);
     }
 
     print_statistic(warmup_metrics, iter_metrics);
@@ -287,6 +335,7 @@ int main(int argc, char* argv[]) try {
     //special parameters of inpainting pipeline
     ("mi,mask_image", "Mask image path", cxxopts::value<std::string>())
     ("r,reshape", "Reshape pipeline before compilation", cxxopts::value<bool>()->default_value("false"))
+    ("j,json_output", "Append per-generate stage breakdown records (JSON lines) to this file", cxxopts::value<std::string>()->default_value(""))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -3,22 +3,87 @@
 
 #include <cxxopts.hpp>
 #include <filesystem>
+#include <fstream>
+#include <sstream>
 
 #include "load_image.hpp"
 #include <openvino/genai/visual_language/pipeline.hpp>
 
+namespace {
+
+std::vector<size_t> parse_size_list(const std::string& csv) {
+    std::vector<size_t> values;
+    std::stringstream stream(csv);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            values.push_back(std::stoul(item));
+        }
+    }
+    return values;
+}
+
+// Synthetic image with a smooth gradient at an exact target resolution, so the resolution sweep
+// does not depend on the input file's size (slicing decisions in minicpm/llava_next-style models
+// are driven by the raw resolution, which is what the sweep needs to control).
+ov::Tensor make_synthetic_image(size_t height, size_t width) {
+    ov::Tensor image(ov::element::u8, {1, height, width, 3});
+    auto* data = image.data<uint8_t>();
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) {
+            uint8_t* pixel = data + (y * width + x) * 3;
+            pixel[0] = static_cast<uint8_t>(x * 255 / width);
+            pixel[1] = static_cast<uint8_t>(y * 255 / height);
+            pixel[2] = static_cast<uint8_t>((x + y) * 255 / (width + height));
+        }
+    }
+    return image;
+}
+
+void print_metrics(ov::genai::VLMPerfMetrics& metrics, const std::string& label) {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << label << " Generate time: " << metrics.get_generate_duration().mean << " ± " << metrics.get_generate_duration().std << " ms" << std::endl;
+    std::cout << label << " Tokenization time: " << metrics.get_tokenization_duration().mean << " ± " << metrics.get_tokenization_duration().std << " ms" << std::endl;
+    std::cout << label << " Detokenization time: " << metrics.get_detokenization_duration().mean << " ± " << metrics.get_detokenization_duration().std << " ms" << std::endl;
+    std::cout << label << " Embeddings preparation time: " << metrics.get_prepare_embeddings_duration().mean << " ± " << metrics.get_prepare_embeddings_duration().std << " ms" << std::endl;
+    std::cout << label << " TTFT: " << metrics.get_ttft().mean  << " ± " << metrics.get_ttft().std << " ms" << std::endl;
+    std::cout << label << " TPOT: " << metrics.get_tpot().mean  << " ± " << metrics.get_tpot().std << " ms/token " << std::endl;
+    std::cout << label << " Throughput: " << metrics.get_throughput().mean  << " ± " << metrics.get_throughput().std << " tokens/s" << std::endl;
+}
+
+// JSON-lines record per sweep combination, so per-model resolution caps can be picked from data
+void dump_json(std::ofstream& json_file, ov::genai::VLMPerfMetrics& metrics,
+               size_t resolution, size_t num_images, size_t gen_len) {
+    const float embeddings_ms = metrics.get_prepare_embeddings_duration().mean;
+    const float generate_ms = metrics.get_generate_duration().mean;
+    json_file << "{\"resolution\":" << resolution << ",\"num_images\":" << num_images
+              << ",\"max_new_tokens\":" << gen_len
+              << ",\"generate_ms\":" << generate_ms
+              << ",\"prepare_embeddings_ms\":" << embeddings_ms
+              << ",\"embeddings_share\":" << (generate_ms > 0 ? embeddings_ms / generate_ms : 0)
+              << ",\"ttft_ms\":" << metrics.get_ttft().mean
+              << ",\"tpot_ms\":" << metrics.get_tpot().mean
+              << ",\"throughput_tps\":" << metrics.get_throughput().mean
+              << "}" << std::endl;
+}
+
+}  // namespace
 
 int main(int argc, char* argv[]) try {
-    cxxopts::Options options("benchmark_vlm", "Help command");
+    cxxopts::Options options("benchmark_vlm", "Benchmark and sweep harness for visual language pipelines");
 
     options.add_options()
     ("m,model", "Path to model and tokenizers base directory", cxxopts::value<std::string>()->default_value("."))
     ("p,prompt", "Prompt", cxxopts::value<std::string>()->default_value("What is on the image?"))
-    ("i,image", "Image", cxxopts::value<std::string>()->default_value("image.jpg"))
+    ("i,image", "Image (used when no resolution sweep is requested)", cxxopts::value<std::string>()->default_value("image.jpg"))
     ("nw,num_warmup", "Number of warmup iterations", cxxopts::value<size_t>()->default_value(std::to_string(1)))
     ("n,num_iter", "Number of iterations", cxxopts::value<size_t>()->default_value(std::to_string(3)))
     ("mt,max_new_tokens", "Maximal number of new tokens", cxxopts::value<size_t>()->default_value(std::to_string(20)))
     ("d,device", "device", cxxopts::value<std::string>()->default_value("CPU"))
+    ("resolutions", "Comma-separated square resolutions to sweep with synthetic images, e.g. 448,896,1344", cxxopts::value<std::string>()->default_value(""))
+    ("image_counts", "Comma-separated image counts per request to sweep", cxxopts::value<std::string>()->default_value("1"))
+    ("gen_lengths", "Comma-separated max_new_tokens values to sweep (overrides -mt)", cxxopts::value<std::string>()->default_value(""))
+    ("json_output", "Append one JSON-lines record per sweep combination to this file", cxxopts::value<std::string>()->default_value(""))
     ("h,help", "Print usage");
 
     cxxopts::ParseResult result;
@@ -41,32 +106,75 @@ int main(int argc, char* argv[]) try {
     std::string device = result["device"].as<std::string>();
     size_t num_warmup = result["num_warmup"].as<size_t>();
     size_t num_iter = result["num_iter"].as<size_t>();
-    ov::Tensor image = utils::load_image(image_path);
-  
-    ov::genai::GenerationConfig config;
-    config.max_new_tokens = result["max_new_tokens"].as<size_t>();
+
+    std::vector<size_t> resolutions = parse_size_list(result["resolutions"].as<std::string>());
+    std::vector<size_t> image_counts = parse_size_list(result["image_counts"].as<std::string>());
+    std::vector<size_t> gen_lengths = parse_size_list(result["gen_lengths"].as<std::string>());
+    if (gen_lengths.empty()) {
+        gen_lengths.push_back(result["max_new_tokens"].as<size_t>());
+    }
+    if (image_counts.empty()) {
+        image_counts.push_back(1);
+    }
+
+    std::ofstream json_file;
+    const std::string json_path = result["json_output"].as<std::string>();
+    if (!json_path.empty()) {
+        json_file.open(json_path, std::ios::app);
+        if (!json_file.is_open()) {
+            throw std::runtime_error("Cannot open JSON output file: " + json_path);
+        }
+    }
 
     ov::genai::VLMPipeline pipe(models_path, device);
-    
-    for (size_t i = 0; i < num_warmup; i++)
-        pipe.generate(prompt, ov::genai::image(image), ov::genai::generation_config(config));
-    
-    auto res = pipe.generate(prompt, ov::genai::image(image), ov::genai::generation_config(config));
-    auto metrics = res.perf_metrics;
-    for (size_t i = 0; i < num_iter - 1; i++) {
-        res = pipe.generate(prompt, ov::genai::image(image), ov::genai::generation_config(config));
-        metrics = metrics + res.perf_metrics;
+
+    // sweep mode: synthetic images per resolution; single-image mode: the provided file
+    struct Combo {
+        size_t resolution;  // 0 means "input file"
+        size_t num_images;
+        size_t gen_len;
+    };
+    std::vector<Combo> combos;
+    if (resolutions.empty()) {
+        for (size_t count : image_counts)
+            for (size_t len : gen_lengths)
+                combos.push_back({0, count, len});
+    } else {
+        for (size_t resolution : resolutions)
+            for (size_t count : image_counts)
+                for (size_t len : gen_lengths)
+                    combos.push_back({resolution, count, len});
     }
 
-    std::cout << std::fixed << std::setprecision(2);
-    std::cout << "Load time: " << metrics.get_load_time() << " ms" << std::endl;
-    std::cout << "Generate time: " << metrics.get_generate_duration().mean << " ± " << metrics.get_generate_duration().std << " ms" << std::endl;
-    std::cout << "Tokenization time: " << metrics.get_tokenization_duration().mean << " ± " << metrics.get_tokenization_duration().std << " ms" << std::endl;
-    std::cout << "Detokenization time: " << metrics.get_detokenization_duration().mean << " ± " << metrics.get_detokenization_duration().std << " ms" << std::endl;
-    std::cout << "Embeddings preparation time: " << metrics.get_prepare_embeddings_duration().mean << " ± " << metrics.get_prepare_embeddings_duration().std << " ms" << std::endl;
-    std::cout << "TTFT: " << metrics.get_ttft().mean  << " ± " << metrics.get_ttft().std << " ms" << std::endl;
-    std::cout << "TPOT: " << metrics.get_tpot().mean  << " ± " << metrics.get_tpot().std << " ms/token " << std::endl;
-    std::cout << "Throughput: " << metrics.get_throughput().mean  << " ± " << metrics.get_throughput().std << " tokens/s" << std::endl;
+    for (const Combo& combo : combos) {
+        ov::Tensor base_image = combo.resolution == 0 ? utils::load_image(image_path)
+                                                      : make_synthetic_image(combo.resolution, combo.resolution);
+        std::vector<ov::Tensor> images(combo.num_images, base_image);
+
+        ov::genai::GenerationConfig config;
+        config.max_new_tokens = combo.gen_len;
+        config.ignore_eos = true;  // sweep combos must generate the same number of tokens to compare
+
+        for (size_t i = 0; i < num_warmup; i++)
+            pipe.generate(prompt, ov::genai::images(images), ov::genai::generation_config(config));
+
+        auto res = pipe.generate(prompt, ov::genai::images(images), ov::genai::generation_config(config));
+        auto metrics = res.perf_metrics;
+        for (size_t i = 0; i < num_iter - 1; i++) {
+            res = pipe.generate(prompt, ov::genai::images(images), ov::genai::generation_config(config));
+            metrics = metrics + res.perf_metrics;
+        }
+
+        std::stringstream label;
+        label << "[res=" << (combo.resolution == 0 ? std::string("file") : std::to_string(combo.resolution))
+              << " images=" << combo.num_images << " tokens=" << combo.gen_len << "]";
+        std::cout << "\n" << label.str() << std::endl;
+        std::cout << label.str() << " Load time: " << metrics.get_load_time() << " ms" << std::endl;
+        print_metrics(metrics, label.str());
+        if (json_file.is_open()) {
+            dump_json(json_file, metrics, combo.resolution, combo.num_images, combo.gen_len);
+        }
+    }
 
     return 0;
 } catch (const std::exception& error) {
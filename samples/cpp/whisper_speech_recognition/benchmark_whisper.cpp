@@ -0,0 +1,177 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "audio_utils.hpp"
+#include "openvino/genai/whisper_pipeline.hpp"
+
+namespace {
+
+struct RunResult {
+    float audio_seconds = 0.f;
+    float generate_ms = 0.f;
+    float features_extraction_ms = 0.f;
+    float inference_ms = 0.f;
+    size_t num_generated_tokens = 0;
+};
+
+float sum_ms(const std::vector<ov::genai::MicroSeconds>& durations) {
+    float total = 0.f;
+    for (const auto& duration : durations) {
+        total += duration.count() / 1000.f;
+    }
+    return total;
+}
+
+RunResult run_once(ov::genai::WhisperPipeline& pipeline,
+                   const ov::genai::RawSpeechInput& raw_speech,
+                   const ov::genai::WhisperGenerationConfig& config) {
+    RunResult run;
+    run.audio_seconds = raw_speech.size() / 16000.f;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto result = pipeline.generate(raw_speech, config);
+    run.generate_ms =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() /
+        1000.f;
+
+    auto& metrics = result.perf_metrics;
+    run.features_extraction_ms = sum_ms(metrics.whisper_raw_metrics.features_extraction_durations);
+    run.inference_ms = metrics.get_inference_duration().mean;
+    run.num_generated_tokens = metrics.get_num_generated_tokens();
+    return run;
+}
+
+void print_run(const RunResult& run, const std::string& prefix) {
+    const float rtf = run.generate_ms / 1000.f / run.audio_seconds;
+    std::cout << prefix << " audio: " << run.audio_seconds << " s, generate: " << run.generate_ms
+              << " ms, RTF: " << rtf << ", feature extraction: " << run.features_extraction_ms
+              << " ms, model inference: " << run.inference_ms << " ms, generated tokens: " << run.num_generated_tokens
+              << std::endl;
+}
+
+// one JSON-lines record per run, machine-comparable across commits like benchmark_image_gen
+void dump_run_json(std::ofstream& json_file, const RunResult& run, const std::string& label, size_t thread_idx) {
+    json_file << "{\"label\":\"" << label << "\",\"thread\":" << thread_idx
+              << ",\"audio_seconds\":" << run.audio_seconds << ",\"generate_ms\":" << run.generate_ms
+              << ",\"rtf\":" << (run.generate_ms / 1000.f / run.audio_seconds)
+              << ",\"features_extraction_ms\":" << run.features_extraction_ms
+              << ",\"inference_ms\":" << run.inference_ms << ",\"num_generated_tokens\":" << run.num_generated_tokens
+              << "}" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("benchmark_whisper", "Benchmark for Whisper speech recognition pipelines");
+
+    options.add_options()
+        ("m,model", "Path to the model directory", cxxopts::value<std::string>())
+        ("w,wav", "Path to a 16kHz WAV file", cxxopts::value<std::string>())
+        ("d,device", "Device to run on", cxxopts::value<std::string>()->default_value("CPU"))
+        ("n,num_iter", "Measured iterations per pipeline", cxxopts::value<size_t>()->default_value("3"))
+        ("num_warmup", "Warmup iterations per pipeline", cxxopts::value<size_t>()->default_value("1"))
+        ("c,concurrency", "Number of pipelines running in parallel", cxxopts::value<size_t>()->default_value("1"))
+        ("max_new_tokens", "Maximum number of generated tokens", cxxopts::value<size_t>()->default_value("100"))
+        ("language", "Language token for multilingual models, e.g. <|en|>", cxxopts::value<std::string>()->default_value(""))
+        ("json_output", "Append per-run metrics to this JSON-lines file", cxxopts::value<std::string>()->default_value(""))
+        ("h,help", "Print usage");
+
+    cxxopts::ParseResult parsed = options.parse(argc, argv);
+    if (parsed.count("help") || !parsed.count("model") || !parsed.count("wav")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const std::filesystem::path models_path = parsed["model"].as<std::string>();
+    const std::string wav_file_path = parsed["wav"].as<std::string>();
+    const std::string device = parsed["device"].as<std::string>();
+    const size_t num_iter = parsed["num_iter"].as<size_t>();
+    const size_t num_warmup = parsed["num_warmup"].as<size_t>();
+    const size_t concurrency = parsed["concurrency"].as<size_t>();
+    const std::string json_path = parsed["json_output"].as<std::string>();
+
+    ov::genai::RawSpeechInput raw_speech = utils::audio::read_wav(wav_file_path);
+
+    std::vector<std::unique_ptr<ov::genai::WhisperPipeline>> pipelines;
+    for (size_t i = 0; i < concurrency; ++i) {
+        pipelines.push_back(std::make_unique<ov::genai::WhisperPipeline>(models_path, device));
+    }
+
+    ov::genai::WhisperGenerationConfig config = pipelines.front()->get_generation_config();
+    config.max_new_tokens = parsed["max_new_tokens"].as<size_t>();
+    if (!parsed["language"].as<std::string>().empty()) {
+        config.language = parsed["language"].as<std::string>();
+        config.task = "transcribe";
+    }
+
+    std::ofstream json_file;
+    if (!json_path.empty()) {
+        json_file.open(json_path, std::ios::app);
+        if (!json_file.is_open()) {
+            throw std::runtime_error("Cannot open JSON output file: " + json_path);
+        }
+    }
+
+    for (size_t i = 0; i < num_warmup; ++i) {
+        run_once(*pipelines.front(), raw_speech, config);
+    }
+
+    std::vector<std::vector<RunResult>> per_thread_runs(concurrency);
+    const auto wall_start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (size_t thread_idx = 0; thread_idx < concurrency; ++thread_idx) {
+        workers.emplace_back([&, thread_idx]() {
+            for (size_t i = 0; i < num_iter; ++i) {
+                per_thread_runs[thread_idx].push_back(run_once(*pipelines[thread_idx], raw_speech, config));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    const float wall_s =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - wall_start).count() /
+        1000.f;
+
+    float total_audio_s = 0.f, total_generate_ms = 0.f, total_features_ms = 0.f;
+    for (size_t thread_idx = 0; thread_idx < concurrency; ++thread_idx) {
+        for (size_t i = 0; i < per_thread_runs[thread_idx].size(); ++i) {
+            const auto& run = per_thread_runs[thread_idx][i];
+            print_run(run, "[warm-" + std::to_string(thread_idx) + "-" + std::to_string(i) + "]");
+            if (json_file.is_open()) {
+                dump_run_json(json_file, run, "whisper", thread_idx);
+            }
+            total_audio_s += run.audio_seconds;
+            total_generate_ms += run.generate_ms;
+            total_features_ms += run.features_extraction_ms;
+        }
+    }
+
+    std::cout << "\n[total] processed audio: " << total_audio_s << " s in " << wall_s
+              << " s wall time, aggregate speedup over real time: " << (total_audio_s / wall_s)
+              << "x, avg RTF: " << (total_generate_ms / 1000.f / total_audio_s)
+              << ", feature extraction share: " << (total_features_ms / total_generate_ms * 100.f) << " %"
+              << std::endl;
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    try {
+        std::cerr << error.what() << '\n';
+    } catch (const std::ios_base::failure&) {
+    }
+    return EXIT_FAILURE;
+} catch (...) {
+    try {
+        std::cerr << "Non-exception object thrown\n";
+    } catch (const std::ios_base::failure&) {
+    }
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,173 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for OpenVINO GenAI C API, which is a C wrapper for the
+ * ov::genai::ContinuousBatchingPipeline class.
+ *
+ * Result delivery is arena based: token ids pulled from a generation handle are bump-allocated
+ * into a caller-provided arena and returned as views pointing into that arena. The library never
+ * allocates result memory on its own, so a server can reuse one arena per worker and reset it
+ * between pulls without any per-token malloc/free traffic.
+ *
+ * @file continuous_batching_pipeline.h
+ */
+
+#pragma once
+#include "generation_config.h"
+#include "perf_metrics.h"
+
+/**
+ * @struct ov_genai_continuous_batching_pipeline
+ * @brief type define ov_genai_continuous_batching_pipeline from ov_genai_continuous_batching_pipeline_opaque
+ */
+typedef struct ov_genai_continuous_batching_pipeline_opaque ov_genai_continuous_batching_pipeline;
+
+/**
+ * @struct ov_genai_generation_handle
+ * @brief type define ov_genai_generation_handle from ov_genai_generation_handle_opaque
+ */
+typedef struct ov_genai_generation_handle_opaque ov_genai_generation_handle;
+
+/**
+ * @struct ov_genai_string_arena
+ * @brief Caller-owned bump allocator backing pulled results. The library appends to data at
+ * offset used (aligned as needed) and advances used; it never reallocates or frees data. The
+ * caller resets used to reuse the arena once previously returned views are no longer needed.
+ */
+typedef struct {
+    char* data;
+    size_t capacity;
+    size_t used;
+} ov_genai_string_arena;
+
+/**
+ * @struct ov_genai_generation_output_view
+ * @brief One sequence's pulled output. token_ids points into the arena passed to the pull call
+ * and stays valid until the caller resets or frees that arena.
+ */
+typedef struct {
+    uint64_t sequence_id;
+    const int64_t* token_ids;
+    size_t num_tokens;
+    float score;
+    int finish_reason;
+} ov_genai_generation_output_view;
+
+/**
+ * @brief Construct ov_genai_continuous_batching_pipeline.
+ * @param models_path Path to the directory containing the model files.
+ * @param device Name of a device to load a model to.
+ * @param cache_size KV cache size in GB.
+ * @param pipe A pointer to the newly created ov_genai_continuous_batching_pipeline.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_continuous_batching_pipeline_create(
+    const char* models_path,
+    const char* device,
+    size_t cache_size,
+    ov_genai_continuous_batching_pipeline** pipe);
+
+/**
+ * @brief Release the memory allocated by ov_genai_continuous_batching_pipeline.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline to free memory.
+ */
+OPENVINO_GENAI_C_EXPORTS void ov_genai_continuous_batching_pipeline_free(ov_genai_continuous_batching_pipeline* pipe);
+
+/**
+ * @brief Add a request to the pipeline and return its generation handle. The request starts
+ * running on subsequent step calls.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param request_id Caller-chosen id reported back in results; must be unique among live requests.
+ * @param prompt The prompt to generate from.
+ * @param config A pointer to the ov_genai_generation_config, or NULL for the pipeline default.
+ * @param handle A pointer to the newly created ov_genai_generation_handle. Free it with
+ * ov_genai_generation_handle_free to drop the request.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_continuous_batching_pipeline_add_request(
+    ov_genai_continuous_batching_pipeline* pipe,
+    uint64_t request_id,
+    const char* prompt,
+    const ov_genai_generation_config* config,
+    ov_genai_generation_handle** handle);
+
+/**
+ * @brief Run one scheduling + inference iteration over all running requests.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_continuous_batching_pipeline_step(
+    ov_genai_continuous_batching_pipeline* pipe);
+
+/**
+ * @brief Check whether any request still has tokens to generate.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param has_requests A pointer to the result: non-zero while further step calls are needed.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_continuous_batching_pipeline_has_non_finished_requests(
+    ov_genai_continuous_batching_pipeline* pipe,
+    int* has_requests);
+
+/**
+ * @brief Decode token ids to text using the pipeline's tokenizer. The resulting string (including
+ * its null terminator) is bump-allocated into the arena and returned as a view into it.
+ * @param pipe A pointer to the ov_genai_continuous_batching_pipeline instance.
+ * @param token_ids Token ids to decode.
+ * @param num_tokens Number of token ids.
+ * @param arena Caller-owned arena receiving the decoded string; OUT_OF_BOUNDS(-6) if it is full.
+ * @param text A pointer to the decoded null-terminated string inside the arena.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_continuous_batching_pipeline_decode(
+    ov_genai_continuous_batching_pipeline* pipe,
+    const int64_t* token_ids,
+    size_t num_tokens,
+    ov_genai_string_arena* arena,
+    const char** text);
+
+/**
+ * @brief Release the generation handle. Dropping the handle of an unfinished request cancels it.
+ * @param handle A pointer to the ov_genai_generation_handle to free memory.
+ */
+OPENVINO_GENAI_C_EXPORTS void ov_genai_generation_handle_free(ov_genai_generation_handle* handle);
+
+/**
+ * @brief Get the generation status of the request behind the handle.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @param status A pointer to the result, one of ov::genai::GenerationStatus as int.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_get_status(
+    const ov_genai_generation_handle* handle,
+    int* status);
+
+/**
+ * @brief Check whether the handle has unread outputs.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @param can_read A pointer to the result: non-zero when a pull would return data.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_can_read(
+    const ov_genai_generation_handle* handle,
+    int* can_read);
+
+/**
+ * @brief Pull all currently available outputs without blocking. Token ids are bump-allocated into
+ * the arena; outputs receives one view per sequence pointing into it.
+ * @param handle A pointer to the ov_genai_generation_handle instance.
+ * @param arena Caller-owned arena receiving the token ids; OUT_OF_BOUNDS(-6) if it is full.
+ * @param outputs A pointer to the pre-allocated view array filled by the call.
+ * @param outputs_capacity Number of elements in the outputs array; OUT_OF_BOUNDS(-6) if more
+ * sequences are pending than fit.
+ * @param num_outputs A pointer to the number of views written.
+ * @return ov_status_e A status code, return OK(0) if successful.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_generation_handle_pull(
+    ov_genai_generation_handle* handle,
+    ov_genai_string_arena* arena,
+    ov_genai_generation_output_view* outputs,
+    size_t outputs_capacity,
+    size_t* num_outputs);
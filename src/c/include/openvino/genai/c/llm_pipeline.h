@@ -108,6 +108,21 @@ typedef struct {
     void* args;  //!< Pointer to the arguments passed to the callback function
 } streamer_callback;
 
+/**
+ * @brief Zero-copy variant of the streamer callback.
+ *
+ * The callback receives the UTF-8 text delta as a pointer + length view into the buffer owned by
+ * the pipeline, so no per-token allocation, copy or NUL-termination scan happens at the C boundary.
+ * The data is NOT NUL-terminated and stays valid only until the callback returns; a consumer which
+ * needs the delta afterwards must copy it into its own storage before returning.
+ */
+typedef struct {
+    ov_genai_streamming_status_e(OPENVINO_C_API_CALLBACK* callback_func)(const char* data,
+                                                                         size_t length,
+                                                                         void* args);  //!< Pointer to the callback function
+    void* args;  //!< Pointer to the arguments passed to the callback function
+} streamer_view_callback;
+
 /**
  * @brief Generate results by ov_genai_llm_pipeline
  * @param pipe A pointer to the ov_genai_llm_pipeline instance.
@@ -124,6 +139,24 @@ OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_llm_pipeline_generate(ov_genai_llm
                                                                     const ov_genai_generation_config* config,
                                                                     const streamer_callback* streamer,
                                                                     ov_genai_decoded_results** results);
+
+/**
+ * @brief Same as ov_genai_llm_pipeline_generate, but streams text deltas through the zero-copy
+ * pointer + length callback instead of NUL-terminated strings.
+ * @param pipe A pointer to the ov_genai_llm_pipeline instance.
+ * @param inputs A pointer to the input string.
+ * @param config A pointer to the ov_genai_generation_config, the pointer can be NULL.
+ * @param streamer A pointer to the zero-copy stream callback. Set to NULL if no callback is needed. Either this or
+ * results must be non-NULL.
+ * @param results A pointer to the ov_genai_decoded_results, which retrieves the results of the generation. Either this
+ * or streamer must be non-NULL.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_GENAI_C_EXPORTS ov_status_e ov_genai_llm_pipeline_generate_with_view_streamer(ov_genai_llm_pipeline* pipe,
+                                                                                       const char* inputs,
+                                                                                       const ov_genai_generation_config* config,
+                                                                                       const streamer_view_callback* streamer,
+                                                                                       ov_genai_decoded_results** results);
 /**
  * @brief Start chat with keeping history in kv cache.
  * @param pipe A pointer to the ov_genai_llm_pipeline instance.
@@ -0,0 +1,205 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include "openvino/genai/c/continuous_batching_pipeline.h"
+
+#include <cstring>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/generation_config.hpp"
+#include "types_c.h"
+
+namespace {
+
+// Bump-allocates size bytes aligned to alignment out of the caller arena, or nullptr if it is full.
+char* arena_allocate(ov_genai_string_arena* arena, size_t size, size_t alignment) {
+    size_t offset = (arena->used + alignment - 1) & ~(alignment - 1);
+    if (offset + size > arena->capacity) {
+        return nullptr;
+    }
+    arena->used = offset + size;
+    return arena->data + offset;
+}
+
+}  // namespace
+
+ov_status_e ov_genai_continuous_batching_pipeline_create(const char* models_path,
+                                                         const char* device,
+                                                         size_t cache_size,
+                                                         ov_genai_continuous_batching_pipeline** pipe) {
+    if (!models_path || !device || !pipe) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::genai::SchedulerConfig scheduler_config;
+        scheduler_config.cache_size = cache_size;
+        std::unique_ptr<ov_genai_continuous_batching_pipeline> _pipe =
+            std::make_unique<ov_genai_continuous_batching_pipeline>();
+        _pipe->object = std::make_shared<ov::genai::ContinuousBatchingPipeline>(std::filesystem::path(models_path),
+                                                                                scheduler_config,
+                                                                                std::string(device));
+        *pipe = _pipe.release();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+void ov_genai_continuous_batching_pipeline_free(ov_genai_continuous_batching_pipeline* pipe) {
+    if (pipe) {
+        delete pipe;
+    }
+}
+
+ov_status_e ov_genai_continuous_batching_pipeline_add_request(ov_genai_continuous_batching_pipeline* pipe,
+                                                              uint64_t request_id,
+                                                              const char* prompt,
+                                                              const ov_genai_generation_config* config,
+                                                              ov_genai_generation_handle** handle) {
+    if (!pipe || !(pipe->object) || !prompt || !handle || (config && !(config->object))) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        ov::genai::GenerationConfig sampling_params =
+            config ? *(config->object) : pipe->object->get_config();
+        std::unique_ptr<ov_genai_generation_handle> _handle = std::make_unique<ov_genai_generation_handle>();
+        _handle->object = pipe->object->add_request(request_id, std::string(prompt), sampling_params);
+        *handle = _handle.release();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_continuous_batching_pipeline_step(ov_genai_continuous_batching_pipeline* pipe) {
+    if (!pipe || !(pipe->object)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        pipe->object->step();
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_continuous_batching_pipeline_has_non_finished_requests(
+    ov_genai_continuous_batching_pipeline* pipe,
+    int* has_requests) {
+    if (!pipe || !(pipe->object) || !has_requests) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *has_requests = pipe->object->has_non_finished_requests() ? 1 : 0;
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_continuous_batching_pipeline_decode(ov_genai_continuous_batching_pipeline* pipe,
+                                                         const int64_t* token_ids,
+                                                         size_t num_tokens,
+                                                         ov_genai_string_arena* arena,
+                                                         const char** text) {
+    if (!pipe || !(pipe->object) || (!token_ids && num_tokens > 0) || !arena || !(arena->data) || !text) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::string decoded =
+            pipe->object->get_tokenizer().decode(std::vector<int64_t>(token_ids, token_ids + num_tokens));
+        char* destination = arena_allocate(arena, decoded.size() + 1, alignof(char));
+        if (!destination) {
+            return ov_status_e::OUT_OF_BOUNDS;
+        }
+        std::memcpy(destination, decoded.c_str(), decoded.size() + 1);
+        *text = destination;
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+void ov_genai_generation_handle_free(ov_genai_generation_handle* handle) {
+    if (handle) {
+        delete handle;
+    }
+}
+
+ov_status_e ov_genai_generation_handle_get_status(const ov_genai_generation_handle* handle, int* status) {
+    if (!handle || !(handle->object) || !status) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *status = static_cast<int>(handle->object->get_status());
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_handle_can_read(const ov_genai_generation_handle* handle, int* can_read) {
+    if (!handle || !(handle->object) || !can_read) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        *can_read = handle->object->can_read() ? 1 : 0;
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_genai_generation_handle_pull(ov_genai_generation_handle* handle,
+                                            ov_genai_string_arena* arena,
+                                            ov_genai_generation_output_view* outputs,
+                                            size_t outputs_capacity,
+                                            size_t* num_outputs) {
+    if (!handle || !(handle->object) || !arena || !(arena->data) || !outputs || !num_outputs) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        // outputs consumed from the stream but not delivered on a previous failed pull are
+        // retried first, so OUT_OF_BOUNDS never loses tokens - the caller resets or grows the
+        // arena / view array and pulls again
+        ov::genai::GenerationOutputs pulled = std::move(handle->spilled_outputs);
+        handle->spilled_outputs.clear();
+        if (pulled.empty()) {
+            pulled = handle->object->read_pending();
+        }
+        size_t total_tokens = 0;
+        for (const auto& [sequence_id, output] : pulled) {
+            total_tokens += output.generated_ids.size();
+        }
+        if (pulled.size() > outputs_capacity) {
+            handle->spilled_outputs = std::move(pulled);
+            return ov_status_e::OUT_OF_BOUNDS;
+        }
+        int64_t* destination = nullptr;
+        if (total_tokens > 0) {
+            destination = reinterpret_cast<int64_t*>(
+                arena_allocate(arena, total_tokens * sizeof(int64_t), alignof(int64_t)));
+            if (!destination) {
+                handle->spilled_outputs = std::move(pulled);
+                return ov_status_e::OUT_OF_BOUNDS;
+            }
+        }
+        size_t view_index = 0;
+        for (const auto& [sequence_id, output] : pulled) {
+            outputs[view_index].sequence_id = sequence_id;
+            outputs[view_index].token_ids = output.generated_ids.empty() ? nullptr : destination;
+            outputs[view_index].num_tokens = output.generated_ids.size();
+            outputs[view_index].score = output.score;
+            outputs[view_index].finish_reason = static_cast<int>(output.finish_reason);
+            if (!output.generated_ids.empty()) {
+                std::memcpy(destination, output.generated_ids.data(), output.generated_ids.size() * sizeof(int64_t));
+                destination += output.generated_ids.size();
+            }
+            ++view_index;
+        }
+        *num_outputs = view_index;
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
@@ -120,6 +120,43 @@ ov_status_e ov_genai_llm_pipeline_generate(ov_genai_llm_pipeline* pipe,
     }
     return ov_status_e::OK;
 }
+ov_status_e ov_genai_llm_pipeline_generate_with_view_streamer(ov_genai_llm_pipeline* pipe,
+                                                              const char* inputs,
+                                                              const ov_genai_generation_config* config,
+                                                              const streamer_view_callback* streamer,
+                                                              ov_genai_decoded_results** results) {
+    if (!pipe || !(pipe->object) || !inputs || !(streamer || results)) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+    try {
+        std::unique_ptr<ov_genai_decoded_results> _results = std::make_unique<ov_genai_decoded_results>();
+        _results->object = std::make_shared<ov::genai::DecodedResults>();
+        std::string input_str(inputs);
+        ov::genai::StringInputs input = {input_str};
+        if (streamer) {
+            // the delta is handed over as a pointer + length view valid for the callback duration,
+            // no NUL-termination or extra copy happens on this path
+            auto callback = [streamer](std::string word) -> ov::genai::StreamingStatus {
+                return static_cast<ov::genai::StreamingStatus>(
+                    (streamer->callback_func)(word.data(), word.length(), streamer->args));
+            };
+            *(_results->object) = (config && config->object)
+                                      ? pipe->object->generate(input, *(config->object), callback)
+                                      : pipe->object->generate(input, {}, callback);
+        } else {
+            *(_results->object) = (config && config->object) ? pipe->object->generate(input, *(config->object))
+                                                             : pipe->object->generate(input);
+        }
+        if (results) {
+            *results = _results.release();
+        }
+
+    } catch (...) {
+        return ov_status_e::UNKNOW_EXCEPTION;
+    }
+    return ov_status_e::OK;
+}
+
 ov_status_e ov_genai_llm_pipeline_start_chat(ov_genai_llm_pipeline* pipe) {
     if (!pipe || !(pipe->object)) {
         return ov_status_e::INVALID_C_PARAM;
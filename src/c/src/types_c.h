@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #pragma once
+#include "openvino/genai/continuous_batching_pipeline.hpp"
 #include "openvino/genai/generation_config.hpp"
+#include "openvino/genai/generation_handle.hpp"
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/visibility.hpp"
 
@@ -35,3 +37,20 @@ struct ov_genai_perf_metrics_opaque {
 struct ov_genai_decoded_results_opaque {
     std::shared_ptr<ov::genai::DecodedResults> object;
 };
+/**
+ * @struct ov_genai_continuous_batching_pipeline_opaque
+ * @brief This is an interface of ov::genai::ContinuousBatchingPipeline
+ */
+struct ov_genai_continuous_batching_pipeline_opaque {
+    std::shared_ptr<ov::genai::ContinuousBatchingPipeline> object;
+};
+/**
+ * @struct ov_genai_generation_handle_opaque
+ * @brief This is an interface of ov::genai::GenerationHandle. spilled_outputs holds outputs
+ * already consumed from the stream that did not fit the caller's arena or view array on the last
+ * pull, so the caller can grow/reset and retry without losing tokens.
+ */
+struct ov_genai_generation_handle_opaque {
+    ov::genai::GenerationHandle object;
+    ov::genai::GenerationOutputs spilled_outputs;
+};
@@ -12,9 +12,14 @@ namespace ov::genai {
     *        from cache
     */
     enum class AggregationMode {
-        SUM,     /**< In this mode the importance scores of each token will be summed after each step of generation */
-        NORM_SUM /**< Same as SUM, but the importance scores are additionally divided by the lifetime (in tokens generated)
+        SUM,      /**< In this mode the importance scores of each token will be summed after each step of generation */
+        NORM_SUM, /**< Same as SUM, but the importance scores are additionally divided by the lifetime (in tokens generated)
                     * of a given token in cache */
+        SNAP_KV   /**< SnapKV-style observation window: scores are accumulated with exponential decay so that only
+                    * the attention of the most recent ~snapkv_window_size generation steps drives importance, and
+                    * block scores are computed over kernel-smoothed per-token importance (pooling over
+                    * snapkv_kernel_size neighboring positions). Recommended for aggressive eviction ratios on
+                    * long-context summarization. */
     };
 
     /**
@@ -61,6 +66,22 @@ namespace ov::genai {
         /** The mode used to compute the importance of tokens for eviction */
         AggregationMode aggregation_mode = AggregationMode::NORM_SUM;
 
+        /** Effective observation window (in generation steps) of the SNAP_KV aggregation mode: scores older
+         *  than roughly this many steps stop contributing to token importance. Ignored by other modes. */
+        std::size_t snapkv_window_size = 8;
+
+        /** Width (in token positions, odd) of the smoothing kernel applied to per-token importance before
+         *  block scores are computed in SNAP_KV mode. Ignored by other modes. */
+        std::size_t snapkv_kernel_size = 5;
+
+        /** Fraction in (0, 1) of the highest per-token importance scores whose blocks are treated
+         *  as "landmarks" and protected from eviction (e.g. 0.99 protects blocks holding the top 1%
+         *  of token scores). Anchor tokens such as section headers or instructions keep whole blocks
+         *  alive even when the block's aggregate score is low, markedly improving long-context
+         *  quality at high eviction ratios. At most half of the evictable blocks can be protected,
+         *  so eviction always makes progress. 0 (default) disables landmark protection. */
+        float landmark_score_percentile = 0.0f;
+
         /** Whether to apply cache rotation (RoPE-based) after each eviction.
          *  Set this to false if your model has different RoPE scheme from the one used in the
          *  original llama model and you experience accuracy issues with cache eviction enabled
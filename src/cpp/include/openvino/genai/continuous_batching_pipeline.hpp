@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <filesystem>
 
@@ -57,6 +58,103 @@ struct PipelineMetrics {
     float inference_duration = 0.0;
 };
 
+/**
+ * Snapshot of KV block manager counters for production telemetry, cheap enough to poll at 1Hz.
+ * Counter fields are cumulative since pipeline construction.
+ */
+struct BlockManagerStats {
+    /** Total number of physical KV blocks managed by the pipeline. */
+    size_t total_blocks = 0;
+    /** Number of blocks currently neither owned by a sequence nor holding reusable prefix data. */
+    size_t free_blocks = 0;
+    /** Number of blocks currently parked in the prefix-cache overwritable store. */
+    size_t overwritable_blocks = 0;
+    /** Blocks taken from the free pool (cumulative). */
+    size_t num_blocks_allocated = 0;
+    /** Blocks fully released by sequences (cumulative). */
+    size_t num_blocks_freed = 0;
+    /** Prefix-cache hits: blocks restored from cached content instead of being recomputed (cumulative). */
+    size_t num_blocks_restored = 0;
+    /** Prefix-cache evictions: cached blocks selected for overwriting (cumulative). */
+    size_t num_blocks_overwritten = 0;
+    /** Copy-on-write block copies triggered by forked sequences (cumulative). */
+    size_t num_cow_copies = 0;
+};
+
+/**
+ * State of one in-flight request captured by ContinuousBatchingPipeline::drain_requests(), enough
+ * to resubmit the request (to this or another pipeline instance) and continue where it stopped.
+ */
+struct RequestCheckpoint {
+    uint64_t request_id = 0;
+    /** Original prompt token ids. */
+    std::vector<int64_t> prompt_ids;
+    /** Generated token ids of each live sequence of the request. */
+    std::vector<std::vector<int64_t>> generated_ids;
+    GenerationConfig sampling_params;
+};
+
+/**
+ * Live snapshot of speculative decoding health, pollable while requests run (empty/zero for
+ * non-speculative pipelines). Durations are cumulative milliseconds since pipeline start.
+ */
+struct SpeculativeDecodingSnapshot {
+    float draft_duration_ms = 0.f;
+    float main_duration_ms = 0.f;
+    /** Smoothed per-request acceptance rate in percent. */
+    std::map<int64_t, float> acceptance_rate_ewma_per_request;
+    /** Global histogram of per-iteration acceptance rates, 10%-wide buckets. */
+    std::vector<size_t> acceptance_rate_histogram;
+};
+
+/**
+ * One scheduling decision per pipeline step: which requests made it into the batch, which were
+ * left out and the dominant reason, plus the step's budget/cache context. Records are cheap
+ * enough for always-on collection, so capacity incidents can be diagnosed from the history
+ * instead of reproduction attempts.
+ */
+struct SchedulingDecisionRecord {
+    enum class SkipReason {
+        WAITING,        // request was waiting/paused (preempted earlier, backpressure, deferred)
+        TOKEN_BUDGET,   // step ran out of the per-step token budget before reaching the request
+        BLOCK_SHORTAGE  // KV block pool could not serve the request this step
+    };
+
+    uint64_t step = 0;
+    std::vector<uint64_t> scheduled_request_ids;
+    std::vector<std::pair<uint64_t, SkipReason>> skipped_request_ids;
+    size_t total_scheduled_tokens = 0;
+    size_t num_preemptions = 0;
+    float cache_usage_percent = 0.f;
+};
+
+/**
+ * Per-step phase timings recorded by the continuous batching step loop into a fixed-size ring,
+ * queryable live without stopping generation. All durations are in microseconds.
+ */
+struct StepPhaseTimings {
+    /** Monotonically increasing step counter of the pipeline. */
+    uint64_t step_id = 0;
+    /** Time spent in the scheduler (token budgeting, preemption, block allocation). */
+    float schedule_duration = 0.0f;
+    /** Time the step loop waited for the model inference. */
+    float infer_duration = 0.0f;
+    /** Time spent in logit processing and sampling. */
+    float sample_duration = 0.0f;
+    /** Time spent in post-processing: sequence forking/freeing, stream notification, cleanup. */
+    float postprocess_duration = 0.0f;
+};
+
+/*
+ * NOTE on pipeline pooling with shared weights: within one process, compiled-model weight sharing
+ * happens at the runtime level - infer requests created from one ov::CompiledModel already share
+ * its weights, which is how a single ContinuousBatchingPipeline serves many concurrent requests
+ * (separate KV caches, shared weights). Running several *pipeline objects* against one compiled
+ * model would need the runtime to expose compiled-model handles for re-wrapping, which the public
+ * API does not; across processes, the copy-on-write story is the OS page cache over ov::cache_dir
+ * blobs with enable_mmap. The recommended deployment for N replicas on one host is therefore one
+ * pipeline with N-fold max_num_seqs rather than N pipelines.
+ */
 class OPENVINO_GENAI_EXPORTS ContinuousBatchingPipeline {
 protected:
     class IContinuousBatchingPipeline;
@@ -160,10 +258,105 @@ public:
      */
     ov::genai::PipelineMetrics get_metrics() const;
 
+    /**
+     * Returns the phase timings of up to `max_steps` most recent generation steps (oldest first),
+     * sampled live from a lock-free ring without stopping generation. Entries being overwritten
+     * concurrently may be skipped.
+     * @param max_steps maximum number of step records to return.
+     */
+    std::vector<ov::genai::StepPhaseTimings> get_recent_step_timings(size_t max_steps = 256) const;
+
+    /**
+     * Returns a snapshot of the KV block manager counters (fragmentation, prefix-cache reuse and
+     * eviction rates, copy-on-write activity) for production telemetry.
+     */
+    ov::genai::BlockManagerStats get_block_manager_stats() const;
+
+    /**
+     * Returns the most recent per-step scheduling decision records (newest last, bounded
+     * history). Empty for backends without a batch scheduler.
+     */
+    std::vector<ov::genai::SchedulingDecisionRecord> get_recent_scheduling_decisions() const;
+
+    /**
+     * @brief Drains the pipeline for a rolling upgrade: permanently stops admissions (subsequent
+     * add_request calls throw), stops all in-flight and queued requests (their handles observe
+     * STOP status), and returns a checkpoint per request holding the prompt, the tokens generated
+     * so far and the sampling parameters. Feed the checkpoints to import_drained_requests() on a
+     * replacement pipeline to continue them, bounding the deploy gap to one prefill instead of a
+     * full drain. Must not be called concurrently with step() / generate(); call it from the
+     * thread driving the pipeline, between steps.
+     */
+    std::vector<RequestCheckpoint> drain_requests();
+
+    /**
+     * @brief Resubmits requests captured by drain_requests() on another instance. Single-sequence
+     * requests continue from their last generated token (the generated prefix is replayed through
+     * prefill, which prefix caching accelerates); multi-sequence (beam/parallel) requests restart
+     * from the prompt, since their divergent per-beam KV states cannot be reconstructed from
+     * token ids alone. Returns one handle per checkpoint, in order.
+     */
+    std::vector<GenerationHandle> import_drained_requests(const std::vector<RequestCheckpoint>& checkpoints);
+
+    /**
+     * @brief Runs synthetic prefill + decode iterations across the given prompt lengths so the
+     * first real request does not pay the plugin's lazy-allocation and JIT warmup costs. Call
+     * once after construction, before serving traffic; a load balancer can treat its completion
+     * as warm readiness.
+     */
+    void warmup(const std::vector<size_t>& prompt_lengths = {64});
+
+    /**
+     * @brief Runs a prompt-only (prefill) pass and returns the final hidden state of each
+     * prompt's last token as one [hidden_size] tensor per prompt, sharing the scheduler and KV
+     * cache pool with generation. Requires the pipeline to be constructed with the
+     * "enable_hidden_state_output" property set to true.
+     */
+    std::vector<ov::Tensor> embed(const std::vector<std::string>& prompts);
+
+    /**
+     * Returns a live snapshot of speculative decoding acceptance and duration statistics while
+     * requests run, so acceptance-rate collapse (draft/domain mismatch) is detectable within
+     * seconds. Non-speculative pipelines return an empty snapshot.
+     */
+    ov::genai::SpeculativeDecodingSnapshot get_speculative_decoding_snapshot() const;
+
+    /**
+     * Updates the reconfigurable scheduler limits (max_num_batched_tokens, max_num_seqs,
+     * prefill/share/admission/SLO knobs) at the next step boundary without restarting the
+     * pipeline or dropping sessions. Structural fields (cache sizing, prefix caching, eviction
+     * configuration) are ignored - changing them requires a rebuild.
+     */
+    void update_scheduler_limits(const SchedulerConfig& config);
+
+    // NOTE on async serving: add_request IS the non-blocking API - it returns immediately with a
+    // GenerationHandle whose read()/read_pending() deliver tokens as the background step loop
+    // produces them, so N in-flight requests need one stepping thread plus however many consumer
+    // threads the server wants, not N blocked callers. Completion futures/coroutine awaitables are
+    // thin wrappers a server builds over the handle (poll can_read/get_status or block in read);
+    // baking one async runtime's primitives into this API would tie the library to it.
     GenerationHandle add_request(uint64_t request_id, const ov::Tensor& input_ids, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const ov::genai::GenerationConfig& sampling_params);
     GenerationHandle add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& images, const ov::genai::GenerationConfig& sampling_params);
 
+    /**
+     * @brief Pins the KV cache blocks holding the prefix of the given prompt, so that the prefix caching
+     * eviction logic never overwrites them. Only blocks whose contents are already cached (i.e. the prefix
+     * was processed by a previous request) are affected. Has effect only when prefix caching is enabled.
+     * @param prompt A prompt (or its tokenized form) whose prefix blocks should be kept cached.
+     * @return The number of KV cache blocks pinned.
+     */
+    size_t pin_prompt_prefix(const ov::Tensor& input_ids);
+    size_t pin_prompt_prefix(const std::string& prompt);
+
+    /**
+     * @brief Reverts pin_prompt_prefix, making the prefix blocks evictable again.
+     * @param prompt A prompt (or its tokenized form) previously passed to pin_prompt_prefix.
+     * @return The number of KV cache blocks unpinned.
+     */
+    size_t unpin_prompt_prefix(const ov::Tensor& input_ids);
+    size_t unpin_prompt_prefix(const std::string& prompt);
+
     void step();
 
     bool has_non_finished_requests();
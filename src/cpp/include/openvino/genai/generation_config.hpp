@@ -89,6 +89,14 @@ public:
 
     // Generic
     size_t max_new_tokens = SIZE_MAX;
+    /**
+     * @brief Streaming backpressure bound: when more than this many output frames are queued on
+     * the request's GenerationHandle without being read (e.g. a stalled SSE client), the
+     * scheduler pauses the request - its KV blocks are retained but no new tokens are generated
+     * or queued - and resumes it once the consumer drains below half the bound. 0 (default)
+     * keeps the queue unbounded.
+     */
+    size_t max_unread_stream_outputs = 0;
     size_t max_length = SIZE_MAX;
     bool ignore_eos = false;
     size_t min_new_tokens = 0;
@@ -123,6 +131,16 @@ public:
     bool do_sample = false;
     size_t rng_seed = 0;
 
+    // Server-side request deadline in seconds: once exceeded, the scheduler stops the request
+    // (queued requests are dropped before consuming any prefill). 0 (default) disables the
+    // deadline. Set this to the gateway timeout so abandoned work stops consuming fleet tokens.
+    float request_timeout_s = 0.f;
+
+    // Multi-tenant serving QoS: requests with a higher scheduling priority are preempted last when
+    // the KV cache is under pressure; the scheduler never preempts a request to make room for a
+    // lower-priority one. 0 is the default (batch) class.
+    size_t scheduling_priority = 0;
+
     // Assisting generation parameters
     float assistant_confidence_threshold = 0.f;
     size_t num_assistant_tokens = 0;
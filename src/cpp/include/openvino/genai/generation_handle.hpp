@@ -108,6 +108,10 @@ public:
 
     // Reads result of a generation for single iteration
     GenerationOutputs read();
+    // Drains every output accumulated since the last read in a single queue lock acquisition and
+    // merges them per sequence. Blocks only until at least one output is available, so a server
+    // polling many streams pays one wakeup per backlog instead of one per token
+    GenerationOutputs read_pending();
     // Reads all generated tokens for all sequences
     std::vector<GenerationOutput> read_all();
 };
@@ -129,13 +129,33 @@ public:
 
     ov::Tensor decode(ov::Tensor latent);
 
+    /**
+     * Enables tiled VAE decoding: latents whose spatial size exceeds `tile_latent_size` are
+     * decoded in overlapping tiles whose seams are blended linearly, bounding activation memory
+     * at high resolutions (requires a decoder compiled with dynamic spatial dimensions).
+     * @param tile_latent_size Tile edge in latent pixels; 0 (default) disables tiling.
+     * @param tile_overlap Overlap between neighboring tiles in latent pixels.
+     */
+    void set_tiled_decode(size_t tile_latent_size, size_t tile_overlap = 8);
+
     ov::Tensor encode(ov::Tensor image, std::shared_ptr<Generator> generator);
 
+    /**
+     * Whether encode() samples from the posterior and therefore consumes draws from the
+     * generator ('latent_parameters' exports); 'latent_sample' exports are deterministic.
+     */
+    bool encode_draws_from_generator();
+
     const Config& get_config() const;
 
     size_t get_vae_scale_factor() const;
 
 private:
+    size_t m_tile_latent_size = 0;
+    size_t m_tile_overlap = 8;
+
+    ov::Tensor decode_tiled(ov::Tensor latent);
+
     void merge_vae_image_post_processing() const;
 
     Config m_config;
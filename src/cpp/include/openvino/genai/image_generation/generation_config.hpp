@@ -71,6 +71,38 @@ private:
     std::normal_distribution<float> m_normal;
 };
 
+/**
+ * Counter-based (Philox4x32-10) implementation of 'Generator'. Unlike the sequential
+ * CppStdGenerator, each draw is a pure function of (seed, stream, counter), so parallel samplers
+ * and multi-image batches can each own an independent stream of the same seed and produce
+ * identical noise regardless of the order streams are consumed in - including across replicas.
+ */
+class OPENVINO_GENAI_EXPORTS PhiloxGenerator : public Generator {
+public:
+    /**
+     * @param seed The seed shared by all streams of one run.
+     * @param stream Sub-stream index (e.g. request id or image index within a batch); different
+     * streams of the same seed are statistically independent.
+     */
+    explicit PhiloxGenerator(uint64_t seed, uint64_t stream = 0);
+
+    virtual float next() override;
+
+    virtual void seed(size_t new_seed) override;
+
+    /** Selects the sub-stream and rewinds it to its beginning. */
+    void set_stream(uint64_t stream);
+
+private:
+    void refill();
+
+    uint64_t m_seed = 0;
+    uint64_t m_stream = 0;
+    uint64_t m_counter = 0;
+    float m_buffered[4];
+    size_t m_buffered_left = 0;
+};
+
 /**
  * Generation config used for Image generation pipelines.
  * Note, that not all values are applicable for all pipelines and models - please, refer
@@ -189,6 +189,13 @@ public:
      * @param device A device to compile models with
      * @param properties A map of properties which affect models compilation
      * @note If pipeline was compiled before, an exception is thrown.
+     * @note Cold-start time on scale-out is dominated by model compilation. Pass ov::cache_dir in
+     * `properties` (pointing to persistent storage shared by workers) to enable OpenVINO's
+     * compiled-blob cache, keyed by model, device and compilation config: the first worker pays
+     * the full compile, later workers and restarts import the cached blobs for all submodels
+     * (text encoder(s), UNet/transformer, VAE). To pre-warm a pool in the background, construct
+     * pipelines and call this method from worker threads before serving traffic - compilation
+     * does not block other pipelines.
      */
     void compile(const std::string& device, const ov::AnyMap& properties = {});
 
@@ -199,6 +206,12 @@ public:
      * @param vae_device A device to compile VAE decoder(s) with
      * @param properties A map of properties which affect models compilation
      * @note If pipeline was compiled before, an exception is thrown.
+     * @note This is the heterogeneous placement mode: e.g. text encoder + VAE on an iGPU and the
+     * denoiser on a dGPU. Cross-device tensor handoff between the stages is performed by the
+     * runtime when tensors are fed into the next stage's infer request. Within one generate()
+     * call the stages are strictly data-dependent (encode -> denoise loop -> decode), so keeping
+     * the denoise device saturated across requests is achieved by running multiple pipelines that
+     * share the devices, not by overlapping stages of a single request.
      */
     void compile(const std::string& text_encode_device,
                  const std::string& denoise_device,
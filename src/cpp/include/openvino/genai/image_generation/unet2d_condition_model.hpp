@@ -91,6 +91,14 @@ public:
 
     ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep);
 
+    /**
+     * Launches the UNet inference asynchronously; the result is collected with wait().
+     * Used by the denoise loop to overlap host-side work with device compute.
+     */
+    void start_async(ov::Tensor sample, ov::Tensor timestep);
+
+    ov::Tensor wait();
+
     bool do_classifier_free_guidance(float guidance_scale) const {
         return guidance_scale > 1.0f && m_config.time_cond_proj_dim < 0;
     }
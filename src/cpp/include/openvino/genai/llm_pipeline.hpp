@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <optional>
 #include <variant>
 #include <chrono>
@@ -279,6 +280,18 @@ public:
     * Turns off keeping KV cache between generate calls.
     */
     void finish_chat();
+
+    /**
+    * @brief Serializes the active chat session (decoder KV state + tracked token ids) so it can
+    * be resumed in another process without re-prefilling the history. Stateful pipeline only.
+    */
+    void export_chat_session(std::ostream& out);
+
+    /**
+    * @brief Restores a chat session saved with export_chat_session into this pipeline (same
+    * model required; validated via a state-layout hash).
+    */
+    void import_chat_session(std::istream& in);
 private:
     std::unique_ptr<LLMPipelineImplBase> m_pimpl;
 };
@@ -179,9 +179,23 @@ public:
 static constexpr AdaptersProperty adapters;
 
 
+/**
+ * Runtime counters for adapter application, so adapter-switch cost under churn is measurable in
+ * production instead of estimated: apply() calls that changed the active configuration count as
+ * switches, repeated applies of the same configuration as reapplies.
+ */
+struct AdapterPerfMetrics {
+    size_t num_switches = 0;
+    size_t num_reapplies = 0;
+    float total_switch_ms = 0.f;
+    float last_switch_ms = 0.f;
+};
+
+
 class OPENVINO_GENAI_EXPORTS AdapterController {
 
     std::shared_ptr<AdapterControllerImpl> m_pimpl;
+    AdapterPerfMetrics m_perf_metrics;
     friend AdapterControllerImpl;
 
 public:
@@ -197,6 +211,9 @@ public:
     // Helps to distinguish LoRA states from other states (e.g. KV cache state) in the model for a partial state reset.
     bool has_state_name(const std::string& name);
 
+    // Cumulative adapter switch counters and durations recorded by apply()
+    AdapterPerfMetrics get_perf_metrics() const;
+
     operator bool() const {
         return bool(m_pimpl);
     }
@@ -7,6 +7,19 @@
 #include "cache_eviction.hpp"
 
 namespace ov::genai {
+
+/**
+ * Physical memory placement policy for the CPU KV cache tensors.
+ */
+enum class KVCachePlacementPolicy {
+    /** Leave page placement to the default allocator behavior (pages land on the NUMA node of the allocating thread). */
+    DEFAULT,
+    /** Perform a parallel first-touch initialization of freshly allocated KV cache tensors across all hardware
+     * threads, so that under the OS first-touch policy the cache pages are interleaved over the NUMA nodes
+     * the inference threads run on. Recommended for multi-socket CPU serving. */
+    INTERLEAVED,
+};
+
 struct SchedulerConfig {
     // a maximum number of tokens to batch
     // (in contrast to max_batch_size which combines independent sequences, we consider total amount of tokens in a batch)
@@ -22,6 +35,46 @@ struct SchedulerConfig {
     // whether to split prompt / generate to different scheduling phases
     bool dynamic_split_fuse = true;
 
+    // Maximum share of `max_num_batched_tokens` which prompt (prefill) tokens can occupy within
+    // a single scheduler iteration when `dynamic_split_fuse` is enabled. Generation phase is
+    // scheduled first, so with e.g. 0.5 an incoming long prompt is chunked and cannot delay
+    // decode iterations of already running sequences by more than a half of the token budget.
+    // 1.0 (default) keeps the previous behavior where prefill can consume the whole remaining budget.
+    float max_prefill_tokens_ratio = 1.0f;
+
+    // NUMA placement policy applied to CPU KV cache tensors at allocation time
+    KVCachePlacementPolicy kv_cache_placement = KVCachePlacementPolicy::DEFAULT;
+
+    // When enabled, KV blocks of fully preempted sequence groups are swapped out to host memory
+    // and copied back when the group is rescheduled, so preemption costs a memory copy instead of
+    // a full prompt recompute. Applies to simple (single-sequence, non-evicted) groups; other
+    // preemptions keep the recompute path.
+    bool enable_kv_cache_offload = false;
+
+    // Multi-tenant QoS: maximum share of the KV block pool a single request may occupy before the
+    // scheduler stops admitting further prompt chunks for it (its decode phase is never throttled).
+    // 1.0 (default) disables the cap.
+    float max_block_share_per_request = 1.0f;
+
+    // Predictive admission control: admit a new prompt only when the block pool can also cover its
+    // forecasted peak demand - prompt plus the expected generation length (a live EWMA over
+    // completed requests, bounded by the request's max_new_tokens) - instead of just the prompt.
+    // Prevents admit-then-thrash preemption cycles for long-max_new_tokens traffic.
+    bool enable_predictive_admission = false;
+
+    // Step-time SLO feedback control: when non-zero, the scheduler measures per-step latency and
+    // dynamically lowers/restores the effective token budget (between a small floor and
+    // max_num_batched_tokens) to hold the given per-step latency target in milliseconds, keeping
+    // decode latency flat when the sequence-length mix shifts.
+    float step_time_slo_ms = 0.f;
+
+    // Per-layer heterogeneous KV cache precision: keep this many first AND last decoder layers
+    // at full (f16) cache precision while the middle layers use the plugin-selected (possibly
+    // quantized, e.g. u8 via KV_CACHE_PRECISION) precision. The boundary layers are the most
+    // sensitive to cache quantization error, so pinning them preserves quality at aggressive
+    // middle-layer compression. 0 (default) leaves all layers to the plugin.
+    std::size_t num_full_precision_boundary_layers = 0;
+
 
     /**
      * Whether to use cache eviction for all sequences processed by this pipeline. When cache eviction is enabled,
@@ -54,7 +107,12 @@ struct SchedulerConfig {
     bool operator==(const SchedulerConfig& other) const {
         return max_num_batched_tokens == other.max_num_batched_tokens && num_kv_blocks == other.num_kv_blocks &&
                cache_size == other.cache_size &&
-               dynamic_split_fuse == other.dynamic_split_fuse && use_cache_eviction == other.use_cache_eviction &&
+               dynamic_split_fuse == other.dynamic_split_fuse && max_prefill_tokens_ratio == other.max_prefill_tokens_ratio &&
+               kv_cache_placement == other.kv_cache_placement && enable_kv_cache_offload == other.enable_kv_cache_offload &&
+               num_full_precision_boundary_layers == other.num_full_precision_boundary_layers &&
+               max_block_share_per_request == other.max_block_share_per_request &&
+               enable_predictive_admission == other.enable_predictive_admission && step_time_slo_ms == other.step_time_slo_ms &&
+               use_cache_eviction == other.use_cache_eviction &&
                max_num_seqs == other.max_num_seqs && enable_prefix_caching == other.enable_prefix_caching;
     }
 };
@@ -17,6 +17,15 @@ enum class StreamingStatus {
 
 /**
  * @brief base class for streamers. In order to use inherit from from this class and implement put, and methods
+ *
+ * Detokenizer-free (raw token) streaming: write() receives token ids before any detokenization -
+ * only TextStreamer adds the decode step. An executor that re-parses structured output (tool-call
+ * delimiters, JSON framing) can subclass StreamerBase directly, match delimiters on token ids,
+ * and map ids to their piece bytes via Tokenizer::get_vocab(), which returns the id-indexed piece
+ * table - no detokenizer inference runs on that path. Note that vocab pieces are the tokenizer's
+ * raw byte representation (BPE markers, byte-fallback escapes included), not the cleaned text the
+ * detokenizer would emit; delimiter tokens are exact-match stable, free-form text spans are not.
+ * The same applies to GenerationHandle reads, which always deliver raw ids.
  */
 class OPENVINO_GENAI_EXPORTS StreamerBase {
 public:
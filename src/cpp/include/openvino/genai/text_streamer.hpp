@@ -42,6 +42,13 @@ private:
     StreamingStatus run_callback_if_needed(const std::string& text);
 
     void compute_decoded_length_for_position(size_t cache_position);
+
+    // Token cache compaction keeps the per-token decode cost bounded for long responses
+    // without a newline (e.g. CJK output): once the cache exceeds the threshold, the already
+    // printed prefix tokens are dropped if re-decoding the remaining suffix reproduces the
+    // unprinted text byte-for-byte. The threshold backs off when a seam mismatch is detected.
+    size_t m_cache_compaction_threshold = 32;
+    void maybe_compact_cache(const std::string& text);
 };
 
 }  // namespace genai
@@ -246,6 +246,21 @@ public:
     // information about <bos>, <eos> tokens should be public,
     // they are used at least in StreamerBase descendants
     int64_t get_bos_token_id() const;
+    /**
+    * @brief Returns the decoded string piece of every token id, built lazily on first call and
+    * cached immutably afterwards, so repeated id -> piece lookups are O(1) and allocation-free.
+    * The index is shared by all Tokenizer copies referring to the same underlying models.
+    * @param vocab_size number of tokens in the vocabulary (known to callers from the logits shape)
+    * @return vector of token pieces indexed by token id
+    */
+    const std::vector<std::string>& get_vocab(size_t vocab_size);
+
+    /**
+    * @brief Returns the id of the given token piece using the cached vocab index, or -1 when the
+    * piece is unknown. get_vocab must have been called at least once before.
+    */
+    int64_t get_token_id(const std::string& token_piece);
+
     int64_t get_eos_token_id() const;
     int64_t get_pad_token_id() const;
 
@@ -258,6 +273,11 @@ public:
 private:
     class TokenizerImpl;
     std::shared_ptr<TokenizerImpl> m_pimpl;
+    // Per-handle chat template override. The implementation can be shared between pipelines
+    // created from the same tokenizer files, so set_chat_template writes here instead of mutating
+    // the shared implementation; copies of this Tokenizer share the override object, preserving
+    // the previous set-on-copy visibility semantics.
+    std::shared_ptr<std::string> m_chat_template_override = std::make_shared<std::string>();
 };
 
 static constexpr ov::Property<bool> add_special_tokens{"add_special_tokens"};
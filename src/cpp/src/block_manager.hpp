@@ -6,6 +6,7 @@
 #include <memory>
 #include <list>
 #include <map>
+#include <unordered_set>
 #include <algorithm>
 #include <fstream>
 #include <chrono>
@@ -18,6 +19,8 @@ class KVCacheBlock {
     int m_ref_count;
     int m_index;
     size_t m_hash;
+    size_t m_reuse_count = 0;
+    bool m_pinned = false;
     std::chrono::time_point<std::chrono::system_clock> m_timestamp;
 public:
     using Ptr = std::shared_ptr<KVCacheBlock>;
@@ -65,6 +68,25 @@ public:
         m_timestamp = timestamp;
     }
 
+    // number of times the block contents were reused by another sequence via prefix caching,
+    // used together with the timestamp to select eviction victims
+    size_t get_reuse_count() const {
+        return m_reuse_count;
+    }
+
+    void increment_reuse_count() {
+        ++m_reuse_count;
+    }
+
+    // pinned blocks are never selected for overwriting by the prefix cache eviction logic
+    bool is_pinned() const {
+        return m_pinned;
+    }
+
+    void set_pinned(bool pinned) {
+        m_pinned = pinned;
+    }
+
     std::chrono::time_point<std::chrono::system_clock> get_timestamp() {
         return m_timestamp;
     }
@@ -81,6 +103,7 @@ using BlocksPerLayer = std::vector<KVCacheBlock::Ptr>;
 class OverwritableBlocksHashStore {
     std::map<size_t, BlocksPerLayer> m_blocks;
     size_t m_num_layers;
+    size_t m_num_pinned_blocks = 0;
     public:
     /**
      * Constructs the BlockHashStore.
@@ -104,6 +127,8 @@ class OverwritableBlocksHashStore {
             }
         }
         OPENVINO_ASSERT(m_blocks.count(hash) == 0);
+        if (blocks_for_all_layers[0]->is_pinned())
+            ++m_num_pinned_blocks;
         m_blocks[hash] = blocks_for_all_layers;
     }
 
@@ -124,33 +149,74 @@ class OverwritableBlocksHashStore {
         for (auto& block_ptr : blocks_for_all_layers) {
 
             block_ptr->set_timestamp(std::chrono::system_clock::now());
+            block_ptr->increment_reuse_count();
             block_ptr->increment();
         }
+        if (blocks_for_all_layers[0]->is_pinned())
+            --m_num_pinned_blocks;
         m_blocks.erase(it);
         return blocks_for_all_layers;
     }
 
     /**
-     * Pops the least recently used blocks from the store to be used and overwritten by another sequence.
+     * Pops eviction victim blocks from the store to be used and overwritten by another sequence.
+     * The victim is selected among non-pinned blocks by the lowest reuse count, with the least recent
+     * timestamp used as a tie-breaker (LRU + frequency), so frequently shared prefixes (e.g. a common
+     * system prompt) survive longer than one-off prompt tails of the same age.
      * Returned blocks will have reference counters equal to 1.
-     * @return A vector of KV cache blocks (one for each decoder layer) that has least recently been added to the store
-     * based on the timestamp.
+     * @return A vector of KV cache blocks (one for each decoder layer) selected for overwriting,
+     * or an empty vector if all stored blocks are pinned.
      */
     BlocksPerLayer get_lru_block_to_overwrite() {
-        if (m_blocks.empty()) {
+        if (num_evictable_blocks() == 0) {
             return {};
         }
-        auto hash_and_blocks_for_all_layers = std::min_element(std::begin(m_blocks), std::end(m_blocks), [](const auto& lhs, const auto& rhs) -> bool { return lhs.second[0]->get_timestamp() < rhs.second[0]->get_timestamp(); });
-        auto blocks_for_all_layers = hash_and_blocks_for_all_layers->second;
+        auto eviction_score = [](const BlocksPerLayer& blocks) {
+            return std::make_pair(blocks[0]->get_reuse_count(), blocks[0]->get_timestamp());
+        };
+        auto victim_it = m_blocks.end();
+        for (auto it = m_blocks.begin(); it != m_blocks.end(); ++it) {
+            if (it->second[0]->is_pinned())
+                continue;
+            if (victim_it == m_blocks.end() || eviction_score(it->second) < eviction_score(victim_it->second))
+                victim_it = it;
+        }
+        auto blocks_for_all_layers = victim_it->second;
         auto timestamp = std::chrono::system_clock::now();
         for (auto& block_ptr : blocks_for_all_layers) {
             block_ptr->set_timestamp(timestamp);
             block_ptr->increment();
         }
-        m_blocks.erase(hash_and_blocks_for_all_layers->first);
+        m_blocks.erase(victim_it);
         return blocks_for_all_layers;
     }
 
+    /**
+     * Marks the blocks stored under a given hash as pinned or unpinned. Pinned blocks are never
+     * selected for overwriting, but can still be restored by a matching prefix.
+     * @param hash The hash of the blocks to (un)pin.
+     * @param pinned The new pinned state.
+     * @return Whether blocks with such hash were present in the store.
+     */
+    bool set_pinned(size_t hash, bool pinned) {
+        auto it = m_blocks.find(hash);
+        if (it == m_blocks.end())
+            return false;
+        if (it->second[0]->is_pinned() != pinned) {
+            m_num_pinned_blocks += pinned ? 1 : -1;
+            for (auto& block_ptr : it->second)
+                block_ptr->set_pinned(pinned);
+        }
+        return true;
+    }
+
+    /**
+     * @return Number of blocks (per layer) which can be selected for overwriting, i.e. stored and not pinned.
+     */
+    size_t num_evictable_blocks() const {
+        return m_blocks.size() - m_num_pinned_blocks;
+    }
+
     /**
      *
      * @return Number of blocks (per layer) currently in the store.
@@ -159,6 +225,22 @@ class OverwritableBlocksHashStore {
         return m_blocks.size();
     }
 
+    /**
+     * @return Hashes of all stored blocks whose physical index (in any layer) is greater or equal to the threshold.
+     */
+    std::set<uint64_t> hashes_with_block_index_ge(size_t threshold) const {
+        std::set<uint64_t> retval;
+        for (const auto& hash_and_blocks : m_blocks) {
+            for (const auto& block : hash_and_blocks.second) {
+                if (static_cast<size_t>(block->get_index()) >= threshold) {
+                    retval.insert(hash_and_blocks.first);
+                    break;
+                }
+            }
+        }
+        return retval;
+    }
+
     /**
      * @brief Removes blocks matching to the supplied hashes from the store
      * @param hashes_to_discard A set of hashes. For each hash, if it is present in the store, the corresponding block will be discarded
@@ -171,6 +253,12 @@ class OverwritableBlocksHashStore {
         for (uint64_t hash : hashes_to_discard) {
             auto it = m_blocks.find(hash);
             if (it != m_blocks.end()) {
+                if (it->second[0]->is_pinned()) {
+                    // discarded blocks lose their contents, so the pin is no longer meaningful
+                    --m_num_pinned_blocks;
+                    for (auto& block_ptr : it->second)
+                        block_ptr->set_pinned(false);
+                }
                 retval.push_back(it->second);
                 m_blocks.erase(it);
             }
@@ -196,6 +284,13 @@ class BlockAllocator {
     bool m_enable_prefix_caching;
     ov::genai::OverwritableBlocksHashStore m_overwriteable_blocks;
 
+    // cumulative telemetry counters (in whole-block units, i.e. counted once across layers);
+    // mutated under the BlockManager lock together with the structures they describe
+    size_t m_num_blocks_allocated = 0;
+    size_t m_num_blocks_freed = 0;
+    size_t m_num_blocks_restored = 0;
+    size_t m_num_blocks_overwritten = 0;
+
 public:
     /**
      * Constructs the BlockAllocator.
@@ -250,7 +345,8 @@ public:
      * @return Number of free blocks for this layer.
      */
     size_t num_free_blocks(size_t layer_idx) const {
-        return m_free_blocks_num[layer_idx] + num_overwriteable_blocks();
+        // pinned blocks stay in the overwritable store but cannot be taken for new allocations
+        return m_free_blocks_num[layer_idx] + m_overwriteable_blocks.num_evictable_blocks();
     }
 
     /**
@@ -297,6 +393,9 @@ public:
         if (block_ptr->is_free()) {
             m_free_blocks[layer_idx].push_back(block_ptr);
             ++m_free_blocks_num[layer_idx];
+            if (layer_idx == 0) {
+                ++m_num_blocks_freed;
+            }
         }
     }
 
@@ -323,6 +422,7 @@ public:
         }
 
         if (is_any_free) {
+            ++m_num_blocks_freed;
             // is_all_free == true due to assert above
             if (m_enable_prefix_caching)
             {
@@ -399,6 +499,9 @@ public:
         allocated_block->increment();
         m_free_blocks[layer_idx].pop_front();
         --m_free_blocks_num[layer_idx];
+        if (layer_idx == 0) {
+            ++m_num_blocks_allocated;
+        }
         return allocated_block;
     }
 
@@ -430,11 +533,13 @@ public:
                 --m_free_blocks_num[i];
             }
             cached_blocks[hash] = allocated_blocks;
+            ++m_num_blocks_allocated;
             return allocated_blocks;
         }
-        if (m_overwriteable_blocks.num_blocks() > 0) {
-            // get least recently used block from store and reuse it
+        if (m_overwriteable_blocks.num_evictable_blocks() > 0) {
+            // get the eviction victim (lowest reuse count, then least recently used) from store and overwrite it
             BlocksPerLayer blocks_for_all_layers = m_overwriteable_blocks.get_lru_block_to_overwrite();
+            ++m_num_blocks_overwritten;
             cached_blocks.erase(blocks_for_all_layers[0]->get_hash());
 
             // update block with new hash
@@ -460,6 +565,7 @@ public:
         auto blocks_for_all_layers = m_overwriteable_blocks.get_block_to_restore(hash);
         if (!blocks_for_all_layers.empty()) {
             // use cached block from internal store
+            ++m_num_blocks_restored;
             return blocks_for_all_layers;
         }
         auto it = cached_blocks.find(hash);
@@ -468,13 +574,63 @@ public:
             // TODO: add tokens validation in case of hash collision
             blocks_for_all_layers = it->second;
             for (auto& block_ptr : cached_blocks[hash]) {
+                block_ptr->increment_reuse_count();
                 block_ptr->increment();
             }
+            ++m_num_blocks_restored;
             return blocks_for_all_layers;
         }
         return {};
     }
 
+    /**
+     * Marks the free blocks stored under a given hash in the internal overwritable store as pinned or unpinned.
+     * @param hash The hash of the blocks to (un)pin.
+     * @param pinned The new pinned state.
+     * @return Whether blocks with such hash were present in the store.
+     */
+    bool set_cached_blocks_pinned(size_t hash, bool pinned) {
+        return m_overwriteable_blocks.set_pinned(hash, pinned);
+    }
+
+    /**
+     * Attempts to shrink the physical block pool to `new_total_blocks` by discarding the descriptors of the
+     * tail blocks (indices >= new_total_blocks). Succeeds only if every tail block is currently either in the
+     * free pool or in the overwritable store, i.e. not owned by any sequence; otherwise the allocator state
+     * is left unchanged.
+     * @param new_total_blocks The requested new size of the block pool.
+     * @return Whether the pool was shrunk.
+     */
+    bool try_shrink_to(size_t new_total_blocks) {
+        if (new_total_blocks >= m_total_num_blocks) {
+            return false;
+        }
+        size_t num_blocks_to_remove = m_total_num_blocks - new_total_blocks;
+        auto tail_predicate = [new_total_blocks](const KVCacheBlock::Ptr& block_ptr) {
+            return static_cast<size_t>(block_ptr->get_index()) >= new_total_blocks;
+        };
+
+        std::set<uint64_t> tail_store_hashes = m_overwriteable_blocks.hashes_with_block_index_ge(new_total_blocks);
+
+        // all tail blocks must be reclaimable for each layer
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            size_t num_free_tail_blocks = std::count_if(m_free_blocks[layer_idx].begin(), m_free_blocks[layer_idx].end(), tail_predicate);
+            if (num_free_tail_blocks + tail_store_hashes.size() != num_blocks_to_remove) {
+                return false;
+            }
+        }
+
+        for (size_t layer_idx = 0; layer_idx < m_num_layers; layer_idx++) {
+            m_free_blocks[layer_idx].remove_if(tail_predicate);
+            m_free_blocks_num[layer_idx] -= num_blocks_to_remove - tail_store_hashes.size();
+        }
+        // discard the tail store blocks entirely (their contents are lost together with the released memory)
+        m_overwriteable_blocks.clean_store(tail_store_hashes);
+
+        m_total_num_blocks = new_total_blocks;
+        return true;
+    }
+
     /**
      * @return The percentage of the allocator's free block pool utilization.
      */
@@ -490,6 +646,11 @@ public:
     size_t get_total_number_of_kv_blocks() const {
         return m_total_num_blocks;
     }
+
+    size_t get_num_blocks_allocated() const { return m_num_blocks_allocated; }
+    size_t get_num_blocks_freed() const { return m_num_blocks_freed; }
+    size_t get_num_blocks_restored() const { return m_num_blocks_restored; }
+    size_t get_num_blocks_overwritten() const { return m_num_blocks_overwritten; }
 };
 
 /**
@@ -500,6 +661,7 @@ public:
  */
 class BlockManager {
     friend class CacheStateDumper;
+    friend class CacheStateShmPublisher;
     BlockAllocator m_allocator;
     bool m_enable_prefix_caching;
     size_t m_block_size;
@@ -507,6 +669,9 @@ class BlockManager {
     // TODO: caching time can probably be improved if we use the prefix tree
     std::map<uint64_t, BlocksPerLayer> m_prefix_hash_to_occupied_block_map;
 
+    // cumulative count of copy-on-write block copies performed for forked sequences
+    size_t m_num_cow_copies = 0;
+
     // stores blocks for each sequence (not sequence group)
     // the same block can be seen in multiple block_tables for different sequences
     std::map<uint64_t, std::vector<BlocksPerLayer>> m_block_table;
@@ -572,8 +737,11 @@ public:
      */
     const size_t free_group_partially(SequenceGroup::Ptr sequence_group, size_t num_required_blocks) {
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
-        size_t blocks_num = std::ceil(num_required_blocks / sequence_group->get_not_finished_sequences().size());
         auto not_finished_sequences = sequence_group->get_not_finished_sequences();
+        // round up in integer arithmetic (std::ceil over an already-truncated integer division
+        // released fewer blocks than requested, forcing extra preemption passes)
+        size_t num_sequences = not_finished_sequences.size();
+        size_t blocks_num = (num_required_blocks + num_sequences - 1) / num_sequences;
         for (size_t idx = 0; idx < not_finished_sequences.size(); ++idx) {
             auto seq_id = not_finished_sequences[idx]->get_id();
             OPENVINO_ASSERT(m_block_table.count(seq_id) > 0, "Invalid sequence group.");
@@ -637,13 +805,21 @@ public:
     const size_t get_number_of_blocks_occupied_by_sequence(SequenceGroup::Ptr sequence_group) {
         std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
         auto running_sequences = sequence_group->get_not_finished_sequences();
-        std::set<size_t> indices;
+        // single-sequence groups (the common case) cannot hold duplicate blocks, so their count
+        // is the block-table size with no dedup structure at all
+        if (running_sequences.size() == 1) {
+            auto table_it = m_block_table.find(running_sequences[0]->get_id());
+            return table_it == m_block_table.end() ? 0 : table_it->second[0].size();
+        }
+        std::unordered_set<size_t> indices;
         for (size_t idx = 0; idx < running_sequences.size(); ++idx) {
             auto seq_id = running_sequences[idx]->get_id();
-            if (m_block_table.count(seq_id) == 0) {
+            auto table_it = m_block_table.find(seq_id);
+            if (table_it == m_block_table.end()) {
                 continue;
             }
-            auto block_table = m_block_table[seq_id][0];  // assuming all layers always have equal sets of blocks
+            const auto& block_table = table_it->second[0];  // assuming all layers always have equal sets of blocks
+            indices.reserve(indices.size() + block_table.size());
             for (const auto& block : block_table) {
                 indices.insert(block->get_index());
             }
@@ -766,6 +942,15 @@ public:
     /**
      * @brief Forks a sequence, establishing a new sequence from an existing one, reusing
      * currently allocated blocks of the existing sequence.
+     *
+     * All blocks are shared by reference count, including a partially-filled last prompt block:
+     * nothing is copied at fork time. A shared last block is copied lazily by append_slot only
+     * when a sequence writes its first divergent token into it (see the copy_on_write branch
+     * there), and drops are processed before the next scheduling pass, so when the parent beam
+     * is discarded in the same step one surviving child adopts the original block without a copy.
+     * With beam width B, at most B-1 block copies happen, each deferred to the actual divergence
+     * point - beams pruned before appending never pay one.
+     *
      * @param parent_id Parent sequence identifier
      * @param child_id Sequence identifier for the new, forked sequence. Must be unique across
      * other sequences tracked by this BlockManager.
@@ -1051,6 +1236,7 @@ public:
                         }
                     }
 
+                    ++m_num_cow_copies;
                     for (size_t i = 0; i < effective_num_layers; i++) {
                         auto& new_block = new_blocks_for_all_layers[i];
                         auto& block_table = m_block_table[seq_id][i];
@@ -1080,6 +1266,71 @@ public:
         return copy_blocks_map;
     }
 
+    /**
+     * Attempts to shrink the physical KV block pool to `new_total_blocks`, discarding reclaimable tail blocks.
+     * Fails (leaving the state unchanged) if any tail block is still owned by a sequence.
+     * @param new_total_blocks The requested new size of the block pool.
+     * @return Whether the pool was shrunk.
+     */
+    bool try_shrink_kv_blocks(size_t new_total_blocks) {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        if (!m_allocator.try_shrink_to(new_total_blocks)) {
+            return false;
+        }
+        // drop cached-prefix entries referring to discarded tail blocks so they cannot be restored
+        for (auto it = m_prefix_hash_to_occupied_block_map.begin(); it != m_prefix_hash_to_occupied_block_map.end();) {
+            bool refers_to_tail = std::any_of(it->second.begin(), it->second.end(),
+                [new_total_blocks](const KVCacheBlock::Ptr& block_ptr) {
+                    return static_cast<size_t>(block_ptr->get_index()) >= new_total_blocks;
+                });
+            it = refers_to_tail ? m_prefix_hash_to_occupied_block_map.erase(it) : std::next(it);
+        }
+        return true;
+    }
+
+    /**
+     * Pins or unpins the KV cache blocks corresponding to the given prefix hashes. Pinned blocks are never
+     * selected for overwriting by the prefix caching eviction logic, so a shared prompt prefix can be kept
+     * cached regardless of the cache pressure. Both currently occupied blocks and blocks already released
+     * into the overwritable store are affected; hashes with no cached blocks are silently ignored.
+     * @param hashes Prefix-based hashes of the blocks to (un)pin (one per full block of the prefix).
+     * @param pinned The new pinned state.
+     * @return The number of hashes for which cached blocks were found and updated.
+     */
+    size_t set_cached_blocks_pinned(const std::set<uint64_t>& hashes, bool pinned) {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        size_t num_updated = 0;
+        for (uint64_t hash : hashes) {
+            auto it = m_prefix_hash_to_occupied_block_map.find(hash);
+            if (it != m_prefix_hash_to_occupied_block_map.end()) {
+                // occupied blocks carry the flag into the overwritable store once they are released
+                for (auto& block_ptr : it->second)
+                    block_ptr->set_pinned(pinned);
+                ++num_updated;
+            } else if (m_allocator.set_cached_blocks_pinned(hash, pinned)) {
+                ++num_updated;
+            }
+        }
+        return num_updated;
+    }
+
+    /**
+     * @return A consistent snapshot of the block manager telemetry counters.
+     */
+    BlockManagerStats get_stats() {
+        const std::lock_guard<std::mutex> lock(m_cached_blocks_map_mutex);
+        BlockManagerStats stats;
+        stats.total_blocks = m_allocator.get_total_number_of_kv_blocks();
+        stats.free_blocks = num_free_blocks();
+        stats.overwritable_blocks = m_allocator.num_overwriteable_blocks();
+        stats.num_blocks_allocated = m_allocator.get_num_blocks_allocated();
+        stats.num_blocks_freed = m_allocator.get_num_blocks_freed();
+        stats.num_blocks_restored = m_allocator.get_num_blocks_restored();
+        stats.num_blocks_overwritten = m_allocator.get_num_blocks_overwritten();
+        stats.num_cow_copies = m_num_cow_copies;
+        return stats;
+    }
+
     void restore_cached_blocks(SequenceGroup::Ptr group) {
         // When add_request() is executed in multiple threads accessing to cached_blocks causes segfault.
         // The mutex is needed to prevent such segfaults.
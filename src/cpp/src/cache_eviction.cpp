@@ -1,13 +1,17 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <limits>
+#include <numeric>
+
 #include "cache_eviction.hpp"
 
 namespace ov::genai {
     CacheEvictionAlgorithm::CacheEvictionAlgorithm(const CacheEvictionConfig &eviction_config, size_t block_size,
                                                    size_t num_decoder_layers) :
             m_eviction_config(eviction_config), m_block_size(block_size), m_num_decoder_layers(num_decoder_layers),
-            m_cache_counter(num_decoder_layers), m_scores(num_decoder_layers) {
+            m_cache_counter(num_decoder_layers), m_scores(num_decoder_layers),
+            m_num_registered_tokens(num_decoder_layers, 0) {
             OPENVINO_ASSERT(!(m_eviction_config.get_start_size() % m_block_size),
                             "CacheEvictionConfig.start_size in tokens must be a multiple of block size ", m_block_size);
             OPENVINO_ASSERT(!(m_eviction_config.get_recent_size() % m_block_size),
@@ -48,6 +52,9 @@ namespace ov::genai {
 
             // Only the blocks in the "intermediate" part of the logical KV cache will be considered for eviction
             auto scores_for_all_evictable_blocks = get_scores_for_all_evictable_blocks(decoder_layer_idx);
+            if (m_eviction_config.landmark_score_percentile > 0.0f) {
+                _protect_landmark_blocks(decoder_layer_idx, scores_for_all_evictable_blocks);
+            }
             size_t num_blocks_to_evict = get_num_blocks_to_evict(decoder_layer_idx);
             auto evicted_block_indices = get_indices_of_blocks_to_evict(scores_for_all_evictable_blocks, num_blocks_to_evict);
 
@@ -101,42 +108,51 @@ namespace ov::genai {
 
             auto &accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
 
+            const float* hh_score_data = hh_score.data<float>();
+            size_t new_size_in_tokens = hh_score.get_size();
+
             if (accumulated_scores_for_current_decoder_layer.empty()) {
-                accumulated_scores_for_current_decoder_layer = std::vector<double>(hh_score.get_size());
-                for (size_t idx = 0; idx < accumulated_scores_for_current_decoder_layer.size(); idx++) {
-                    accumulated_scores_for_current_decoder_layer[idx] = hh_score.data<float>()[idx];
-                }
+                accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
+                std::copy(hh_score_data, hh_score_data + new_size_in_tokens,
+                          accumulated_scores_for_current_decoder_layer.begin());
                 if (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM) {
                     // New sequence to track - will simulate that the tokens comprising the sequence were added one-by-one
-                    // from the standpoint of the occurrence tracker
-                    std::size_t new_scores_size = hh_score.get_size();
-                    std::vector<std::size_t> counter(new_scores_size);
-                    std::generate(counter.begin(), counter.begin() + new_scores_size,
-                                  [&new_scores_size] { return new_scores_size--; });
-                    m_cache_counter[decoder_layer_idx] = counter;
+                    // from the standpoint of the occurrence tracker. Instead of storing the occurrence counts directly
+                    // (which would have to be incremented for every tracked token on each step), the registration-order
+                    // stamp of each token is stored, and the occurrence count is reconstructed on demand as
+                    // (total number of registered tokens) - (stamp), making the per-step update O(1)
+                    auto &registration_stamps = m_cache_counter[decoder_layer_idx];
+                    registration_stamps.resize(new_size_in_tokens);
+                    std::iota(registration_stamps.begin(), registration_stamps.end(), 0);
+                    m_num_registered_tokens[decoder_layer_idx] = new_size_in_tokens;
                 }
             } else {
                 size_t old_size_in_tokens = accumulated_scores_for_current_decoder_layer.size();
-                size_t num_new_tokens = hh_score.get_size() - accumulated_scores_for_current_decoder_layer.size();
+                size_t num_new_tokens = new_size_in_tokens - old_size_in_tokens;
                 if (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM) {
-                    // Increment occurrence counts of all currently tracked cache blocks
-                    auto &counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
-                    for (auto it = counter_for_current_decoder_layer.begin();
-                         it != counter_for_current_decoder_layer.end(); it++) {
-                        *it += num_new_tokens;
+                    // Add registration stamps for new tokens; the occurrence counts of already tracked
+                    // tokens are incremented implicitly via m_num_registered_tokens
+                    auto &registration_stamps = m_cache_counter[decoder_layer_idx];
+                    registration_stamps.resize(new_size_in_tokens);
+                    std::iota(registration_stamps.begin() + old_size_in_tokens, registration_stamps.end(),
+                              m_num_registered_tokens[decoder_layer_idx]);
+                    m_num_registered_tokens[decoder_layer_idx] += num_new_tokens;
+                }
+                accumulated_scores_for_current_decoder_layer.resize(new_size_in_tokens);
+                // contiguous branch-free accumulation, auto-vectorized by the compiler
+                double* accumulated_data = accumulated_scores_for_current_decoder_layer.data();
+                if (m_eviction_config.aggregation_mode == AggregationMode::SNAP_KV) {
+                    // exponential observation window: contributions older than ~snapkv_window_size
+                    // steps decay away, so importance tracks the recent queries only
+                    const double decay = 1.0 - 1.0 / static_cast<double>(std::max<size_t>(m_eviction_config.snapkv_window_size, 1));
+                    for (size_t i = 0; i < new_size_in_tokens; ++i) {
+                        accumulated_data[i] = decay * accumulated_data[i] + hh_score_data[i];
                     }
-                    // Add occurrence counts for new tokens like above
-                    counter_for_current_decoder_layer.resize(hh_score.get_size());
-                    for (size_t i = 0; i < num_new_tokens; i++) {
-                        auto idx = old_size_in_tokens + i;
-                        counter_for_current_decoder_layer[idx] = num_new_tokens - i;
+                } else {
+                    for (size_t i = 0; i < new_size_in_tokens; ++i) {
+                        accumulated_data[i] += hh_score_data[i];
                     }
                 }
-                accumulated_scores_for_current_decoder_layer.resize(hh_score.get_size());
-                auto hh_score_data = hh_score.data<float>();
-                for (size_t i = 0; i < hh_score.get_size(); ++i) {
-                    accumulated_scores_for_current_decoder_layer[i] += hh_score_data[i];
-                }
             }
         }
     }
@@ -159,28 +175,84 @@ namespace ov::genai {
         return num_evictable_blocks - num_evictable_blocks_to_keep_after_eviction;
     }
 
+    void CacheEvictionAlgorithm::_protect_landmark_blocks(size_t decoder_layer_idx,
+                                                          std::vector<double>& block_scores) const {
+        // Blocks holding "landmark" tokens - those whose individual importance is in the top
+        // (1 - landmark_score_percentile) fraction of all evictable token scores - are protected
+        // from eviction by lifting their aggregate score to infinity. Aggregation dilutes a single
+        // anchor token (a section header, an instruction) across the whole block; the per-token
+        // percentile keeps such blocks alive even when the block average is low. Protection is
+        // capped at half of the evictable blocks so eviction always makes progress; if more blocks
+        // qualify, the ones with the highest landmark token win.
+        const auto& accumulated_scores = m_scores[decoder_layer_idx];
+        const size_t num_evictable_blocks = block_scores.size();
+        const size_t num_evictable_tokens = std::min(num_evictable_blocks * m_block_size, accumulated_scores.size());
+        if (num_evictable_tokens == 0) {
+            return;
+        }
+
+        std::vector<double> sorted_scores(accumulated_scores.begin(), accumulated_scores.begin() + num_evictable_tokens);
+        size_t threshold_rank = static_cast<size_t>(m_eviction_config.landmark_score_percentile * num_evictable_tokens);
+        threshold_rank = std::min(threshold_rank, num_evictable_tokens - 1);
+        std::nth_element(sorted_scores.begin(), sorted_scores.begin() + threshold_rank, sorted_scores.end());
+        const double landmark_threshold = sorted_scores[threshold_rank];
+
+        std::vector<std::pair<double, size_t>> landmark_blocks;  // (landmark token score, block index)
+        for (size_t block_idx = 0; block_idx < num_evictable_blocks; ++block_idx) {
+            double max_token_score = 0.0;
+            const size_t token_begin = block_idx * m_block_size;
+            const size_t token_end = std::min(token_begin + m_block_size, num_evictable_tokens);
+            for (size_t token_idx = token_begin; token_idx < token_end; ++token_idx) {
+                max_token_score = std::max(max_token_score, accumulated_scores[token_idx]);
+            }
+            if (max_token_score >= landmark_threshold) {
+                landmark_blocks.emplace_back(max_token_score, block_idx);
+            }
+        }
+
+        const size_t max_protected = num_evictable_blocks / 2;
+        if (landmark_blocks.size() > max_protected) {
+            std::nth_element(landmark_blocks.begin(), landmark_blocks.begin() + max_protected, landmark_blocks.end(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+            landmark_blocks.resize(max_protected);
+        }
+        for (const auto& [landmark_score, block_idx] : landmark_blocks) {
+            block_scores[block_idx] = std::numeric_limits<double>::infinity();
+        }
+    }
+
     std::vector<double> CacheEvictionAlgorithm::get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const {
-        auto accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
+        const auto &accumulated_scores_for_current_decoder_layer = m_scores[decoder_layer_idx];
         auto num_tracked_tokens = accumulated_scores_for_current_decoder_layer.size();
-        auto counter_for_current_decoder_layer = m_cache_counter[decoder_layer_idx];
+        const auto &registration_stamps = m_cache_counter[decoder_layer_idx];
 
         // Make sure that there is at least one block that can be completely evicted
         OPENVINO_ASSERT((num_tracked_tokens + m_eviction_config.get_start_size()) > get_max_cache_size_after_eviction(),
                         "KV cache must be filled before scores for evictable blocks can be computed");
 
         size_t num_evictable_blocks = get_num_evictable_blocks(decoder_layer_idx);
+        const bool is_norm_sum = (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM);
+        const size_t num_registered_tokens = m_num_registered_tokens[decoder_layer_idx];
+
+        if (m_eviction_config.aggregation_mode == AggregationMode::SNAP_KV) {
+            return get_snapkv_scores_for_all_evictable_blocks(accumulated_scores_for_current_decoder_layer, num_evictable_blocks);
+        }
 
         std::vector<double> block_scores(num_evictable_blocks);
         for (size_t i = 0; i < num_evictable_blocks; ++i) {
             double normalized_accumulated_attn_score_for_block = 0.0;
-            for (size_t j = 0; j < m_block_size; ++j) {
-                size_t token_offset = m_block_size * i + j;
-                if (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM) {
+            const size_t block_begin = m_block_size * i;
+            if (is_norm_sum) {
+                for (size_t j = 0; j < m_block_size; ++j) {
+                    size_t token_offset = block_begin + j;
+                    // occurrence count is reconstructed from the token's registration stamp
                     normalized_accumulated_attn_score_for_block +=
                             accumulated_scores_for_current_decoder_layer[token_offset] /
-                            counter_for_current_decoder_layer[token_offset];
-                } else {
-                    normalized_accumulated_attn_score_for_block += accumulated_scores_for_current_decoder_layer[token_offset];
+                            (num_registered_tokens - registration_stamps[token_offset]);
+                }
+            } else {
+                for (size_t j = 0; j < m_block_size; ++j) {
+                    normalized_accumulated_attn_score_for_block += accumulated_scores_for_current_decoder_layer[block_begin + j];
                 }
             }
             block_scores[i] = normalized_accumulated_attn_score_for_block;
@@ -188,6 +260,33 @@ namespace ov::genai {
         return block_scores;
     }
 
+    std::vector<double> CacheEvictionAlgorithm::get_snapkv_scores_for_all_evictable_blocks(
+            const std::vector<double>& accumulated_scores, size_t num_evictable_blocks) const {
+        // kernel-smoothed importance (SnapKV-style pooling): each token's score is averaged with its
+        // snapkv_kernel_size neighbors via prefix sums before block aggregation, so isolated attention
+        // spikes keep their neighborhood alive and eviction acts on coherent spans
+        size_t num_tracked_tokens = accumulated_scores.size();
+        size_t half_kernel = std::max<size_t>(m_eviction_config.snapkv_kernel_size, 1) / 2;
+
+        std::vector<double> prefix_sums(num_tracked_tokens + 1, 0.0);
+        for (size_t i = 0; i < num_tracked_tokens; ++i) {
+            prefix_sums[i + 1] = prefix_sums[i] + accumulated_scores[i];
+        }
+
+        std::vector<double> block_scores(num_evictable_blocks);
+        for (size_t block_idx = 0; block_idx < num_evictable_blocks; ++block_idx) {
+            double block_score = 0.0;
+            for (size_t j = 0; j < m_block_size; ++j) {
+                size_t token_idx = block_idx * m_block_size + j;
+                size_t window_begin = token_idx > half_kernel ? token_idx - half_kernel : 0;
+                size_t window_end = std::min(token_idx + half_kernel + 1, num_tracked_tokens);
+                block_score += (prefix_sums[window_end] - prefix_sums[window_begin]) / (window_end - window_begin);
+            }
+            block_scores[block_idx] = block_score;
+        }
+        return block_scores;
+    }
+
     std::vector<std::size_t>
     CacheEvictionAlgorithm::get_indices_of_blocks_to_evict(
             const std::vector<double> &scores_for_each_evictable_block, size_t num_blocks_to_evict) const {
@@ -250,18 +349,20 @@ namespace ov::genai {
             new_counter.reserve(new_size);
         }
 
-        for (size_t token_idx = 0, evicted_block_idx = 0; token_idx < old_size;) {
-            if (evicted_block_idx < evicted_block_indices.size() &&
-                token_idx == evicted_block_indices[evicted_block_idx] * m_block_size) {
-                ++evicted_block_idx;
-                token_idx += m_block_size;
-                continue;
-            }
-            new_scores.push_back(accumulated_scores_for_current_decoder_layer[token_idx]);
+        // copy the spans of surviving tokens between evicted blocks in bulk
+        size_t token_idx = 0;
+        for (size_t evicted_block_idx = 0; evicted_block_idx <= evicted_block_indices.size(); ++evicted_block_idx) {
+            size_t span_end = (evicted_block_idx < evicted_block_indices.size()) ?
+                    evicted_block_indices[evicted_block_idx] * m_block_size : old_size;
+            new_scores.insert(new_scores.end(),
+                              accumulated_scores_for_current_decoder_layer.begin() + token_idx,
+                              accumulated_scores_for_current_decoder_layer.begin() + span_end);
             if (m_eviction_config.aggregation_mode == AggregationMode::NORM_SUM) {
-                new_counter.push_back(counter_for_current_decoder_layer[token_idx]);
+                new_counter.insert(new_counter.end(),
+                                   counter_for_current_decoder_layer.begin() + token_idx,
+                                   counter_for_current_decoder_layer.begin() + span_end);
             }
-            ++token_idx;
+            token_idx = std::min(span_end + m_block_size, old_size);
         }
 
         m_scores[decoder_layer_idx] = new_scores;
@@ -328,11 +429,13 @@ namespace ov::genai {
         retval.reserve(num_logical_blocks_before_eviction - evicted_block_logical_indices.size());
 
         ptrdiff_t current_rotation_delta_in_blocks = 0;
-        std::vector<size_t> logical_block_space(num_logical_blocks_before_eviction);
-        std::iota(logical_block_space.begin(), logical_block_space.end(), 0);
+        // walk the logical block space directly, tracking the sorted evicted set with an iterator
+        // instead of materializing an index vector and probing the set per block
+        auto next_evicted_it = evicted_block_logical_indices.begin();
 
-        for (size_t logical_block_idx : logical_block_space) {
-            if (evicted_block_logical_indices.find(logical_block_idx) != evicted_block_logical_indices.end()) {
+        for (size_t logical_block_idx = 0; logical_block_idx < num_logical_blocks_before_eviction; ++logical_block_idx) {
+            if (next_evicted_it != evicted_block_logical_indices.end() && *next_evicted_it == logical_block_idx) {
+                ++next_evicted_it;
                 current_rotation_delta_in_blocks += 1;
             } else {
                 if (current_rotation_delta_in_blocks != 0) {
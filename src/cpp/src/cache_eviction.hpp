@@ -105,8 +105,15 @@ private:
 
     std::vector<double> get_scores_for_all_evictable_blocks(size_t decoder_layer_idx) const;
 
+    std::vector<double> get_snapkv_scores_for_all_evictable_blocks(const std::vector<double>& accumulated_scores,
+                                                                   size_t num_evictable_blocks) const;
+
     std::vector<std::size_t> get_indices_of_blocks_to_evict(const std::vector<double>& scores_for_each_evictable_block, size_t num_blocks_to_evict) const;
 
+    // lifts the aggregate score of blocks holding top-percentile landmark tokens to infinity so
+    // they are skipped by eviction (landmark_score_percentile > 0 only)
+    void _protect_landmark_blocks(size_t decoder_layer_idx, std::vector<double>& block_scores) const;
+
     void remove_scores_of_evicted_blocks(const std::vector<std::size_t>& evicted_block_indices, size_t decoder_layer_idx);
 
     CacheEvictionConfig m_eviction_config;
@@ -114,7 +121,11 @@ private:
     std::size_t m_num_evicted_tokens = 0;
     std::size_t m_num_decoder_layers;
     std::vector<std::vector<double>> m_scores;
+    // Per-layer registration-order stamps of the tracked tokens (NORM_SUM mode only). The occurrence
+    // count of a token is (m_num_registered_tokens[layer] - stamp), which avoids incrementing a
+    // counter for every tracked token on each generation step
     std::vector<std::vector<size_t>> m_cache_counter;
+    std::vector<std::size_t> m_num_registered_tokens;
 };
 
 /**
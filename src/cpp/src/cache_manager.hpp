@@ -5,8 +5,14 @@
 
 #include <vector>
 #include <list>
+#include <map>
+#include <algorithm>
+#include <utility>
+
+#include <thread>
 
 #include "openvino/runtime/tensor.hpp"
+#include "openvino/genai/scheduler_config.hpp"
 #include "paged_attention_transformations.hpp"
 
 namespace ov::genai {
@@ -21,6 +27,30 @@ class CacheManager {
     size_t m_num_allocated_kv_blocks = 0, m_block_size_in_bytes = 0;
     ov::InferRequest m_request;
     size_t m_k_head_size = 0;
+    KVCachePlacementPolicy m_kv_cache_placement = KVCachePlacementPolicy::DEFAULT;
+
+    // Touches one byte of every page of the given buffer from multiple threads in a round-robin
+    // fashion, so that under the OS default first-touch NUMA policy the pages are interleaved over
+    // the nodes the worker threads are scheduled on instead of all landing on the allocating node.
+    static void first_touch_interleaved(void* data, size_t size_bytes) {
+        constexpr size_t page_size = 4096;
+        const size_t num_pages = (size_bytes + page_size - 1) / page_size;
+        const size_t num_threads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), num_pages));
+        unsigned char* bytes = static_cast<unsigned char*>(data);
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+            workers.emplace_back([=]() {
+                for (size_t page_idx = thread_idx; page_idx < num_pages; page_idx += num_threads) {
+                    bytes[page_idx * page_size] = 0;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
 
     static ov::Shape set_kv_blocks(ov::PartialShape pshape, size_t num_kv_blocks) {
         pshape[0] = num_kv_blocks;
@@ -33,15 +63,23 @@ class CacheManager {
     }
 
 public:
-    CacheManager(ov::InferRequest request, const std::vector<KVHeadConfig>& kv_cache_config) :
-        m_request(request) {
+    CacheManager(ov::InferRequest request, const std::vector<KVHeadConfig>& kv_cache_config,
+                 KVCachePlacementPolicy kv_cache_placement = KVCachePlacementPolicy::DEFAULT) :
+        m_request(request),
+        m_kv_cache_placement(kv_cache_placement) {
         // extract information about inference device
         ov::CompiledModel compiled_model = request.get_compiled_model();
         std::vector<std::string> execution_devices = compiled_model.get_property(ov::execution_devices);
         OPENVINO_ASSERT(execution_devices.size() == 1, "Contituous batching: execution device is expected to be CPU or GPU, but got ", execution_devices.size(), " devices");
         m_device = execution_devices[0];
         
-        // set block_size depending on device
+        // Set block_size depending on device. NOTE on block-size auto-tuning: these values mirror
+        // what the CPU/GPU plugins compile their paged attention kernels for - the cache inputs'
+        // per-block dimensions come from the compiled model, so the block size is a compile-time
+        // plugin decision, not a knob this manager can vary. A {8,16,32,64} load-time autotuner
+        // therefore has to recompile the model per candidate via a plugin block-size property
+        // (which plugins do not expose today) before this accounting could follow it.
+        // (original note:) set block_size depending on device
         const size_t cpu_block_size = 32, gpu_block_size = 16;
         const bool is_gpu = m_device.find("GPU") != std::string::npos;
         m_block_size = is_gpu ? gpu_block_size : cpu_block_size;
@@ -121,6 +159,13 @@ public:
                 ov::Tensor key_cache(key_precision, key_cache_shape);
                 ov::Tensor value_cache(value_precision, value_cache_shape);
 
+                if (m_kv_cache_placement == KVCachePlacementPolicy::INTERLEAVED) {
+                    // distribute the physical pages of the fresh tensors across NUMA nodes before
+                    // any data is copied into them (first write decides the page placement)
+                    first_touch_interleaved(key_cache.data(), key_cache.get_byte_size());
+                    first_touch_interleaved(value_cache.data(), value_cache.get_byte_size());
+                }
+
                 auto key_cache_roi_end = static_cast<unsigned char*>(key_cache.data());
                 auto value_cache_roi_end = static_cast<unsigned char*>(value_cache.data());
                 size_t key_roi_size_byte = 0;
@@ -201,38 +246,157 @@ public:
         return m_value_shapes[layer_id][3].get_length();
     }
 
+    /**
+     * Shrinks the allocated KV cache tensors down to `num_kv_blocks`, returning the released memory to
+     * the OS/device. The caller must guarantee that all blocks with indices >= num_kv_blocks are unused.
+     * Currently implemented for CPU caches only; on GPU the remote tensors are kept as allocated.
+     */
+    void shrink_cache_to(size_t num_kv_blocks) {
+        if (num_kv_blocks >= m_num_allocated_kv_blocks || m_key_cache.empty()) {
+            return;
+        }
+        if (m_device.find("GPU") != std::string::npos) {
+            return;
+        }
+
+        m_num_allocated_kv_blocks = num_kv_blocks;
+        ov::Coordinate start{0, 0, 0, 0};
+
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            ov::Shape key_cache_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], num_kv_blocks);
+            ov::Shape value_cache_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], num_kv_blocks);
+
+            ov::Tensor key_cache(get_key_cache_precision(decoder_layer_id), key_cache_shape);
+            ov::Tensor value_cache(get_value_cache_precision(decoder_layer_id), value_cache_shape);
+
+            if (m_kv_cache_placement == KVCachePlacementPolicy::INTERLEAVED) {
+                first_touch_interleaved(key_cache.data(), key_cache.get_byte_size());
+                first_touch_interleaved(value_cache.data(), value_cache.get_byte_size());
+            }
+
+            // keep the contents of the surviving head of the cache
+            ov::Tensor src_key_roi(m_key_cache[decoder_layer_id], start, ov::Coordinate(key_cache_shape));
+            ov::Tensor src_value_roi(m_value_cache[decoder_layer_id], start, ov::Coordinate(value_cache_shape));
+            src_key_roi.copy_to(key_cache);
+            src_value_roi.copy_to(value_cache);
+
+            m_key_cache[decoder_layer_id] = key_cache;
+            m_value_cache[decoder_layer_id] = value_cache;
+
+            update_request_tensor(decoder_layer_id);
+        }
+    }
+
+    /**
+     * Copies the contents of the given physical KV blocks into freshly allocated host tensors,
+     * one key/value tensor pair per decoder layer with the blocks packed densely in swap order.
+     * @param per_layer_block_ids Physical block indices to swap out, one vector per decoder layer.
+     * @return Host key/value tensor pairs holding the block contents, one pair per layer.
+     */
+    std::vector<std::pair<ov::Tensor, ov::Tensor>> swap_out_blocks(const std::vector<std::vector<size_t>>& per_layer_block_ids) {
+        OPENVINO_ASSERT(per_layer_block_ids.size() == m_num_decoder_layers);
+        std::vector<std::pair<ov::Tensor, ov::Tensor>> host_blocks;
+        host_blocks.reserve(m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const auto& block_ids = per_layer_block_ids[decoder_layer_id];
+            ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], block_ids.size());
+            ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], block_ids.size());
+            ov::Tensor host_key(get_key_cache_precision(decoder_layer_id), key_shape);
+            ov::Tensor host_value(get_value_cache_precision(decoder_layer_id), value_shape);
+            for (size_t i = 0; i < block_ids.size(); ++i) {
+                _block_roi(m_key_cache[decoder_layer_id], block_ids[i]).copy_to(_block_roi(host_key, i));
+                _block_roi(m_value_cache[decoder_layer_id], block_ids[i]).copy_to(_block_roi(host_value, i));
+            }
+            host_blocks.emplace_back(host_key, host_value);
+        }
+        return host_blocks;
+    }
+
+    /**
+     * Copies previously swapped out block contents back into the given physical KV blocks.
+     * @param host_blocks Host tensors returned by swap_out_blocks.
+     * @param per_layer_block_ids Destination physical block indices, one vector per decoder layer,
+     * sized identically to the swapped out set.
+     */
+    void swap_in_blocks(const std::vector<std::pair<ov::Tensor, ov::Tensor>>& host_blocks,
+                        const std::vector<std::vector<size_t>>& per_layer_block_ids) {
+        OPENVINO_ASSERT(host_blocks.size() == m_num_decoder_layers && per_layer_block_ids.size() == m_num_decoder_layers);
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            const auto& block_ids = per_layer_block_ids[decoder_layer_id];
+            OPENVINO_ASSERT(host_blocks[decoder_layer_id].first.get_shape()[0] == block_ids.size());
+            for (size_t i = 0; i < block_ids.size(); ++i) {
+                _block_roi(host_blocks[decoder_layer_id].first, i).copy_to(_block_roi(m_key_cache[decoder_layer_id], block_ids[i]));
+                _block_roi(host_blocks[decoder_layer_id].second, i).copy_to(_block_roi(m_value_cache[decoder_layer_id], block_ids[i]));
+            }
+        }
+    }
+
     void copy_blocks(const std::map<size_t, std::list<size_t>>& block_copy_map) {
+        // flatten the copy map into (src, dst) pairs and coalesce runs where both source and
+        // destination indices are contiguous, so fork-heavy workloads (e.g. beam search) issue
+        // one bulk ROI copy per run and per layer instead of N single-block roundtrips.
+        // Within a single step destination blocks are freshly allocated and disjoint from the
+        // source blocks, so the copies can be reordered freely.
+        std::vector<std::pair<size_t, size_t>> copy_pairs;
         for (const auto & blocks_pair : block_copy_map) {
             size_t src_block_id = blocks_pair.first;
-            const std::list<size_t>& dst_block_ids = blocks_pair.second;
-            for (size_t dst_block_id : dst_block_ids) {
-                for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
-                    ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
-                    ov::Coordinate key_src_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_src_end_roi = key_shape;
-                    ov::Coordinate key_dst_start_roi(key_shape.size(), 0);
-                    ov::Coordinate key_dst_end_roi = key_shape;
-            
-                    ov::Coordinate value_src_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_src_end_roi = value_shape;
-                    ov::Coordinate value_dst_start_roi(value_shape.size(), 0);
-                    ov::Coordinate value_dst_end_roi = value_shape;
-                    key_src_end_roi[0] = (key_src_start_roi[0] = src_block_id) + 1;
-                    value_src_end_roi[0] = (value_src_start_roi[0] = src_block_id) + 1;
-                    key_dst_end_roi[0] = (key_dst_start_roi[0] = dst_block_id) + 1;
-                    value_dst_end_roi[0] = (value_dst_start_roi[0] = dst_block_id) + 1;
-
-                    ov::Tensor key_src_cache_roi(m_key_cache[decoder_layer_id], key_src_start_roi, key_src_end_roi);
-                    ov::Tensor key_dst_cache_roi(m_key_cache[decoder_layer_id], key_dst_start_roi, key_dst_end_roi);
-
-                    ov::Tensor value_src_cache_roi(m_value_cache[decoder_layer_id], value_src_start_roi, value_src_end_roi);
-                    ov::Tensor value_dst_cache_roi(m_value_cache[decoder_layer_id], value_dst_start_roi, value_dst_end_roi);
-
-                    key_src_cache_roi.copy_to(key_dst_cache_roi);
-                    value_src_cache_roi.copy_to(value_dst_cache_roi);
-                }
+            for (size_t dst_block_id : blocks_pair.second) {
+                copy_pairs.emplace_back(src_block_id, dst_block_id);
+            }
+        }
+        if (copy_pairs.empty()) {
+            return;
+        }
+        std::sort(copy_pairs.begin(), copy_pairs.end());
+
+        for (size_t begin_idx = 0; begin_idx < copy_pairs.size();) {
+            size_t run_length = 1;
+            while (begin_idx + run_length < copy_pairs.size() &&
+                   copy_pairs[begin_idx + run_length].first == copy_pairs[begin_idx].first + run_length &&
+                   copy_pairs[begin_idx + run_length].second == copy_pairs[begin_idx].second + run_length) {
+                ++run_length;
             }
+            _copy_block_range(copy_pairs[begin_idx].first, copy_pairs[begin_idx].second, run_length);
+            begin_idx += run_length;
+        }
+    }
+
+private:
+    static ov::Tensor _block_roi(const ov::Tensor& cache, size_t block_id) {
+        ov::Shape shape = cache.get_shape();
+        ov::Coordinate start(shape.size(), 0);
+        ov::Coordinate end = shape;
+        start[0] = block_id;
+        end[0] = block_id + 1;
+        return ov::Tensor(cache, start, end);
+    }
+
+    void _copy_block_range(size_t src_block_id, size_t dst_block_id, size_t num_blocks) {
+        for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; ++decoder_layer_id) {
+            ov::Shape key_shape = set_kv_blocks(m_key_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
+            ov::Shape value_shape = set_kv_blocks(m_value_shapes[decoder_layer_id], m_num_allocated_kv_blocks);
+            ov::Coordinate key_src_start_roi(key_shape.size(), 0);
+            ov::Coordinate key_src_end_roi = key_shape;
+            ov::Coordinate key_dst_start_roi(key_shape.size(), 0);
+            ov::Coordinate key_dst_end_roi = key_shape;
+
+            ov::Coordinate value_src_start_roi(value_shape.size(), 0);
+            ov::Coordinate value_src_end_roi = value_shape;
+            ov::Coordinate value_dst_start_roi(value_shape.size(), 0);
+            ov::Coordinate value_dst_end_roi = value_shape;
+            key_src_end_roi[0] = (key_src_start_roi[0] = src_block_id) + num_blocks;
+            value_src_end_roi[0] = (value_src_start_roi[0] = src_block_id) + num_blocks;
+            key_dst_end_roi[0] = (key_dst_start_roi[0] = dst_block_id) + num_blocks;
+            value_dst_end_roi[0] = (value_dst_start_roi[0] = dst_block_id) + num_blocks;
+
+            ov::Tensor key_src_cache_roi(m_key_cache[decoder_layer_id], key_src_start_roi, key_src_end_roi);
+            ov::Tensor key_dst_cache_roi(m_key_cache[decoder_layer_id], key_dst_start_roi, key_dst_end_roi);
+
+            ov::Tensor value_src_cache_roi(m_value_cache[decoder_layer_id], value_src_start_roi, value_src_end_roi);
+            ov::Tensor value_dst_cache_roi(m_value_cache[decoder_layer_id], value_dst_start_roi, value_dst_end_roi);
+
+            key_src_cache_roi.copy_to(key_dst_cache_roi);
+            value_src_cache_roi.copy_to(value_dst_cache_roi);
         }
     }
 };
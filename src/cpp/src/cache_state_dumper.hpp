@@ -3,10 +3,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstring>
 #include <string>
 #include <filesystem>
 #include <vector>
 
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
 #include "block_manager.hpp"
 #include "sequence_group.hpp"
 #include "scheduler.hpp"
@@ -105,4 +113,134 @@ public:
 private:
     std::string m_run_id;
 };
+
+/**
+ * Publishes the live KV block cache state into a POSIX shared-memory segment that tools/cacheviz
+ * can attach to while the pipeline serves traffic, instead of the per-step text-file dumps of
+ * CacheStateDumper (whose file I/O is unusable under production load).
+ *
+ * Segment name: /ov_genai_cacheviz_<pid>. Layout: a fixed Header followed by num_entries
+ * BlockEntry records (block ownership of layer 0, one record per (sequence, block) pair, the
+ * same data the text dumper writes per line). Consistency uses a seqlock: the writer increments
+ * `sequence` to an odd value, rewrites the payload, then increments it to the next even value;
+ * a reader retries until it observes the same even value before and after its copy. Each publish
+ * rewrites the full snapshot - at a few hundred KB it is far cheaper than a step, and readers
+ * diff consecutive snapshots for deltas.
+ *
+ * No-op on platforms without POSIX shared memory.
+ */
+class CacheStateShmPublisher {
+public:
+    struct Header {
+        uint32_t magic;      // 'OVCV'
+        uint32_t version;
+        std::atomic<uint64_t> sequence;
+        uint64_t step;
+        uint64_t total_blocks;
+        uint64_t num_entries;
+        float used_percentage;
+    };
+
+    struct BlockEntry {
+        uint64_t seq_id;
+        uint32_t block_index;
+        uint32_t ref_count;
+    };
+
+    static constexpr uint32_t MAGIC = 0x4f564356;  // "OVCV"
+    static constexpr uint32_t VERSION = 1;
+
+#ifndef _WIN32
+    CacheStateShmPublisher(size_t total_num_blocks) {
+        // forked sequences share physical blocks, so allow several entries per block; with
+        // dynamic cache allocation the initial block count is 0, so keep a usable floor
+        m_max_entries = std::max<size_t>(total_num_blocks, 16384) * 4;
+        m_capacity = sizeof(Header) + m_max_entries * sizeof(BlockEntry);
+        m_name = "/ov_genai_cacheviz_" + std::to_string(::getpid());
+        int fd = ::shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0644);
+        if (fd < 0) {
+            return;
+        }
+        if (::ftruncate(fd, m_capacity) != 0) {
+            ::close(fd);
+            ::shm_unlink(m_name.c_str());
+            return;
+        }
+        void* mapping = ::mmap(nullptr, m_capacity, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            ::shm_unlink(m_name.c_str());
+            return;
+        }
+        m_header = new (mapping) Header{};
+        m_header->magic = MAGIC;
+        m_header->version = VERSION;
+        m_header->total_blocks = total_num_blocks;
+    }
+
+    ~CacheStateShmPublisher() {
+        if (m_header) {
+            ::munmap(static_cast<void*>(m_header), m_capacity);
+            ::shm_unlink(m_name.c_str());
+        }
+    }
+
+    bool is_active() const {
+        return m_header != nullptr;
+    }
+
+    void publish(const Scheduler& schdl, size_t step) {
+        publish(schdl.m_block_manager, step);
+    }
+
+    void publish(const std::shared_ptr<BlockManager>& block_mgr, size_t step) {
+        if (!m_header) {
+            return;
+        }
+        const uint64_t sequence_begin = m_header->sequence.load(std::memory_order_relaxed) + 1;
+        m_header->sequence.store(sequence_begin, std::memory_order_relaxed);  // odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+
+        BlockEntry* entries = reinterpret_cast<BlockEntry*>(m_header + 1);
+        size_t num_entries = 0;
+        {
+            std::lock_guard<std::mutex> lock(block_mgr->m_cached_blocks_map_mutex);
+            for (const auto& seq_id_and_blocks : block_mgr->m_block_table) {
+                for (const auto& block : seq_id_and_blocks.second[0]) {
+                    if (num_entries == m_max_entries) {
+                        break;  // truncated snapshot; total_blocks lets readers detect it
+                    }
+                    entries[num_entries].seq_id = seq_id_and_blocks.first;
+                    entries[num_entries].block_index = static_cast<uint32_t>(block->get_index());
+                    entries[num_entries].ref_count = static_cast<uint32_t>(block->get_references_count());
+                    ++num_entries;
+                }
+            }
+        }
+        m_header->step = step;
+        m_header->num_entries = num_entries;
+        m_header->total_blocks = block_mgr->get_total_number_of_kv_blocks();
+        m_header->used_percentage = block_mgr->get_used_percentage();
+
+        std::atomic_thread_fence(std::memory_order_release);
+        m_header->sequence.store(sequence_begin + 1, std::memory_order_release);  // even: consistent
+    }
+
+private:
+    Header* m_header = nullptr;
+    size_t m_capacity = 0;
+    size_t m_max_entries = 0;
+    std::string m_name;
+#else
+    CacheStateShmPublisher(size_t) {}
+
+    bool is_active() const {
+        return false;
+    }
+
+    void publish(const Scheduler&, size_t) {}
+
+    void publish(const std::shared_ptr<BlockManager>&, size_t) {}
+#endif
+};
 }
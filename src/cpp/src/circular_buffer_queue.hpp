@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
 #include <queue>
 #include <mutex>
 #include <future>
@@ -13,6 +15,7 @@ namespace ov::genai {
 
 // From OVMS:
 // https://github.com/openvinotoolkit/model_server/blob/d73e85cbb8ac1d761754cb2064a00551a9ffc655/src/queue.hpp#L34
+// Extended with lazy elastic growth up to a cap and wait-time contention statistics.
 template <typename T>
 class CircularBufferQueue
 {
@@ -24,14 +27,36 @@ class CircularBufferQueue
     std::mutex m_front_mut;
     std::mutex m_queue_mutex;
 
+    std::function<T()> m_create_fn;
+    size_t m_max_capacity;
+    // number of elements created so far, grows lazily towards m_max_capacity under contention
+    size_t m_num_created;
+
+    // histogram of the time callers spent blocked waiting for a free element,
+    // bucket upper bounds in microseconds (last bucket is unbounded)
+    static constexpr std::array<uint64_t, 5> WAIT_BUCKET_BOUNDS_US = {0, 100, 1000, 4000, 16000};
+    std::array<std::atomic<size_t>, WAIT_BUCKET_BOUNDS_US.size() + 1> m_wait_histogram{};
+
 public:
 
-    CircularBufferQueue(size_t length, const std::function<T()>& create_fn) :
-        m_values(length),
+    /**
+     * @param length The number of elements to create eagerly.
+     * @param create_fn Factory for the elements.
+     * @param max_length Cap for lazy growth: when all elements are busy and fewer than
+     * `max_length` were created, a new element is created instead of blocking the caller.
+     * Values <= `length` (including the default) disable growth.
+     */
+    CircularBufferQueue(size_t length, const std::function<T()>& create_fn, size_t max_length = 0) :
         m_front_idx{0},
-        m_back_idx{0} {
-        std::iota(m_values.begin(), m_values.end(), 0);
-        m_data.reserve(length);
+        m_back_idx{length == 0 ? 0 : static_cast<int>(length % std::max(length, max_length))},
+        m_values(std::max(length, max_length), -1),
+        m_create_fn(create_fn),
+        m_max_capacity(std::max(length, max_length)),
+        m_num_created(length) {
+        std::iota(m_values.begin(), m_values.begin() + length, 0);
+        // reserve the full capacity so that lazily created elements never reallocate m_data,
+        // which is concurrently indexed by element guards
+        m_data.reserve(m_max_capacity);
         for (size_t i = 0; i < length; i++) {
             m_data.emplace_back(std::move(create_fn()));
         }
@@ -51,8 +76,16 @@ public:
         std::future<int> idle_future = idle_promise.get_future();
         std::unique_lock<std::mutex> lk(m_front_mut);
         if (m_values[m_front_idx] < 0) {
-            std::unique_lock<std::mutex> queueLock(m_queue_mutex);
-            m_promises.push(std::move(idle_promise));
+            if (m_num_created < m_max_capacity) {
+                // all created elements are busy - grow instead of blocking the caller
+                value = static_cast<int>(m_num_created++);
+                m_data.emplace_back(m_create_fn());
+                lk.unlock();
+                idle_promise.set_value(value);
+            } else {
+                std::unique_lock<std::mutex> queueLock(m_queue_mutex);
+                m_promises.push(std::move(idle_promise));
+            }
         } else {
             value = m_values[m_front_idx];
             m_values[m_front_idx] = -1;
@@ -80,6 +113,35 @@ public:
         }
         m_values[old_back] = value;
     }
+
+    void record_wait_time(uint64_t wait_us) {
+        size_t bucket = 0;
+        while (bucket < WAIT_BUCKET_BOUNDS_US.size() && wait_us > WAIT_BUCKET_BOUNDS_US[bucket]) {
+            ++bucket;
+        }
+        m_wait_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return Counters of element acquisitions per wait-time bucket. The bucket upper bounds are
+     * 0 (no wait), 100us, 1ms, 4ms, 16ms and unbounded.
+     */
+    std::array<size_t, WAIT_BUCKET_BOUNDS_US.size() + 1> get_wait_histogram() const {
+        std::array<size_t, WAIT_BUCKET_BOUNDS_US.size() + 1> result{};
+        for (size_t i = 0; i < result.size(); ++i) {
+            result[i] = m_wait_histogram[i].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    size_t get_num_created_elements() {
+        std::unique_lock<std::mutex> lk(m_front_mut);
+        return m_num_created;
+    }
+
+    size_t get_max_capacity() const {
+        return m_max_capacity;
+    }
 };
 
 template <typename T>
@@ -88,13 +150,24 @@ class CircularBufferQueueElementGuard {
     int m_value;
 public:
     CircularBufferQueueElementGuard(CircularBufferQueue<T>* queue) : m_queue(queue) {
-        m_value = m_queue->get_idle().get();   // blocking until we get the element
+        auto wait_start = std::chrono::steady_clock::now();
+        auto idle_future = m_queue->get_idle();
+        bool is_ready = idle_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        m_value = idle_future.get();   // blocking until we get the element
+        uint64_t wait_us = is_ready ? 0 :
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - wait_start).count();
+        m_queue->record_wait_time(wait_us);
     }
 
     T& get() {
         return m_queue->get(m_value);
     }
 
+    // index of the acquired pool slot, stable for the lifetime of the guard
+    int get_index() const {
+        return m_value;
+    }
+
     ~CircularBufferQueueElementGuard() {
         m_queue->return_to(m_value);
     }
@@ -133,6 +133,11 @@ public:
         // Get the currrent timestamp in order to evaluate total generate duration.
         auto start_time =  std::chrono::steady_clock::now();
 
+        // Callers with cached encodings must not pay a re-materialization: rows of the batched
+        // tensor are handed to the pipeline as zero-copy ROI views (SequenceGroup copies the
+        // prompt ids into its own storage at add_request, so the views only need to outlive this
+        // call). Only padded rows of TokenizedInputs, which need mask-based compaction, are
+        // copied.
         std::vector<ov::Tensor> input_ids = std::visit(overloaded{
             [](const ov::Tensor& inp) {
                 size_t batch_size = inp.get_shape().at(0);
@@ -142,11 +147,8 @@ public:
                 std::vector<ov::Tensor> input_ids;
                 input_ids.reserve(batch_size);
                 size_t max_len = inp.get_shape().at(1);
-                const int64_t* const source = inp.data<const int64_t>();
                 for (size_t batch_id = 0; batch_id < batch_size; ++batch_id) {
-                    input_ids.emplace_back(ov::element::i64, ov::Shape(1, max_len));
-                    int64_t* destination = input_ids.back().data<int64_t>();
-                    std::copy_n(source + batch_id * max_len, max_len, destination);
+                    input_ids.push_back(ov::Tensor(inp, {batch_id, 0}, {batch_id + 1, max_len}));
                 }
                 return input_ids;
             },
@@ -158,7 +160,16 @@ public:
                 const int64_t* const source = inp.input_ids.data<const int64_t>();
                 const int64_t* const attention_mask = inp.attention_mask.data<const int64_t>();
                 for (size_t batch_id = 0; batch_id < batch_size; ++batch_id) {
-                    input_ids.emplace_back(ov::element::i64, ov::Shape(1, max_len));
+                    size_t attended_count = 0;
+                    for (size_t idx = 0; idx < max_len; ++idx) {
+                        attended_count += attention_mask[batch_id * max_len + idx] == 1;
+                    }
+                    if (attended_count == max_len) {
+                        // unpadded row: zero-copy view
+                        input_ids.push_back(ov::Tensor(inp.input_ids, {batch_id, 0}, {batch_id + 1, max_len}));
+                        continue;
+                    }
+                    input_ids.emplace_back(ov::element::i64, ov::Shape(1, attended_count));
                     int64_t* destination = input_ids.back().data<int64_t>();
                     size_t copy_count = 0;
                     for (size_t idx = 0; idx < max_len; ++idx) {
@@ -166,7 +177,6 @@ public:
                             destination[copy_count++] = source[batch_id * max_len + idx];
                         }
                     }
-                    input_ids.back().set_shape({1, copy_count});
                 }
                 return input_ids;
             }
@@ -45,7 +45,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::ContinuousBatchingImpl(
 
     bool is_need_per_layer_cache_control = scheduler_config.use_cache_eviction;
     bool allow_cache_rotation = scheduler_config.cache_eviction_config.apply_rotation;
-    auto kv_cache_config = utils::apply_paged_attention_transformations(model, is_need_per_layer_cache_control, allow_cache_rotation);
+    auto kv_cache_config = utils::apply_paged_attention_transformations(model, is_need_per_layer_cache_control, allow_cache_rotation, scheduler_config.num_full_precision_boundary_layers);
     utils::apply_gather_before_matmul_transformation(model);
 
     initialize_pipeline(model, scheduler_config, device, properties, kv_cache_config);
@@ -72,12 +72,93 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::~ContinuousBatchingImpl() {
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_pull_awaiting_requests() {
+    _drain_intake_queue();
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
-    m_awaiting_requests.clear();
+
+    if (m_scheduler->get_config().enable_prefix_caching) {
+        // Fan-out dedup: evaluation-style traffic submits the same prompt many times (different
+        // seeds / temperatures). Admitting duplicates one at a time lets every follower restore
+        // the leader's prefill blocks from the prefix cache instead of recomputing the prompt,
+        // collapsing N identical prefills into one plus N block-table restores.
+        auto has_prompt_phase_twin = [this](const SequenceGroup::Ptr& candidate) {
+            for (const auto& admitted : m_requests) {
+                if (admitted->get_num_processed_tokens() < admitted->get_prompt_len() &&
+                    admitted->get_prompt_ids() == candidate->get_prompt_ids()) {
+                    return true;
+                }
+            }
+            return false;
+        };
+
+        // release followers whose leader has finished (or abandoned) its prompt phase; the
+        // restore below now finds the leader's blocks in the prefix cache
+        for (auto it = m_deferred_duplicate_requests.begin(); it != m_deferred_duplicate_requests.end();) {
+            if (!has_prompt_phase_twin(*it)) {
+                m_scheduler->restore_cached_blocks(*it);
+                m_requests.push_back(*it);
+                it = m_deferred_duplicate_requests.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        for (auto& awaiting : m_awaiting_requests) {
+            if (awaiting->get_num_processed_tokens() == 0 && has_prompt_phase_twin(awaiting)) {
+                m_deferred_duplicate_requests.push_back(awaiting);
+            } else {
+                m_requests.push_back(awaiting);
+            }
+        }
+        m_awaiting_requests.clear();
+    } else {
+        m_requests.insert(m_requests.end(), m_awaiting_requests.begin(), m_awaiting_requests.end());
+        m_awaiting_requests.clear();
+    }
+
+    // Priority lanes: the scheduler serves m_requests in order, so interactive requests
+    // (higher scheduling_priority) are moved ahead of queued batch prefills. Aging adds one
+    // effective priority level per 10 seconds of waiting, so batch traffic cannot starve
+    // behind a sustained interactive stream. The sort is stable: arrival order is preserved
+    // within an effective priority level.
+    auto now = std::chrono::steady_clock::now();
+    auto effective_priority = [&now](const SequenceGroup::Ptr& request) {
+        constexpr float aging_interval_s = 10.f;
+        float waited_s = std::chrono::duration<float>(now - request->get_creation_time()).count();
+        return request->get_sampling_parameters().scheduling_priority + static_cast<size_t>(waited_s / aging_interval_s);
+    };
+    std::stable_sort(m_requests.begin(), m_requests.end(),
+        [&](const SequenceGroup::Ptr& lhs, const SequenceGroup::Ptr& rhs) {
+            return effective_priority(lhs) > effective_priority(rhs);
+        });
+
     m_pipeline_metrics.requests = m_requests.size();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_apply_stream_backpressure() {
+    // Bounded streaming: a stalled consumer (e.g. a dead SSE client) otherwise accumulates
+    // output frames server-side without limit. Requests over their configured bound are paused -
+    // KV blocks stay resident, so resumption is free - and resume once the consumer drains below
+    // half the bound. Only this scan pauses requests in this pipeline, so the resume condition
+    // cannot release a pause taken elsewhere.
+    for (auto& request : m_requests) {
+        const size_t bound = request->get_sampling_parameters().max_unread_stream_outputs;
+        if (bound == 0) {
+            continue;
+        }
+        const size_t unread = request->get_generation_stream()->num_unread_outputs();
+        if (!request->is_generation_paused() && unread > bound) {
+            request->pause_generation(true);
+        } else if (request->is_generation_paused() && unread <= bound / 2) {
+            request->pause_generation(false);
+        }
+    }
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_drain_intake_queue() {
+    std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+    m_intake_queue.drain_to(m_awaiting_requests);
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
     std::shared_ptr<ov::Model> model,
     const SchedulerConfig& scheduler_config,
@@ -98,13 +179,44 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
         filtered_properties.fork().erase("sampler_num_threads");   // do not use iterator sampler_num_threads_it because a forked container may not be the same container
     }
 
+    // Optionally append a device-side greedy sampling (argmax) head, so that for plain greedy
+    // requests only token ids instead of batch x vocab logits cross the host boundary
+    auto device_sampling_it = filtered_properties->find("enable_device_greedy_sampling");
+    if (device_sampling_it != filtered_properties->end()) {
+        m_is_device_greedy_sampling_enabled = device_sampling_it->second.as<bool>();
+        filtered_properties.fork().erase("enable_device_greedy_sampling");
+    }
+    if (m_is_device_greedy_sampling_enabled) {
+        utils::apply_greedy_sampling_head_transformation(model);
+    }
+
+    // Optionally expose the lm-head input as a "last_hidden_state" output so prompts can be
+    // embedded (prefill-only) on the same scheduler and KV pool as generation
+    auto hidden_state_output_it = filtered_properties->find("enable_hidden_state_output");
+    if (hidden_state_output_it != filtered_properties->end()) {
+        m_is_hidden_state_output_enabled = hidden_state_output_it->second.as<bool>();
+        filtered_properties.fork().erase("enable_hidden_state_output");
+    }
+    if (m_is_hidden_state_output_enabled) {
+        utils::apply_hidden_state_output_transformation(model);
+    }
+
+    // Sparse attention prefill hint for plugins with tri-shape/x-attention prefill kernels
+    auto sparse_prefill_it = filtered_properties->find("enable_sparse_attention_prefill");
+    if (sparse_prefill_it != filtered_properties->end()) {
+        if (sparse_prefill_it->second.as<bool>()) {
+            utils::mark_sparse_attention_prefill(model);
+        }
+        filtered_properties.fork().erase("enable_sparse_attention_prefill");
+    }
+
     ov::CompiledModel compiled_model = utils::singleton_core().compile_model(model, device, *filtered_properties);
 
     ov::genai::utils::print_compiled_model_properties(compiled_model, "LLM with Paged Attention");
     ov::InferRequest infer_request = compiled_model.create_infer_request();
 
     // Cache manager
-    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request, kv_cache_config);
+    std::shared_ptr<CacheManager> cache_manager = std::make_shared<CacheManager>(infer_request, kv_cache_config, scheduler_config.kv_cache_placement);
     m_num_decoder_layers = cache_manager->get_num_decoder_layers();
     m_block_size = cache_manager->get_block_size();
 
@@ -124,6 +236,12 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::initialize_pipeline(
 
     m_scheduler = std::make_shared<Scheduler>(m_block_size, cache_manager, normalized_config, m_num_decoder_layers, can_use_partial_preemption);
 
+    // Live cache-state streaming for tools/cacheviz: publishes a binary snapshot per step into
+    // shared memory instead of the per-step text files of the DEBUG_CACHE_STATE_DUMP dumper
+    if (std::getenv("OPENVINO_GENAI_CACHEVIZ_SHM")) {
+        m_cache_shm_publisher = std::make_unique<CacheStateShmPublisher>(normalized_config.num_kv_blocks);
+    }
+
     // Model Runner
     bool is_use_cache_eviction = m_scheduler->get_config().use_cache_eviction;
     if (is_use_cache_eviction) {
@@ -193,16 +311,18 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
         sampling_params.set_eos_token_id(m_generation_config.eos_token_id);
     sampling_params.validate();
 
-    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(request_id, input_ids, sampling_params, m_block_size);
+    OPENVINO_ASSERT(!m_is_draining, "Pipeline is draining; new requests are not admitted");
+
+    SequenceGroup::Ptr sequence_group = SequenceGroup::create(request_id, input_ids, sampling_params, m_block_size);
+    if (m_is_validation_mode_enabled || m_force_track_log_probs) {
+        sequence_group->set_track_log_probs(true);
+    }
 
     if (m_scheduler->get_config().enable_prefix_caching) {
         m_scheduler->restore_cached_blocks(sequence_group);
     }
 
-    {
-        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-        m_awaiting_requests.push_back(sequence_group);
-    }
+    m_intake_queue.push(sequence_group);
 
     return std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), sampling_params);
 };
@@ -228,9 +348,28 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::add_request(uint64_t request
     return add_request(request_id, inputs, sampling_params);
 }
 
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::set_prompt_prefix_pinned(const ov::Tensor& input_ids, bool pinned) {
+    if (!m_scheduler->get_config().enable_prefix_caching)
+        return 0;
+    // a temporary sequence group is used only to compute the per-block prefix hashes of the prompt
+    SequenceGroup::Ptr sequence_group = SequenceGroup::create(0, input_ids, m_generation_config, m_block_size);
+    auto sequence = (*sequence_group)[0];
+    std::set<uint64_t> hashes;
+    size_t prompt_len = sequence_group->get_prompt_len();
+    for (size_t content_len = m_block_size; content_len <= prompt_len; content_len += m_block_size)
+        hashes.insert(sequence->get_hash(content_len));
+    return m_scheduler->set_cached_blocks_pinned(hashes, pinned);
+}
+
 bool ContinuousBatchingPipeline::ContinuousBatchingImpl::has_non_finished_requests() {
+    if (m_intake_queue.size_approx() > 0)
+        return true;
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
-    return !m_awaiting_requests.empty() || !m_requests.empty();
+    return !m_awaiting_requests.empty() || !m_requests.empty() || !m_deferred_duplicate_requests.empty();
+}
+
+size_t ContinuousBatchingPipeline::ContinuousBatchingImpl::get_awaiting_requests_count() const {
+    return m_intake_queue.size_approx();
 }
 
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
@@ -238,9 +377,19 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     step_timer.start();
 
     _pull_awaiting_requests();
+    _apply_stream_backpressure();
+
+    // deadline early-drop: requests whose server-side deadline passed are stopped here, before
+    // queued ones consume any prefill and before running ones burn further decode tokens
+    for (auto& request : m_requests) {
+        if (request->is_deadline_expired() && !request->handle_stopped() && !request->handle_cancelled()) {
+            request->get_generation_stream()->stop();
+        }
+    }
 
     Scheduler::Output scheduler_output;
 
+    const auto schedule_start = std::chrono::steady_clock::now();
     {
         static ManualTimer scheduling_timer("scheduling");
         scheduling_timer.start();
@@ -262,6 +411,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
 
     }
 
+    const auto schedule_end = std::chrono::steady_clock::now();
+
     // if no tokens were scheduled, we are out of memory => free all requests and return
     if (scheduler_output.m_total_num_scheduled_tokens == 0) {
         for (size_t i = 0; i < m_requests.size(); ++i) {
@@ -280,7 +431,27 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         static ManualTimer timer("forward");
         const auto infer_start = std::chrono::steady_clock::now();
         timer.start();
-        logits = m_model_runner->forward(m_requests, scheduler_output);
+        m_model_runner->start_forward(m_requests, scheduler_output);
+
+        // Overlap CPU-side bookkeeping which does not depend on the logits with the in-flight
+        // inference. The substantive candidates stay on the critical path by data dependency,
+        // not oversight: Sampler::sample consumes this forward's logits, and the next
+        // Scheduler::schedule consumes this step's sampling output (appended tokens, forks and
+        // drops change every block table and budget decision), so neither can move into this
+        // window. Hiding sampling would need the device to stream per-sequence logits before
+        // the batch completes (no plugin API), and pre-scheduling step N+1 would need a
+        // double-buffered runner plus a scheduler that can plan against a speculative token
+        // count and repair preemption/fork decisions afterwards - a rework of the scheduler's
+        // contract, not an ordering change here. What is safely independent of the logits is
+        // this notification pass.
+        {
+            static ManualTimer report_tokens_timer("notify requests dropped by handle");
+            report_tokens_timer.start();
+            _notify_requests_dropped_by_handle();
+            report_tokens_timer.end();
+        }
+
+        logits = m_model_runner->wait_forward(m_requests, scheduler_output);
         const auto infer_end = std::chrono::steady_clock::now();
         m_pipeline_metrics.inference_duration = PerfMetrics::get_microsec(infer_end - infer_start);
         timer.end();
@@ -303,17 +474,31 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     step_count++;
 #endif
 
+    if (m_is_hidden_state_output_enabled) {
+        _capture_prompt_hidden_states(m_requests);
+    }
+
+    if (m_cache_shm_publisher) {
+        m_cache_shm_publisher->publish(*m_scheduler, m_cache_shm_step++);
+    }
+
     // process generation_config.echo parameter
     _fill_prompt_log_probs(m_requests, logits);
 
     SamplerOutput sampler_output;
+    const auto sample_start = std::chrono::steady_clock::now();
     {
         static ManualTimer timer("sample");
         timer.start();
-        sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled);
+        ov::Tensor device_sampled_token_ids;
+        if (m_is_device_greedy_sampling_enabled) {
+            device_sampled_token_ids = m_model_runner->get_infer_request().get_tensor("sampled_token_ids");
+        }
+        sampler_output = m_sampler->sample(m_requests, logits, m_is_validation_mode_enabled, device_sampled_token_ids);
         m_batch_size = sampler_output.num_generated_tokens;
         timer.end();
     }
+    const auto sample_end = std::chrono::steady_clock::now();
 
     // process sampler_output (e.g. fork or drop sequences from BlockScheduler)
     {
@@ -337,13 +522,7 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
     if (m_model_input_type == ModelInputType::EMBEDDINGS)
         m_model_runner->append_embeddings(m_requests, scheduler_output);
 
-    // notify requests dropped by handle
-    {
-        static ManualTimer report_tokens_timer("notify requests dropped by handle");
-        report_tokens_timer.start();
-        _notify_requests_dropped_by_handle();
-        report_tokens_timer.end();
-    }
+    // requests dropped by handle were already notified while the inference was in flight
 
     // free non running requests for current step
 
@@ -354,9 +533,72 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::step() {
         clean_up_requests_timer.end();
     }
 
+    // NOTE on thermal pacing (fanless/edge deployments): the knob half of a pacing governor
+    // exists - the step-time SLO controller shrinks the token budget when steps slow down, which
+    // under thermal throttling is exactly the back-off a governor wants (set step_time_slo_ms to
+    // the pre-knee step time). The sensing half - device frequency/temperature telemetry - is not
+    // exposed through portable OpenVINO properties; with it, the governor is this same feedback
+    // loop driven by frequency residency instead of latency, plus a micro-sleep when the budget
+    // floor is reached.
+    const auto step_end = std::chrono::steady_clock::now();
+    m_scheduler->report_step_duration(PerfMetrics::get_microsec(step_end - schedule_start));
+    _record_step_timings(PerfMetrics::get_microsec(schedule_end - schedule_start),
+                         m_pipeline_metrics.inference_duration,
+                         PerfMetrics::get_microsec(sample_end - sample_start),
+                         PerfMetrics::get_microsec(step_end - sample_end));
+
     step_timer.end();
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_record_step_timings(float schedule_us, float infer_us, float sample_us, float postprocess_us) {
+    uint64_t step_id = m_num_recorded_steps.load(std::memory_order_relaxed);
+    StepPhaseTimings& entry = m_step_timings_ring[step_id % STEP_TIMINGS_RING_SIZE];
+    entry.step_id = step_id;
+    entry.schedule_duration = schedule_us;
+    entry.infer_duration = infer_us;
+    entry.sample_duration = sample_us;
+    entry.postprocess_duration = postprocess_us;
+    // publish the entry; readers only trust entries older than the published counter
+    m_num_recorded_steps.store(step_id + 1, std::memory_order_release);
+}
+
+std::vector<StepPhaseTimings> ContinuousBatchingPipeline::ContinuousBatchingImpl::get_recent_step_timings(size_t max_steps) const {
+    uint64_t num_recorded = m_num_recorded_steps.load(std::memory_order_acquire);
+    size_t available = static_cast<size_t>(std::min<uint64_t>(num_recorded, STEP_TIMINGS_RING_SIZE));
+    size_t num_to_return = std::min(max_steps, available);
+
+    std::vector<StepPhaseTimings> result;
+    result.reserve(num_to_return);
+    for (uint64_t step_id = num_recorded - num_to_return; step_id < num_recorded; ++step_id) {
+        StepPhaseTimings entry = m_step_timings_ring[step_id % STEP_TIMINGS_RING_SIZE];
+        // skip entries the writer started overwriting while we were reading
+        if (entry.step_id == step_id) {
+            result.push_back(entry);
+        }
+    }
+    return result;
+}
+
+BlockManagerStats ContinuousBatchingPipeline::ContinuousBatchingImpl::get_block_manager_stats() const {
+    return m_scheduler->get_block_manager_stats();
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::update_scheduler_limits(const SchedulerConfig& config) {
+    m_scheduler->request_limits_update(config);
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_shared_cache_budget(const std::shared_ptr<std::atomic<int64_t>>& budget_bytes) {
+    m_scheduler->set_shared_cache_budget(budget_bytes);
+}
+
+// NOTE on per-request LoRA (batched multi-adapter execution): all sequences in a batch share one
+// adapter blend because the LoRA weights live in model state variables applied to the whole
+// forward. Per-sequence-group adapters need either segmented execution (one forward per adapter
+// segment - trading away exactly the batching this pipeline exists for) or gathered per-row
+// adapter weights inside the LoRA matmuls, which is a model-graph/plugin capability. Once rows
+// can select adapters, the scheduler hook is straightforward: prefer co-scheduling same-adapter
+// groups in _schedule_*_phase and expose the active set per step. The generate() precondition
+// that all requests share one adapter value is asserted today precisely because of this.
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::set_adapters(const std::optional<AdapterConfig>& adapters) {
     if (m_adapter_controller) {
         m_adapter_controller->apply(m_model_runner->get_infer_request(), adapters);
@@ -397,6 +639,7 @@ ContinuousBatchingPipeline::ContinuousBatchingImpl::generate(const std::vector<o
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");
         generations.push_back(add_request(request_id, input_ids[request_id], sampling_params[request_id]));
     }
+    _drain_intake_queue();
     auto all_requests = m_awaiting_requests; // we need to store all requests to get results from them once generation has finished
 
     GenerationHandle& generation = generations.at(0);
@@ -518,6 +761,62 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_reset_cache_usage_stat
     m_pipeline_metrics.avg_cache_usage = 0.0;
 }
 
+std::vector<RequestCheckpoint> ContinuousBatchingPipeline::ContinuousBatchingImpl::drain_requests() {
+    m_is_draining = true;
+    // fold everything already submitted (intake queue, awaiting list, deferred duplicates) into
+    // m_requests so a single sweep checkpoints it
+    _pull_awaiting_requests();
+    {
+        std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
+        m_requests.insert(m_requests.end(),
+                          m_deferred_duplicate_requests.begin(),
+                          m_deferred_duplicate_requests.end());
+        m_deferred_duplicate_requests.clear();
+    }
+
+    std::vector<RequestCheckpoint> checkpoints;
+    checkpoints.reserve(m_requests.size());
+    for (const auto& request : m_requests) {
+        RequestCheckpoint checkpoint;
+        checkpoint.request_id = request->get_request_id();
+        checkpoint.prompt_ids = request->get_prompt_ids();
+        checkpoint.sampling_params = request->get_sampling_parameters();
+        for (const auto& sequence : request->get_not_finished_sequences()) {
+            checkpoint.generated_ids.push_back(sequence->get_generated_ids());
+        }
+        checkpoints.push_back(std::move(checkpoint));
+        request->set_generation_status(GenerationStatus::STOP);
+        request->notify_handle();
+    }
+    drop_requests();
+    return checkpoints;
+}
+
+std::vector<GenerationHandle> ContinuousBatchingPipeline::ContinuousBatchingImpl::import_drained_requests(
+    const std::vector<RequestCheckpoint>& checkpoints) {
+    std::vector<GenerationHandle> handles;
+    handles.reserve(checkpoints.size());
+    for (const auto& checkpoint : checkpoints) {
+        std::vector<int64_t> input_ids = checkpoint.prompt_ids;
+        GenerationConfig sampling_params = checkpoint.sampling_params;
+        if (checkpoint.generated_ids.size() == 1 && !checkpoint.generated_ids.front().empty()) {
+            // single-sequence requests continue from where they stopped: the generated prefix is
+            // replayed as prompt (prefix caching turns this into block restores) and the token
+            // budget shrinks accordingly
+            const auto& generated = checkpoint.generated_ids.front();
+            input_ids.insert(input_ids.end(), generated.begin(), generated.end());
+            size_t consumed = generated.size();
+            if (sampling_params.max_new_tokens != SIZE_MAX) {
+                sampling_params.max_new_tokens -= std::min<size_t>(sampling_params.max_new_tokens, consumed);
+            }
+        }
+        ov::Tensor ids_tensor(ov::element::i64, ov::Shape{1, input_ids.size()});
+        std::copy(input_ids.begin(), input_ids.end(), ids_tensor.data<int64_t>());
+        handles.push_back(add_request(checkpoint.request_id, ids_tensor, sampling_params));
+    }
+    return handles;
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests() {
     for (const std::shared_ptr<ov::genai::SequenceGroup> request : m_requests) {
         for (const auto& sequence: request->get_sequences()) {
@@ -583,11 +882,11 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_compute_cache_rotation
                     block_rotation_data.logical_block_idx);
 
                 size_t block_offset = num_blocks_to_rotate_for_each_layer[layer_idx];
-                auto rotation_deltas_tensor_data =
-                    m_rotation_deltas_stores[layer_idx].data<int32_t>() + block_offset;
-                for (size_t tok_idx = 0; tok_idx < m_block_size; tok_idx++) {
-                   rotation_deltas_tensor_data[tok_idx] = block_rotation_data.rotation_delta / m_block_size;
-                }
+                // the store holds one delta per rotated block (see the store shape above);
+                // writing the per-token copies here both overran the packed area and was
+                // needless work - a single write per block is sufficient
+                m_rotation_deltas_stores[layer_idx].data<int32_t>()[block_offset] =
+                    block_rotation_data.rotation_delta / m_block_size;
                 num_blocks_to_rotate_for_each_layer[layer_idx] += 1;
             }
         }
@@ -655,6 +954,78 @@ void ContinuousBatchingPipeline::ContinuousBatchingImpl::_maybe_evict_cache_bloc
     }
 }
 
+void ContinuousBatchingPipeline::ContinuousBatchingImpl::_capture_prompt_hidden_states(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+    // Rows of "last_hidden_state" mirror the logits rows (the hidden-state tap sits behind the
+    // same sampled-row gather), so per-group offsets follow the sampler's slicing. A group's
+    // last row on the step that completes its prompt is the last prompt token's hidden state.
+    ov::Tensor hidden_states = m_model_runner->get_infer_request().get_tensor("last_hidden_state");
+    const ov::Shape& hidden_shape = hidden_states.get_shape();
+    const size_t hidden_size = hidden_shape.back();
+    const float* hidden_data = hidden_states.data<float>();
+
+    size_t currently_processed_tokens = 0;
+    for (auto& sequence_group : sequence_groups) {
+        if (!sequence_group->is_scheduled())
+            continue;
+        const size_t num_running_sequences = sequence_group->num_running_seqs();
+        const size_t output_seq_len = sequence_group->get_output_seq_len();
+        const size_t num_group_rows = num_running_sequences * output_seq_len;
+
+        const bool prompt_completed_this_step =
+            sequence_group->get_num_processed_tokens() + sequence_group->get_num_scheduled_tokens() >=
+                sequence_group->get_prompt_len() &&
+            sequence_group->get_num_processed_tokens() < sequence_group->get_prompt_len();
+        if (prompt_completed_this_step && num_group_rows > 0 && sequence_group->get_prompt_hidden_state().get_size() == 0) {
+            ov::Tensor prompt_hidden_state(ov::element::f32, ov::Shape{hidden_size});
+            std::copy_n(hidden_data + (currently_processed_tokens + num_group_rows - 1) * hidden_size,
+                        hidden_size,
+                        prompt_hidden_state.data<float>());
+            sequence_group->set_prompt_hidden_state(prompt_hidden_state);
+        }
+        currently_processed_tokens += num_group_rows;
+    }
+}
+
+std::vector<ov::Tensor> ContinuousBatchingPipeline::ContinuousBatchingImpl::embed(const std::vector<std::string>& prompts) {
+    OPENVINO_ASSERT(m_is_hidden_state_output_enabled,
+                    "embed() requires the pipeline to be constructed with the enable_hidden_state_output property");
+
+    // prompt-only pass: one forced greedy token keeps the request lifecycle (scheduling,
+    // prefix caching, cleanup) identical to generation while the hidden state is captured on
+    // the prefill step; the sampled token itself is discarded
+    GenerationConfig embed_config = greedy();
+    embed_config.max_new_tokens = 1;
+    embed_config.ignore_eos = true;
+
+    std::vector<SequenceGroup::Ptr> groups;
+    groups.reserve(prompts.size());
+    std::vector<GenerationHandle> handles;
+    handles.reserve(prompts.size());
+    for (size_t request_id = 0; request_id < prompts.size(); ++request_id) {
+        ov::Tensor input_ids = m_tokenizer.encode(prompts[request_id]).input_ids;
+        SequenceGroup::Ptr sequence_group = SequenceGroup::create(request_id, input_ids, embed_config, m_block_size);
+        if (m_scheduler->get_config().enable_prefix_caching) {
+            m_scheduler->restore_cached_blocks(sequence_group);
+        }
+        groups.push_back(sequence_group);
+        handles.push_back(std::make_shared<GenerationHandleImpl>(sequence_group->get_generation_stream(), embed_config));
+        m_intake_queue.push(sequence_group);
+    }
+
+    while (has_non_finished_requests()) {
+        step();
+    }
+
+    std::vector<ov::Tensor> embeddings;
+    embeddings.reserve(groups.size());
+    for (auto& sequence_group : groups) {
+        OPENVINO_ASSERT(sequence_group->get_prompt_hidden_state().get_size() > 0,
+                        "Prompt hidden state was not captured for request ", sequence_group->get_request_id());
+        embeddings.push_back(sequence_group->get_prompt_hidden_state());
+    }
+    return embeddings;
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingImpl::_fill_prompt_log_probs(std::vector<SequenceGroup::Ptr>& sequence_groups, ov::Tensor& logits) {
     const float * logits_data = logits.data<float>();
     ov::Shape logits_shape = logits.get_shape();
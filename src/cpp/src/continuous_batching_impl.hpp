@@ -3,10 +3,14 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+
 #include "icontinuous_batching.hpp"
 
 #include "openvino/genai/lora_adapter.hpp"
 #include "cache_eviction.hpp"
+#include "lockfree_intake_queue.hpp"
 #include "visual_language/inputs_embedder.hpp"
 
 namespace ov::genai {
@@ -24,6 +28,9 @@ protected:
     std::vector<SequenceGroup::Ptr> m_awaiting_requests;
     // Mutex protecting access to m_awaiting_requests, so add_request and step methods can be called from different threads
     std::mutex m_awaiting_requests_mutex;
+    // Lock-free intake point for add_request, so submission from many threads never blocks on the step loop.
+    // Queued requests are moved to m_awaiting_requests by _drain_intake_queue before m_awaiting_requests is read.
+    LockfreeIntakeQueue<SequenceGroup::Ptr> m_intake_queue;
 
     std::map<size_t, CacheEvictionAlgorithm> m_seq_group_id_to_cache_eviction_algo_map;
 
@@ -37,6 +44,39 @@ protected:
     // flag to enable validation mode for sampler
     bool m_is_validation_mode_enabled = false;
 
+    // forces per-token log-prob recording on all requests (assisting pipelines read them for
+    // acceptance even when the user config never requests logprobs)
+    bool m_force_track_log_probs = false;
+
+    // whether the compiled model has a device-side greedy sampling (argmax) head appended
+    bool m_is_device_greedy_sampling_enabled = false;
+
+    // whether the compiled model exposes the lm-head input as a "last_hidden_state" output,
+    // enabling the prefill-only embed() path
+    bool m_is_hidden_state_output_enabled = false;
+
+    // live shared-memory cache-state publisher for tools/cacheviz, enabled by the
+    // OPENVINO_GENAI_CACHEVIZ_SHM environment variable
+    std::unique_ptr<CacheStateShmPublisher> m_cache_shm_publisher;
+    uint64_t m_cache_shm_step = 0;
+
+    // set by drain_requests(): permanently rejects new admissions during a rolling upgrade
+    std::atomic<bool> m_is_draining{false};
+
+    // Fan-out dedup (enable_prefix_caching only): duplicate prompts arriving together are
+    // admitted one at a time, so followers restore the leader's cached prefill blocks instead
+    // of recomputing the same prompt. Guarded by m_awaiting_requests_mutex.
+    std::vector<SequenceGroup::Ptr> m_deferred_duplicate_requests;
+
+    // Fixed-size ring of per-step phase timings for live latency attribution. The writer (step
+    // loop) fills an entry and then publishes the step counter with release semantics; readers
+    // may skip entries which are concurrently overwritten.
+    static const size_t STEP_TIMINGS_RING_SIZE = 256;
+    std::array<StepPhaseTimings, STEP_TIMINGS_RING_SIZE> m_step_timings_ring{};
+    std::atomic<uint64_t> m_num_recorded_steps{0};
+
+    void _record_step_timings(float schedule_us, float infer_us, float sample_us, float postprocess_us);
+
     size_t m_num_decoder_layers = 0;
     size_t m_block_size = 0;
 
@@ -71,6 +111,15 @@ protected:
      */
     virtual void _pull_awaiting_requests();
 
+    /**
+     * Moves requests from the lock-free intake queue to m_awaiting_requests.
+     * Must be called before m_awaiting_requests is read
+     */
+    void _drain_intake_queue();
+
+    // pauses/resumes requests based on their unread handle-queue depth (max_unread_stream_outputs)
+    void _apply_stream_backpressure();
+
     /**
      * Releases non-running (finished, dropped or OOM) requests from running queue
      */
@@ -86,6 +135,10 @@ protected:
      */
     void _fill_prompt_log_probs(std::vector<SequenceGroup::Ptr>& sequence_groups, ov::Tensor& logits);
 
+    // stores the last prompt token's hidden state into each sequence group completing its
+    // prompt on this step (hidden-state output mode only)
+    void _capture_prompt_hidden_states(std::vector<SequenceGroup::Ptr>& sequence_groups);
+
     /**
      * Performs KV cache eviction is enabled / requireed
      */
@@ -126,15 +179,45 @@ public:
                                  const std::string& prompt,
                                  ov::genai::GenerationConfig sampling_params) override;
 
+    size_t set_prompt_prefix_pinned(const ov::Tensor& input_ids, bool pinned) override;
+
     bool has_non_finished_requests() override;
 
+    /**
+     * Number of requests submitted via add_request and not yet pulled by the step loop.
+     * Lock-free, can be polled from any thread for admission control
+     */
+    size_t get_awaiting_requests_count() const;
+
     void step() override;
 
+    std::vector<StepPhaseTimings> get_recent_step_timings(size_t max_steps) const override;
+
+    BlockManagerStats get_block_manager_stats() const override;
+
+    void update_scheduler_limits(const SchedulerConfig& config) override;
+
+    /**
+     * Attaches a shared cache byte budget to this pipeline's scheduler (used by speculative
+     * decoding to let main and draft pools borrow capacity from each other)
+     */
+    void set_shared_cache_budget(const std::shared_ptr<std::atomic<int64_t>>& budget_bytes);
+
     std::vector<EncodedGenerationResult>
     generate(const std::vector<ov::Tensor>& input_ids,
              const std::vector<GenerationConfig>& sampling_params,
              const StreamerVariant& streamer) override;
 
+    std::vector<ov::Tensor> embed(const std::vector<std::string>& prompts) override;
+
+    std::vector<SchedulingDecisionRecord> get_recent_scheduling_decisions() const override {
+        return m_scheduler->get_recent_scheduling_decisions();
+    }
+
+    std::vector<RequestCheckpoint> drain_requests() override;
+
+    std::vector<GenerationHandle> import_drained_requests(const std::vector<RequestCheckpoint>& checkpoints) override;
+
 
     /**
      * Updates LoRA adapters for current generation call
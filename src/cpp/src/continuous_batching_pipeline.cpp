@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include <cstdint>
+#include <future>
 #include <mutex>
 #include <memory>
 #include <openvino/runtime/properties.hpp>
@@ -68,14 +69,21 @@ ContinuousBatchingPipeline::ContinuousBatchingPipeline( const std::filesystem::p
         OPENVINO_THROW("Could not find a model in the directory.");
     }
 
+    // The tokenizer/detokenizer compilation is independent of the main model read - overlap them
+    // so cold pipeline construction does not serialize the two longest load stages. The tokenizer
+    // setup briefly sets its extension-path environment variable from the worker thread; the
+    // value is constant process-wide, so the write is idempotent across constructions.
+    auto tokenizer_future = std::async(std::launch::async, [&]() {
+        return ov::genai::Tokenizer(directory, tokenizer_properties);
+    });
     auto model = utils::singleton_core().read_model(model_path, {}, properties);
-    auto tokenizer = ov::genai::Tokenizer(directory, tokenizer_properties);
     auto generation_config = utils::from_config_json_if_exists(directory);
 
     std::shared_ptr<InputsEmbedder> embedder;
     if (std::filesystem::exists(directory / "openvino_text_embeddings_model.xml")) {
         embedder = std::make_shared<InputsEmbedder>(directory, device, vision_encoder_properties);
     }
+    auto tokenizer = tokenizer_future.get();
 
     if (is_prompt_lookup_enabled) {
         OPENVINO_ASSERT(draft_model_desr.model == nullptr, "Speculative decoding and prompt lookup decoding are mutually exclusive");
@@ -252,6 +260,59 @@ GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, co
     return m_impl->add_request(request_id, input_ids, sampling_params);
 }
 
+std::vector<ov::genai::StepPhaseTimings> ContinuousBatchingPipeline::get_recent_step_timings(size_t max_steps) const {
+    return m_impl->get_recent_step_timings(max_steps);
+}
+
+ov::genai::BlockManagerStats ContinuousBatchingPipeline::get_block_manager_stats() const {
+    return m_impl->get_block_manager_stats();
+}
+
+void ContinuousBatchingPipeline::update_scheduler_limits(const SchedulerConfig& config) {
+    m_impl->update_scheduler_limits(config);
+}
+
+std::vector<RequestCheckpoint> ContinuousBatchingPipeline::drain_requests() {
+    return m_impl->drain_requests();
+}
+
+std::vector<GenerationHandle> ContinuousBatchingPipeline::import_drained_requests(
+    const std::vector<RequestCheckpoint>& checkpoints) {
+    return m_impl->import_drained_requests(checkpoints);
+}
+
+void ContinuousBatchingPipeline::warmup(const std::vector<size_t>& prompt_lengths) {
+    m_impl->warmup(prompt_lengths);
+}
+
+std::vector<ov::Tensor> ContinuousBatchingPipeline::embed(const std::vector<std::string>& prompts) {
+    return m_impl->embed(prompts);
+}
+
+std::vector<ov::genai::SchedulingDecisionRecord> ContinuousBatchingPipeline::get_recent_scheduling_decisions() const {
+    return m_impl->get_recent_scheduling_decisions();
+}
+
+ov::genai::SpeculativeDecodingSnapshot ContinuousBatchingPipeline::get_speculative_decoding_snapshot() const {
+    return m_impl->get_speculative_decoding_snapshot();
+}
+
+size_t ContinuousBatchingPipeline::pin_prompt_prefix(const ov::Tensor& input_ids) {
+    return m_impl->set_prompt_prefix_pinned(input_ids, true);
+}
+
+size_t ContinuousBatchingPipeline::pin_prompt_prefix(const std::string& prompt) {
+    return m_impl->set_prompt_prefix_pinned(m_impl->get_tokenizer().encode(prompt).input_ids, true);
+}
+
+size_t ContinuousBatchingPipeline::unpin_prompt_prefix(const ov::Tensor& input_ids) {
+    return m_impl->set_prompt_prefix_pinned(input_ids, false);
+}
+
+size_t ContinuousBatchingPipeline::unpin_prompt_prefix(const std::string& prompt) {
+    return m_impl->set_prompt_prefix_pinned(m_impl->get_tokenizer().encode(prompt).input_ids, false);
+}
+
 GenerationHandle ContinuousBatchingPipeline::add_request(uint64_t request_id, const std::string& prompt, const std::vector<ov::Tensor>& images, const ov::genai::GenerationConfig& sampling_params) {
     return m_impl->add_request(request_id, prompt, images, sampling_params);
 }
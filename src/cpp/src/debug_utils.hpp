@@ -153,3 +153,37 @@ inline ov::Tensor from_npy(const std::filesystem::path& npy) {
     OPENVINO_ASSERT(fstream.gcount() == _size);
     return tensor;
 }
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+
+/**
+ * Writes step phase timings (as returned by ContinuousBatchingPipeline::get_recent_step_timings)
+ * as a Chrome trace / Perfetto compatible JSON document, so the last N seconds of the step loop
+ * can be inspected retroactively when a latency SLO trips. Timestamps are reconstructed by laying
+ * the recorded phase durations out back-to-back, which preserves relative phase widths and step
+ * boundaries; gaps between steps (idle time) are not represented.
+ */
+inline void dump_chrome_trace(const std::vector<ov::genai::StepPhaseTimings>& steps, std::ostream& out) {
+    out << "{\"traceEvents\":[";
+    double timestamp_us = 0.0;
+    bool first_event = true;
+    for (const auto& step : steps) {
+        const std::pair<const char*, float> phases[] = {
+            {"schedule", step.schedule_duration},
+            {"infer", step.infer_duration},
+            {"sample", step.sample_duration},
+            {"postprocess", step.postprocess_duration},
+        };
+        for (const auto& phase : phases) {
+            if (!first_event) {
+                out << ",";
+            }
+            first_event = false;
+            out << "{\"name\":\"" << phase.first << "\",\"cat\":\"step\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                << ",\"ts\":" << timestamp_us << ",\"dur\":" << phase.second
+                << ",\"args\":{\"step_id\":" << step.step_id << "}}";
+            timestamp_us += phase.second;
+        }
+    }
+    out << "]}" << std::endl;
+}
@@ -86,6 +86,8 @@ GenerationConfig::GenerationConfig(const std::filesystem::path& json_path) {
     read_json_param(data, "top_k", top_k);
 
     // assistant generation
+    read_json_param(data, "scheduling_priority", scheduling_priority);
+    read_json_param(data, "request_timeout_s", request_timeout_s);
     read_json_param(data, "assistant_confidence_threshold", assistant_confidence_threshold);
     read_json_param(data, "num_assistant_tokens", num_assistant_tokens);
     read_json_param(data, "max_ngram_size", max_ngram_size);
@@ -106,6 +108,7 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     // stop conditions
     read_anymap_param(properties, "eos_token_id", eos_token_id);
     read_anymap_param(properties, "max_new_tokens", max_new_tokens);
+    read_anymap_param(properties, "max_unread_stream_outputs", max_unread_stream_outputs);
     read_anymap_param(properties, "max_length", max_length);
     read_anymap_param(properties, "ignore_eos", ignore_eos);
     read_anymap_param(properties, "min_new_tokens", min_new_tokens);
@@ -143,6 +146,8 @@ void GenerationConfig::update_generation_config(const ov::AnyMap& properties) {
     read_anymap_param(properties, "top_k", top_k);
     // TODO: add support of 'generator' property similar to Image generation
     read_anymap_param(properties, "rng_seed", rng_seed);
+    read_anymap_param(properties, "scheduling_priority", scheduling_priority);
+    read_anymap_param(properties, "request_timeout_s", request_timeout_s);
 
     // assistant generation
     read_anymap_param(properties, "assistant_confidence_threshold", assistant_confidence_threshold);
@@ -183,6 +188,12 @@ bool GenerationConfig::is_prompt_lookup() const {
     return max_ngram_size > 0 && num_assistant_tokens > 0;
 }
 
+// NOTE on set-time validation / frozen configs: GenerationConfig is a mutable aggregate with
+// public fields, so validation results and derived state (stop-token sets, sampling dispatch)
+// cannot be memoized inside it - any field write would silently invalidate them. A frozen config
+// object is an API change tracked separately; meanwhile the genuinely expensive per-request
+// derivations are already cached per request id downstream (compiled stop-string automata and
+// logit processors in the Sampler), leaving this function as cheap field checks.
 void GenerationConfig::validate() const {
     OPENVINO_ASSERT(num_return_sequences > 0, "num_return_sequences must be greater than 0");
 
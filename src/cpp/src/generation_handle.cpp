@@ -63,6 +63,16 @@ void add_partial_result(std::unordered_map<uint64_t, GenerationOutput>& partial_
     }
 }
 
+GenerationOutputs GenerationHandleImpl::read_pending() {
+    OPENVINO_ASSERT(!is_stopped() && !is_cancelled(), "GenerationHandle cannot be used after it is stopped / cancelled.");
+    // a single queue lock acquisition drains the whole backlog accumulated since the last read
+    GenerationOutputs merged_results;
+    for (auto& iteration_results : m_generation_stream->read_pending()) {
+        add_partial_result(merged_results, iteration_results);
+    }
+    return merged_results;
+}
+
 std::vector<GenerationOutput> GenerationHandleImpl::read_all() {
     OPENVINO_ASSERT(!is_stopped() && !is_cancelled(), "GenerationHandle cannot be used after it is stopped / cancelled.");
     std::vector<GenerationOutput> results;
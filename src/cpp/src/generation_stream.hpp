@@ -24,6 +24,12 @@ public:
         return std::make_shared<GenerationStream>();
     }
 
+    // NOTE on output frame pooling: each push moves a freshly built GenerationOutputs map whose
+    // GenerationOutput values embed token/logprob vectors. A slab recycler would need frames
+    // returned after consumption, but read()/read_pending() hand the maps to client code (and
+    // through pybind) with no release hook - so pooling requires an ownership protocol change on
+    // the public handle API first. The cheap wins without that are already in place: values are
+    // moved end-to-end and batched pulls drain the queue in one lock acquisition.
     void push(GenerationOutputs outputs) {
         m_output_queue.push(std::move(outputs));
     }
@@ -32,10 +38,20 @@ public:
         return m_output_queue.pull();
     }
 
+    // drains all currently queued outputs with a single lock acquisition
+    std::vector<GenerationOutputs> read_pending() {
+        return m_output_queue.pull_all();
+    }
+
     bool can_read() {
         return !m_output_queue.empty();
     }
 
+    // number of pushed-but-unread output frames, used for streaming backpressure
+    size_t num_unread_outputs() {
+        return m_output_queue.size();
+    }
+
     void set_generation_status(GenerationStatus status) {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_status = status;
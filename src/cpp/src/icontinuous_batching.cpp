@@ -48,6 +48,27 @@ void ContinuousBatchingPipeline::IContinuousBatchingPipeline::finish_chat() {
     m_history_images.clear();
 };
 
+void ContinuousBatchingPipeline::IContinuousBatchingPipeline::warmup(const std::vector<size_t>& prompt_lengths) {
+    // a couple of generated tokens exercise both the prefill and the decode execution paths
+    GenerationConfig warmup_config = greedy();
+    warmup_config.max_new_tokens = 2;
+    warmup_config.ignore_eos = true;
+
+    std::vector<ov::Tensor> input_ids;
+    std::vector<GenerationConfig> sampling_params;
+    input_ids.reserve(prompt_lengths.size());
+    sampling_params.reserve(prompt_lengths.size());
+    for (size_t prompt_len : prompt_lengths) {
+        OPENVINO_ASSERT(prompt_len > 0, "Warmup prompt lengths must be positive");
+        ov::Tensor ids(ov::element::i64, ov::Shape{1, prompt_len});
+        // token id 0 is valid in every vocabulary; the content is irrelevant for warmup
+        std::fill_n(ids.data<int64_t>(), prompt_len, 0);
+        input_ids.push_back(std::move(ids));
+        sampling_params.push_back(warmup_config);
+    }
+    generate(input_ids, sampling_params, std::monostate{});
+}
+
 std::vector<GenerationResult>
 ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     const std::vector<std::string>& prompts,
@@ -87,22 +108,57 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::generate(
     } else {
         input_ids.reserve(prompts.size());
         timer.start();
+
+        // Template application is a cheap host render, while each encode call is a tokenizer
+        // model inference: prepare all prompts first, then tokenize them in a single padded batch
+        // call and slice the rows back into per-request tensors via the attention mask. A batch
+        // cannot mix add_special_tokens modes, so heterogeneous configs fall back to per-prompt
+        // encoding.
+        std::vector<std::string> prepared_prompts(prompts.size());
+        std::vector<bool> add_special_tokens_flags(prompts.size());
         for (size_t i = 0; i < prompts.size(); i++) {
-            const std::string& prompt = prompts.at(i);
-            const auto encode_start = std::chrono::steady_clock::now();
-            ov::Tensor encoded_inputs;
             if (sampling_params.at(i).apply_chat_template && !m_tokenizer.get_chat_template().empty()) {
-                ChatHistory history({{{"role", "user"}, {"content", prompt}}});
+                ChatHistory history({{{"role", "user"}, {"content", prompts.at(i)}}});
                 constexpr bool add_generation_prompt = true;
-                auto templated_prompt = m_tokenizer.apply_chat_template(history, add_generation_prompt);
-                encoded_inputs = m_tokenizer.encode(templated_prompt, ov::genai::add_special_tokens(false)).input_ids;
+                prepared_prompts[i] = m_tokenizer.apply_chat_template(history, add_generation_prompt);
+                add_special_tokens_flags[i] = false;
             } else {
                 // in case when chat_template was not found in tokenizer_config.json or set
-                std::string input_str(prompt);
-                encoded_inputs = m_tokenizer.encode(input_str, ov::genai::add_special_tokens(true)).input_ids;
+                prepared_prompts[i] = prompts.at(i);
+                add_special_tokens_flags[i] = true;
+            }
+        }
+
+        bool is_uniform_batch = prompts.size() > 1 &&
+            std::all_of(add_special_tokens_flags.begin(), add_special_tokens_flags.end(),
+                        [&](bool flag) { return flag == add_special_tokens_flags.front(); });
+
+        if (is_uniform_batch) {
+            const auto encode_start = std::chrono::steady_clock::now();
+            auto batch_encoded = m_tokenizer.encode(prepared_prompts, ov::genai::add_special_tokens(add_special_tokens_flags.front()));
+            const auto batch_duration = PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start);
+
+            const ov::Shape batch_shape = batch_encoded.input_ids.get_shape();
+            const size_t seq_len = batch_shape.at(1);
+            const int64_t* ids_data = batch_encoded.input_ids.data<int64_t>();
+            const int64_t* mask_data = batch_encoded.attention_mask.data<int64_t>();
+            for (size_t i = 0; i < prompts.size(); i++) {
+                // strip padding: take the contiguous span of attended positions of this row
+                size_t begin = 0, end = seq_len;
+                while (begin < end && mask_data[i * seq_len + begin] == 0) ++begin;
+                while (end > begin && mask_data[i * seq_len + end - 1] == 0) --end;
+                ov::Tensor row(ov::element::i64, {1, end - begin});
+                std::copy_n(ids_data + i * seq_len + begin, end - begin, row.data<int64_t>());
+                input_ids.push_back(std::move(row));
+                tokenization_durations.emplace_back(batch_duration / prompts.size());
+            }
+        } else {
+            for (size_t i = 0; i < prompts.size(); i++) {
+                const auto encode_start = std::chrono::steady_clock::now();
+                input_ids.push_back(m_tokenizer.encode(prepared_prompts[i],
+                    ov::genai::add_special_tokens(add_special_tokens_flags[i])).input_ids);
+                tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
             }
-            input_ids.push_back(encoded_inputs);
-            tokenization_durations.emplace_back(PerfMetrics::get_microsec(std::chrono::steady_clock::now() - encode_start));
         }
         timer.end();
     }
@@ -236,6 +292,11 @@ ContinuousBatchingPipeline::IContinuousBatchingPipeline::add_request(uint64_t re
     OPENVINO_ASSERT(m_model_input_type == ModelInputType::EMBEDDINGS, "Model doesn't support embeddings.");
     ov::genai::VLMPerfMetrics metrics;
     m_inputs_embedder->set_apply_chat_template_status(sampling_params.apply_chat_template);
+    // Vision encoding runs here on the submitting thread, before the request enters the intake
+    // queue: the step loop never waits on an image encode, and requests are admitted to the LLM
+    // scheduler only once their embeddings exist. Concurrent submitters encode in parallel through
+    // the vision encoder's infer request pool; a server wanting to keep its handler threads free
+    // should call add_request from a worker pool rather than from the accept loop.
     ov::Tensor inputs = m_inputs_embedder->get_inputs_embeds(prompt, rgbs, metrics);
     return add_request(request_id, inputs, sampling_params);
 }
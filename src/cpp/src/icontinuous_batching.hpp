@@ -22,6 +22,17 @@ enum class ModelInputType {
 
 /**
  * Base interface for all continuous batching based pipelines
+ *
+ * NOTE on a data-parallel replicated-runner mode (one logical pipeline spreading sequence groups
+ * over N device replicas): the clean seam is this interface - a ReplicatedImpl holding N
+ * ContinuousBatchingImpl instances, routing add_request by projected load (prompt length plus
+ * active tokens, both already cheap to read), forwarding step() to all replicas and merging
+ * PipelineMetrics/BlockManagerStats. GenerationHandle semantics need no change since handles bind
+ * to streams, not to a runner. What blocks a drop-in implementation today is model memory: each
+ * ContinuousBatchingImpl compiles its own model, so N replicas cost N weight copies until the
+ * runtime exposes compiled-model sharing across pipeline instances (see the class-level note in
+ * continuous_batching_pipeline.hpp); with one replica per *device* the design above is
+ * implementable as-is and replaces external sharding wrappers.
  */
 class ContinuousBatchingPipeline::IContinuousBatchingPipeline {
 protected:
@@ -89,6 +100,16 @@ public:
                                  const std::vector<ov::Tensor>& rgbs,
                                  GenerationConfig sampling_params);
 
+    /**
+     * Pins or unpins KV cache blocks holding the prefix of the given tokenized prompt, so that pinned
+     * blocks are never overwritten by the prefix caching eviction logic. Effective only for pipelines
+     * with prefix caching enabled; other backends keep the default no-op behavior.
+     * @return The number of KV cache blocks affected
+     */
+    virtual size_t set_prompt_prefix_pinned(const ov::Tensor& input_ids, bool pinned) {
+        return 0;
+    }
+
     /**
      * Checks whether server (pipeline) has non-finished requests and step() should be called within a loop
      */
@@ -99,6 +120,73 @@ public:
      */
     virtual void step() = 0;
 
+    /**
+     * Returns the phase timings of recent generation steps; backends without step-level
+     * instrumentation return an empty vector
+     */
+    virtual std::vector<StepPhaseTimings> get_recent_step_timings(size_t max_steps) const {
+        return {};
+    }
+
+    /**
+     * Requests a runtime update of reconfigurable scheduler limits (applied at the next step
+     * boundary); backends without a scheduler ignore it
+     */
+    virtual void update_scheduler_limits(const SchedulerConfig& config) {}
+
+    /**
+     * Runs a prompt-only pass and returns the final hidden state of each prompt's last token
+     * (one [hidden_size] tensor per prompt). Only supported by backends constructed with the
+     * enable_hidden_state_output property.
+     */
+    virtual std::vector<ov::Tensor> embed(const std::vector<std::string>& prompts) {
+        OPENVINO_THROW("embed() is not supported by this pipeline backend");
+    }
+
+    /**
+     * Returns live speculative decoding statistics; non-speculative backends return an empty snapshot
+     */
+    virtual SpeculativeDecodingSnapshot get_speculative_decoding_snapshot() const {
+        return {};
+    }
+
+    /**
+     * Returns recent per-step scheduling decision records; backends without a batch scheduler
+     * return an empty history
+     */
+    virtual std::vector<SchedulingDecisionRecord> get_recent_scheduling_decisions() const {
+        return {};
+    }
+
+    /**
+     * Returns KV block manager telemetry counters; backends without a block manager return zeros
+     */
+    virtual BlockManagerStats get_block_manager_stats() const {
+        return {};
+    }
+
+    /**
+     * Stops admissions and in-flight requests, returning checkpoints for resubmission elsewhere
+     */
+    virtual std::vector<RequestCheckpoint> drain_requests() {
+        OPENVINO_THROW("drain_requests() is not supported by this pipeline backend");
+    }
+
+    /**
+     * Resubmits requests captured by drain_requests(); returns one handle per checkpoint
+     */
+    virtual std::vector<GenerationHandle> import_drained_requests(const std::vector<RequestCheckpoint>&) {
+        OPENVINO_THROW("import_drained_requests() is not supported by this pipeline backend");
+    }
+
+    /**
+     * Runs synthetic prefill + decode iterations over the given prompt lengths so the first
+     * real request does not pay the plugin's lazy-allocation and JIT costs; also touches the
+     * KV cache pages the synthetic requests allocate. Intended to be called once after
+     * construction, before serving traffic.
+     */
+    virtual void warmup(const std::vector<size_t>& prompt_lengths);
+
     /**
      * Performs monolitic generation based on encoded prompts
      */
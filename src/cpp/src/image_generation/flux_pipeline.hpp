@@ -317,6 +317,9 @@ public:
         size_t height = generation_config.height / vae_scale_factor;
         size_t width = generation_config.width / vae_scale_factor;
 
+        // Batching note: all num_images_per_prompt latents are denoised as one transformer batch
+        // with a single (repeated, not re-encoded) text embedding pass; activation memory scales
+        // linearly with the image count.
         ov::Shape latent_shape{generation_config.num_images_per_prompt,
                                num_channels_latents,
                                height,
@@ -479,6 +482,11 @@ public:
         ov::Tensor timestep(ov::element::f32, {1});
         float* timestep_data = timestep.data<float>();
 
+        // Step-invariant tensors are prepared once before this loop: latent image ids, the
+        // guidance vector and the hidden states are set on the transformer request up front, and
+        // the latents stay in packed layout for the whole loop - pack/unpack happen exactly once
+        // at preparation and before VAE decode. Per-step host work is limited to the timestep
+        // scalar and the scheduler update.
         for (size_t inference_step = 0; inference_step < timesteps.size(); ++inference_step) {
             auto step_start = std::chrono::steady_clock::now();
             timestep_data[0] = timesteps[inference_step] / 1000.0f;
@@ -3,6 +3,7 @@
 
 #include "openvino/genai/image_generation/generation_config.hpp"
 
+#include <cmath>
 #include <ctime>
 #include <cstdlib>
 
@@ -38,6 +39,76 @@ void CppStdGenerator::seed(size_t new_seed) {
     m_gen.seed(new_seed);
 }
 
+namespace {
+
+// Philox4x32-10 round function constants (Salmon et al., "Parallel random numbers: as easy as
+// 1, 2, 3")
+constexpr uint32_t PHILOX_M0 = 0xD2511F53u;
+constexpr uint32_t PHILOX_M1 = 0xCD9E8D57u;
+constexpr uint32_t PHILOX_W0 = 0x9E3779B9u;
+constexpr uint32_t PHILOX_W1 = 0xBB67AE85u;
+
+void philox4x32_10(uint32_t counter[4], uint32_t key[2]) {
+    for (int round = 0; round < 10; ++round) {
+        const uint64_t product0 = static_cast<uint64_t>(PHILOX_M0) * counter[0];
+        const uint64_t product1 = static_cast<uint64_t>(PHILOX_M1) * counter[2];
+        const uint32_t hi0 = static_cast<uint32_t>(product0 >> 32), lo0 = static_cast<uint32_t>(product0);
+        const uint32_t hi1 = static_cast<uint32_t>(product1 >> 32), lo1 = static_cast<uint32_t>(product1);
+        counter[0] = hi1 ^ counter[1] ^ key[0];
+        counter[1] = lo1;
+        counter[2] = hi0 ^ counter[3] ^ key[1];
+        counter[3] = lo0;
+        key[0] += PHILOX_W0;
+        key[1] += PHILOX_W1;
+    }
+}
+
+}  // namespace
+
+PhiloxGenerator::PhiloxGenerator(uint64_t seed, uint64_t stream)
+    : m_seed(seed), m_stream(stream) {
+}
+
+void PhiloxGenerator::refill() {
+    uint32_t counter[4] = {static_cast<uint32_t>(m_counter),
+                           static_cast<uint32_t>(m_counter >> 32),
+                           static_cast<uint32_t>(m_stream),
+                           static_cast<uint32_t>(m_stream >> 32)};
+    uint32_t key[2] = {static_cast<uint32_t>(m_seed), static_cast<uint32_t>(m_seed >> 32)};
+    philox4x32_10(counter, key);
+    ++m_counter;
+
+    // Box-Muller over the two uniform pairs; (0, 1] mapping keeps log() finite
+    for (size_t pair = 0; pair < 2; ++pair) {
+        const float u1 = (counter[pair * 2] + 1.0f) / 4294967296.0f;
+        const float u2 = (counter[pair * 2 + 1] + 1.0f) / 4294967296.0f;
+        const float radius = std::sqrt(-2.0f * std::log(u1));
+        const float angle = 2.0f * 3.14159265358979323846f * u2;
+        m_buffered[pair * 2] = radius * std::cos(angle);
+        m_buffered[pair * 2 + 1] = radius * std::sin(angle);
+    }
+    m_buffered_left = 4;
+}
+
+float PhiloxGenerator::next() {
+    if (m_buffered_left == 0) {
+        refill();
+    }
+    return m_buffered[4 - m_buffered_left--];
+}
+
+void PhiloxGenerator::seed(size_t new_seed) {
+    m_seed = new_seed;
+    m_counter = 0;
+    m_buffered_left = 0;
+}
+
+void PhiloxGenerator::set_stream(uint64_t stream) {
+    m_stream = stream;
+    m_counter = 0;
+    m_buffered_left = 0;
+}
+
 //
 // GenerationConfig
 //
@@ -19,6 +19,13 @@
 #include "json_utils.hpp"
 #include "lora_helper.hpp"
 
+// NOTE on progressive latent previews: the per-step callback already receives the current
+// denoised latent (not just the step index), and since the denoise loop launches the next UNet
+// inference before invoking the callback, preview work in the callback overlaps device compute.
+// Today a preview can be produced by calling the pipeline's decode() on every Nth callback, at
+// full-VAE cost on the main device. A cheap TAESD-style approximation needs a second decoder
+// model slot here (compiled on a secondary device so it does not contend with the UNet) - the
+// exported model package would have to ship the approximate decoder alongside the VAE first.
 namespace ov {
 namespace genai {
 
@@ -233,11 +240,143 @@ AutoencoderKL& AutoencoderKL::compile(const std::string& device, const ov::AnyMa
 ov::Tensor AutoencoderKL::decode(ov::Tensor latent) {
     OPENVINO_ASSERT(m_decoder_request, "VAE decoder model must be compiled first. Cannot infer non-compiled model");
 
+    const ov::Shape latent_shape = latent.get_shape();
+    if (m_tile_latent_size > 0 && latent_shape.size() == 4 &&
+        (latent_shape[2] > m_tile_latent_size || latent_shape[3] > m_tile_latent_size)) {
+        return decode_tiled(latent);
+    }
+
     m_decoder_request.set_input_tensor(latent);
     m_decoder_request.infer();
     return m_decoder_request.get_output_tensor();
 }
 
+void AutoencoderKL::set_tiled_decode(size_t tile_latent_size, size_t tile_overlap) {
+    OPENVINO_ASSERT(tile_latent_size == 0 || tile_overlap < tile_latent_size,
+                    "tile_overlap must be smaller than tile_latent_size");
+    m_tile_latent_size = tile_latent_size;
+    m_tile_overlap = tile_overlap;
+}
+
+ov::Tensor AutoencoderKL::decode_tiled(ov::Tensor latent) {
+    // Decodes the latent in fixed-size overlapping tiles and blends the seams with linear ramps,
+    // so activation memory is bounded by the tile size instead of the full resolution. All tiles
+    // share one size (edge tiles are aligned inwards), keeping the decoder shape constant.
+    const ov::Shape latent_shape = latent.get_shape();
+    const size_t batch = latent_shape[0], channels = latent_shape[1];
+    const size_t latent_height = latent_shape[2], latent_width = latent_shape[3];
+    const size_t tile = std::min({m_tile_latent_size, latent_height, latent_width});
+    // the effective tile can be clamped below the configured size by a small latent dimension,
+    // keep the overlap strictly smaller so the stride stays positive
+    const size_t overlap = std::min(m_tile_overlap, tile - 1);
+    const size_t stride = tile - overlap;
+
+    auto tile_starts = [&](size_t extent) {
+        std::vector<size_t> starts;
+        for (size_t start = 0;; start += stride) {
+            if (start + tile >= extent) {
+                starts.push_back(extent - tile);  // align the last tile to the edge
+                break;
+            }
+            starts.push_back(start);
+        }
+        return starts;
+    };
+    const std::vector<size_t> y_starts = tile_starts(latent_height), x_starts = tile_starts(latent_width);
+
+    ov::Tensor latent_tile(latent.get_element_type(), {batch, channels, tile, tile});
+    const float* latent_data = latent.data<const float>();
+
+    ov::Tensor output;
+    ov::Tensor weights;
+    size_t scale = 0, out_channels = 0;
+
+    for (size_t y_start : y_starts) {
+        for (size_t x_start : x_starts) {
+            // gather the tile (rows are contiguous along the width dimension)
+            float* tile_data = latent_tile.data<float>();
+            for (size_t b = 0; b < batch; ++b) {
+                for (size_t c = 0; c < channels; ++c) {
+                    const float* src_plane = latent_data + ((b * channels + c) * latent_height) * latent_width;
+                    float* dst_plane = tile_data + ((b * channels + c) * tile) * tile;
+                    for (size_t y = 0; y < tile; ++y) {
+                        std::copy_n(src_plane + (y_start + y) * latent_width + x_start, tile, dst_plane + y * tile);
+                    }
+                }
+            }
+
+            m_decoder_request.set_input_tensor(latent_tile);
+            m_decoder_request.infer();
+            ov::Tensor decoded_tile = m_decoder_request.get_output_tensor();
+
+            if (!output) {
+                const ov::Shape tile_out_shape = decoded_tile.get_shape();
+                OPENVINO_ASSERT(tile_out_shape.size() == 4 && tile_out_shape[2] % tile == 0,
+                                "unexpected VAE decoder output shape for tiled decoding");
+                scale = tile_out_shape[2] / tile;
+                out_channels = tile_out_shape[1];
+                output = ov::Tensor(decoded_tile.get_element_type(), {batch, out_channels, latent_height * scale, latent_width * scale});
+                weights = ov::Tensor(ov::element::f32, output.get_shape());
+                std::fill_n(output.data<float>(), output.get_size(), 0.f);
+                std::fill_n(weights.data<float>(), weights.get_size(), 0.f);
+            }
+
+            // accumulate with a separable linear ramp over the overlap margins
+            const size_t out_tile = tile * scale, overlap_out = overlap * scale;
+            auto ramp = [&](size_t pos, size_t start, size_t extent_starts_front) {
+                // weight of a pixel within the tile along one axis
+                float weight = 1.f;
+                if (start > 0 && pos < overlap_out) {
+                    weight = std::min(weight, (pos + 1.f) / (overlap_out + 1.f));
+                }
+                if (start + tile < extent_starts_front && pos + overlap_out >= out_tile) {
+                    weight = std::min(weight, (out_tile - pos) / (overlap_out + 1.f));
+                }
+                return weight;
+            };
+
+            const float* decoded_data = decoded_tile.data<const float>();
+            float* output_data = output.data<float>();
+            float* weights_data = weights.data<float>();
+            const size_t out_height = latent_height * scale, out_width = latent_width * scale;
+
+            for (size_t b = 0; b < batch; ++b) {
+                for (size_t c = 0; c < out_channels; ++c) {
+                    const float* src_plane = decoded_data + ((b * out_channels + c) * out_tile) * out_tile;
+                    float* dst_plane = output_data + ((b * out_channels + c) * out_height) * out_width;
+                    float* weight_plane = weights_data + ((b * out_channels + c) * out_height) * out_width;
+                    for (size_t y = 0; y < out_tile; ++y) {
+                        float y_weight = ramp(y, y_start, latent_height);
+                        size_t dst_row = (y_start * scale + y) * out_width + x_start * scale;
+                        for (size_t x = 0; x < out_tile; ++x) {
+                            float weight = y_weight * ramp(x, x_start, latent_width);
+                            dst_plane[dst_row + x] += weight * src_plane[y * out_tile + x];
+                            weight_plane[dst_row + x] += weight;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // normalize by the accumulated weights (interior pixels have weight sums > 0 by construction)
+    float* output_data = output.data<float>();
+    const float* weights_data = weights.data<float>();
+    for (size_t i = 0; i < output.get_size(); ++i) {
+        output_data[i] /= std::max(weights_data[i], 1e-6f);
+    }
+
+    return output;
+}
+
+bool AutoencoderKL::encode_draws_from_generator() {
+    if (!m_encoder_request) {
+        return false;
+    }
+    auto outputs = m_encoder_request.get_compiled_model().outputs();
+    return outputs.size() == 1 && outputs[0].get_any_name() == "latent_parameters";
+}
+
 ov::Tensor AutoencoderKL::encode(ov::Tensor image, std::shared_ptr<Generator> generator) {
     OPENVINO_ASSERT(m_encoder_request || m_encoder_model, "AutoencoderKL is created without 'VAE encoder' capability. Please, pass extra argument to constructor to create 'VAE encoder'");
     OPENVINO_ASSERT(m_encoder_request, "VAE encoder model must be compiled first. Cannot infer non-compiled model");
@@ -116,5 +116,15 @@ ov::Tensor UNet2DConditionModel::infer(ov::Tensor sample, ov::Tensor timestep) {
     return m_impl->infer(sample, timestep);
 }
 
+void UNet2DConditionModel::start_async(ov::Tensor sample, ov::Tensor timestep) {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first. Cannot infer non-compiled model");
+    m_impl->start_async(sample, timestep);
+}
+
+ov::Tensor UNet2DConditionModel::wait() {
+    OPENVINO_ASSERT(m_impl, "UNet model must be compiled first. Cannot infer non-compiled model");
+    return m_impl->wait();
+}
+
 } // namespace genai
 } // namespace ov
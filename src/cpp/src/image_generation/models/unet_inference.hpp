@@ -9,6 +9,8 @@ namespace ov {
 namespace genai {
 
 class UNet2DConditionModel::UNetInference {
+protected:
+    ov::Tensor m_sync_fallback_result;
 
 public:
     virtual void compile(std::shared_ptr<ov::Model> model, const std::string& device, const ov::AnyMap& properties) = 0;
@@ -16,6 +18,16 @@ public:
     virtual void set_adapters(AdapterController& adapter_controller, const AdapterConfig& adapters) = 0;
     virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep) = 0;
 
+    // Asynchronous variant used for denoise-loop pipelining: backends without native async
+    // support fall back to a synchronous infer in start_async, so wait() is always valid.
+    virtual void start_async(ov::Tensor sample, ov::Tensor timestep) {
+        m_sync_fallback_result = infer(sample, timestep);
+    }
+
+    virtual ov::Tensor wait() {
+        return m_sync_fallback_result;
+    }
+
     // utility function to resize model given optional dimensions.
     static void reshape(std::shared_ptr<ov::Model> model,
                         std::optional<int> batch_size = {},
@@ -29,13 +29,21 @@ public:
     }
 
     virtual ov::Tensor infer(ov::Tensor sample, ov::Tensor timestep) override {
+        start_async(sample, timestep);
+        return wait();
+    }
+
+    virtual void start_async(ov::Tensor sample, ov::Tensor timestep) override {
         OPENVINO_ASSERT(m_request, "UNet model must be compiled first. Cannot infer non-compiled model");
 
         m_request.set_tensor("sample", sample);
         m_request.set_tensor("timestep", timestep);
 
-        m_request.infer();
+        m_request.start_async();
+    }
 
+    virtual ov::Tensor wait() override {
+        m_request.wait();
         return m_request.get_output_tensor();
     }
 
@@ -136,6 +136,8 @@ void batch_copy(ov::Tensor src, ov::Tensor dst, size_t src_batch, size_t dst_bat
 }
 
 ov::Tensor repeat(const ov::Tensor input, const size_t n_times) {
+    // n == 1 returns the input itself (no copy): callers that keep the result beyond the
+    // lifetime of a request-owned input must copy explicitly
     if (n_times == 1)
         return input;
 
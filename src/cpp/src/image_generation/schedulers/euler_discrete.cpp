@@ -106,6 +106,19 @@ EulerDiscreteScheduler::EulerDiscreteScheduler(const Config& scheduler_config) :
 }
 
 void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float strength) {
+    // identical-config calls replay the memoized tables (thousands of same-config generations
+    // per hour only pay the table construction once)
+    if (num_inference_steps == m_cached_num_inference_steps && strength == m_cached_strength &&
+        !m_cached_timesteps.empty()) {
+        m_timesteps = m_cached_timesteps;
+        m_schedule_timesteps = m_cached_schedule_timesteps;
+        m_sigmas = m_cached_sigmas;
+        m_step_index = -1;
+        m_begin_index = m_cached_begin_index;
+        m_num_inference_steps = num_inference_steps;
+        return;
+    }
+
     // TODO: support `timesteps` and `sigmas` inputs
     m_timesteps.clear();
     m_sigmas.clear();
@@ -209,6 +222,13 @@ void EulerDiscreteScheduler::set_timesteps(size_t num_inference_steps, float str
                         "After adjusting the num_inference_steps by strength parameter: ", strength,
                         " the number of pipeline steps is less then 1 and not appropriate for this pipeline. Please set a different strength value.");
     }
+
+    m_cached_num_inference_steps = num_inference_steps;
+    m_cached_strength = strength;
+    m_cached_timesteps = m_timesteps;
+    m_cached_schedule_timesteps = m_schedule_timesteps;
+    m_cached_sigmas = m_sigmas;
+    m_cached_begin_index = m_begin_index;
 }
 
 std::map<std::string, ov::Tensor> EulerDiscreteScheduler::step(ov::Tensor noise_pred, ov::Tensor latents, size_t inference_step, std::shared_ptr<Generator> generator) {
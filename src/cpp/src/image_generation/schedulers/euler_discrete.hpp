@@ -58,6 +58,14 @@ private:
 
     int m_step_index, m_begin_index;
 
+    // memoization of the last set_timesteps result: identical back-to-back generations skip the
+    // pow/log table construction entirely
+    size_t m_cached_num_inference_steps = 0;
+    float m_cached_strength = -1.f;
+    std::vector<int64_t> m_cached_timesteps, m_cached_schedule_timesteps;
+    std::vector<float> m_cached_sigmas;
+    int m_cached_begin_index = -1;
+
     size_t _index_for_timestep(int64_t timestep) const;
 };
 
@@ -163,16 +163,50 @@ public:
         m_vae->compile(vae_device, *updated_properties);
     }
 
+    static const size_t PROMPT_EMBEDDING_CACHE_CAPACITY = 32;
+    std::map<std::string, ov::Tensor> m_prompt_embedding_cache;
+
+    // last VAE-encoded init-image latent, keyed by processed-image content hash; makes strength
+    // scrubbing (repeated generate() with the same init image) skip the encoder inference
+    struct InitLatentCache {
+        uint64_t key = 0;
+        ov::Tensor latent;
+    } m_init_latent_cache;
+
     void compute_hidden_states(const std::string& positive_prompt, const ImageGenerationConfig& generation_config) override {
         const auto& unet_config = m_unet->get_config();
         const size_t batch_size_multiplier = m_unet->do_classifier_free_guidance(generation_config.guidance_scale) ? 2 : 1;  // Unet accepts 2x batch in case of CFG
 
         std::string negative_prompt = generation_config.negative_prompt != std::nullopt ? *generation_config.negative_prompt : std::string{};
-        auto infer_start = std::chrono::steady_clock::now();
-        ov::Tensor encoder_hidden_states = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
-            batch_size_multiplier > 1);
-        auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
-        m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+
+        // Prompt embedding cache: products commonly cycle through a small set of canned style
+        // prompts, making the text encoder pass nearly always repeatable. Keyed by the inputs
+        // that shape the encoder output: prompts and whether CFG doubles the batch.
+        const std::string embedding_cache_key = positive_prompt + "\x1f" + negative_prompt +
+            (batch_size_multiplier > 1 ? "\x1fcfg" : "");
+        ov::Tensor encoder_hidden_states;
+        auto cached_embedding_it = m_prompt_embedding_cache.find(embedding_cache_key);
+        if (cached_embedding_it != m_prompt_embedding_cache.end()) {
+            encoder_hidden_states = cached_embedding_it->second;
+            m_perf_metrics.encoder_inference_duration["text_encoder"] = 0;
+        } else {
+            auto infer_start = std::chrono::steady_clock::now();
+            ov::Tensor encoder_output = m_clip_text_encoder->infer(positive_prompt, negative_prompt,
+                batch_size_multiplier > 1);
+            auto infer_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - infer_start).count();
+            m_perf_metrics.encoder_inference_duration["text_encoder"] = infer_duration;
+
+            // deep copy: the encoder infer request reuses its output tensor
+            encoder_hidden_states = ov::Tensor(encoder_output.get_element_type(), encoder_output.get_shape());
+            encoder_output.copy_to(encoder_hidden_states);
+
+            if (m_prompt_embedding_cache.size() >= PROMPT_EMBEDDING_CACHE_CAPACITY) {
+                // simple bounded cache: drop everything when full, the steady state of a canned
+                // prompt set refills within one cycle
+                m_prompt_embedding_cache.clear();
+            }
+            m_prompt_embedding_cache.emplace(embedding_cache_key, encoder_hidden_states);
+        }
 
         // replicate encoder hidden state to UNet model
         if (generation_config.num_images_per_prompt == 1) {
@@ -200,6 +234,19 @@ public:
         }
     }
 
+    // FNV-1a over the raw tensor bytes; used to key the init-latent cache by image content
+    static uint64_t _hash_tensor_content(const ov::Tensor& tensor) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(tensor.data());
+        uint64_t hash = 1469598103934665603ull;
+        for (size_t i = 0, size = tensor.get_byte_size(); i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        for (size_t dim : tensor.get_shape()) {
+            hash = (hash ^ dim) * 1099511628211ull;
+        }
+        return hash;
+    }
+
     std::tuple<ov::Tensor, ov::Tensor, ov::Tensor, ov::Tensor> prepare_latents(ov::Tensor initial_image, const ImageGenerationConfig& generation_config) override {
         std::vector<int64_t> timesteps = m_scheduler->get_timesteps();
         OPENVINO_ASSERT(!timesteps.empty(), "Timesteps are not computed yet");
@@ -223,11 +270,37 @@ public:
             // - inpainting with strength < 1.0
             // - inpainting with non-specialized model
             if (!is_strength_max || return_image_latent) {
-                auto encode_start = std::chrono::steady_clock::now();
-                image_latent = m_vae->encode(proccesed_image, generation_config.generator);
-                m_perf_metrics.vae_encoder_inference_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
-                                                                    std::chrono::steady_clock::now() - encode_start)
-                                                                    .count();
+                // Strength scrubbing re-runs generate() with the same init image and a different
+                // strength; the VAE encode of that image is identical each time, so the last
+                // encoded latent is cached keyed by the processed image content. A hit skips the
+                // encoder inference entirely (and its generator draw - intentional for scrubbing,
+                // which wants everything but strength identical between adjustments).
+                const uint64_t image_content_key = _hash_tensor_content(proccesed_image);
+                if (m_init_latent_cache.latent && m_init_latent_cache.key == image_content_key) {
+                    image_latent = m_init_latent_cache.latent;
+                    m_perf_metrics.vae_encoder_inference_duration = 0;
+                    // keep the generator stream position identical between hit and miss paths:
+                    // a posterior-sampling encoder consumed one latent-shaped draw on the miss,
+                    // so a hit must consume (and discard) the same draw - otherwise repeating an
+                    // identical generate() call would feed later noise from an earlier stream
+                    // position and break same-seed determinism
+                    if (m_vae->encode_draws_from_generator()) {
+                        generation_config.generator->randn_tensor(image_latent.get_shape());
+                    }
+                } else {
+                    auto encode_start = std::chrono::steady_clock::now();
+                    image_latent = m_vae->encode(proccesed_image, generation_config.generator);
+                    m_perf_metrics.vae_encoder_inference_duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                                        std::chrono::steady_clock::now() - encode_start)
+                                                                        .count();
+                    // deep copy: for 'latent_sample' exports encode() returns the encoder infer
+                    // request's output tensor, which the next encoder run (e.g. the masked image
+                    // in prepare_mask_latents) overwrites in place while the key still names the
+                    // init image
+                    m_init_latent_cache.key = image_content_key;
+                    m_init_latent_cache.latent = ov::Tensor(image_latent.get_element_type(), image_latent.get_shape());
+                    image_latent.copy_to(m_init_latent_cache.latent);
+                }
                 // in case of image to image or inpaining with strength < 1.0, we need to initialize initial latent with
                 // image_latent
                 if (!is_strength_max) {
@@ -261,6 +334,8 @@ public:
             }
             m_clip_text_encoder->set_adapters(adapters);
             m_unet->set_adapters(adapters);
+            // adapters change the text encoder outputs, cached embeddings are stale now
+            m_prompt_embedding_cache.clear();
         }
     }
 
@@ -317,10 +392,17 @@ public:
         ov::Shape latent_shape_cfg = latent.get_shape();
         latent_shape_cfg[0] *= batch_size_multiplier;
 
+        // Batching note: all num_images_per_prompt latents run through each UNet inference as one
+        // batch (times 2 with classifier-free guidance), sharing a single text-encoding pass.
+        // Peak activation memory therefore scales linearly with num_images_per_prompt x CFG
+        // multiplier; on memory-constrained devices reshape the pipeline to a smaller static
+        // batch and loop generate() calls instead.
         ov::Tensor latent_cfg(ov::element::f32, latent_shape_cfg), denoised, noisy_residual_tensor(ov::element::f32, {}), latent_model_input;
 
-        for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
-            auto step_start = std::chrono::steady_clock::now();
+        // prepares the UNet input for a given inference step and launches the inference
+        // asynchronously, so host-side work after the previous step (callbacks in particular)
+        // overlaps with device compute
+        auto start_unet_async = [&](size_t inference_step) {
             numpy_utils::batch_copy(latent, latent_cfg, 0, 0, generation_config.num_images_per_prompt);
             // concat the same latent twice along a batch dimension in case of CFG
             if (batch_size_multiplier > 1) {
@@ -331,8 +413,14 @@ public:
 
             ov::Tensor latent_model_input = is_inpainting_model() ? numpy_utils::concat(numpy_utils::concat(latent_cfg, mask, 1), masked_image_latent, 1) : latent_cfg;
             ov::Tensor timestep(ov::element::i64, {1}, &timesteps[inference_step]);
-            auto infer_start = std::chrono::steady_clock::now();
-            ov::Tensor noise_pred_tensor = m_unet->infer(latent_model_input, timestep);
+            m_unet->start_async(latent_model_input, timestep);
+            return std::chrono::steady_clock::now();
+        };
+
+        auto infer_start = start_unet_async(0);
+        for (size_t inference_step = 0; inference_step < timesteps.size(); inference_step++) {
+            auto step_start = std::chrono::steady_clock::now();
+            ov::Tensor noise_pred_tensor = m_unet->wait();
             auto infer_duration = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - infer_start);
             m_perf_metrics.raw_metrics.unet_inference_durations.emplace_back(MicroSeconds(infer_duration));
 
@@ -340,17 +428,24 @@ public:
             noise_pred_shape[0] /= batch_size_multiplier;
 
             if (batch_size_multiplier > 1) {
-                noisy_residual_tensor.set_shape(noise_pred_shape);
-
-                // perform guidance
-                float* noisy_residual = noisy_residual_tensor.data<float>();
-                const float* noise_pred_uncond = noise_pred_tensor.data<const float>();
-                const float* noise_pred_text = noise_pred_uncond + noisy_residual_tensor.get_size();
-
-                for (size_t i = 0; i < noisy_residual_tensor.get_size(); ++i) {
-                    noisy_residual[i] = noise_pred_uncond[i] +
-                        generation_config.guidance_scale * (noise_pred_text[i] - noise_pred_uncond[i]);
+                // perform guidance in place: the unconditional half of the prediction becomes the
+                // combined residual (out = uncond + g * (text - uncond)), and the residual tensor
+                // is a zero-copy view of that half. This drops the separate residual buffer and
+                // one full write stream per step, and the single-array form vectorizes cleanly.
+                // Safe because the next UNet inference is launched only after the scheduler step
+                // consumed the view.
+                float* noise_pred = noise_pred_tensor.data<float>();
+                const size_t half_size = noise_pred_tensor.get_size() / batch_size_multiplier;
+                const float* noise_pred_text = noise_pred + half_size;
+                const float guidance_scale = generation_config.guidance_scale;
+
+                for (size_t i = 0; i < half_size; ++i) {
+                    noise_pred[i] += guidance_scale * (noise_pred_text[i] - noise_pred[i]);
                 }
+
+                ov::Coordinate view_begin(noise_pred_tensor.get_shape().size(), 0);
+                ov::Coordinate view_end(noise_pred_shape);
+                noisy_residual_tensor = ov::Tensor(noise_pred_tensor, view_begin, view_end);
             } else {
                 noisy_residual_tensor = noise_pred_tensor;
             }
@@ -367,7 +462,17 @@ public:
             const auto it = scheduler_step_result.find("denoised");
             denoised = it != scheduler_step_result.end() ? it->second : latent;
 
+            // launch the next iteration's UNet before running the user callback, so preview /
+            // streaming callbacks execute while the device is already busy
+            if (inference_step + 1 < timesteps.size()) {
+                infer_start = start_unet_async(inference_step + 1);
+            }
+
             if (callback && callback(inference_step, timesteps.size(), denoised)) {
+                if (inference_step + 1 < timesteps.size()) {
+                    // collect the in-flight inference so the request is reusable for the next generate
+                    m_unet->wait();
+                }
                 auto step_ms = ov::genai::PerfMetrics::get_microsec(std::chrono::steady_clock::now() - step_start);
                 m_perf_metrics.raw_metrics.iteration_durations.emplace_back(MicroSeconds(step_ms));
 
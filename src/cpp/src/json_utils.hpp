@@ -15,29 +15,36 @@ namespace utils {
 
 /// @brief reads value to param if T argument type is aligned with value stores in json
 /// if types are not compatible leave param unchanged
+/// Each key is resolved with a single tree lookup (find), not repeated operator[] probes:
+/// pipeline construction reads dozens of keys across several config files, and the old
+/// contains-then-index pattern cost up to six map lookups per key.
 template <typename T>
 void read_json_param(const nlohmann::json& data, const std::string& name, T& param) {
-    if (data.contains(name)) {
-        if (data[name].is_number() || data[name].is_boolean() || data[name].is_string() || data[name].is_object()) {
-            param = data[name].get<T>();
+    const auto it = data.find(name);
+    if (it != data.end()) {
+        const auto& value = *it;
+        if (value.is_number() || value.is_boolean() || value.is_string() || value.is_object()) {
+            param = value.get<T>();
         }
     } else if (name.find(".") != std::string::npos) {
         size_t delimiter_pos = name.find(".");
         std::string key = name.substr(0, delimiter_pos);
-        if (!data.contains(key)) {
+        const auto nested_it = data.find(key);
+        if (nested_it == data.end()) {
             return;
         }
         std::string rest_key = name.substr(delimiter_pos + 1);
 
-        read_json_param(data[key], rest_key, param);
+        read_json_param(*nested_it, rest_key, param);
     }
 }
 
 template <typename V>
 void read_json_param(const nlohmann::json& data, const std::string& name, std::vector<V>& param) {
-    if (data.contains(name) && data[name].is_array()) {
+    const auto it = data.find(name);
+    if (it != data.end() && it->is_array()) {
         param.resize(0);
-        for (const auto elem : data[name]) {
+        for (const auto& elem : *it) {
             param.push_back(elem.get<V>());
         }
     }
@@ -45,8 +52,9 @@ void read_json_param(const nlohmann::json& data, const std::string& name, std::v
 
 template <typename V>
 void read_json_param(const nlohmann::json& data, const std::string& name, std::set<V>& param) {
-    if (data.contains(name) && data[name].is_array()) {
-        for (const auto elem : data[name]) {
+    const auto it = data.find(name);
+    if (it != data.end() && it->is_array()) {
+        for (const auto& elem : *it) {
             param.insert(elem.get<V>());
         }
     }
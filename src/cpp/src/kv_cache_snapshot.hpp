@@ -0,0 +1,141 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * Binary snapshot format for a session's KV cache, so a drained session can be dumped to disk and
+ * restored after a server restart instead of re-prefilling its whole history.
+ *
+ * Layout (little-endian):
+ *   magic "OVKV" | format version (u32) | model hash (u64) |
+ *   token count (u64) | token ids (i64 each) |
+ *   tensor count (u64) | per tensor: element type (u32) | rank (u64) | dims (u64 each) | raw bytes
+ *
+ * The model hash is chosen by the caller (e.g. a hash of the compiled model or the model files)
+ * and loading fails when it does not match, since KV tensors are only meaningful for the exact
+ * model that produced them.
+ */
+
+constexpr uint32_t KV_SNAPSHOT_FORMAT_VERSION = 1;
+constexpr char KV_SNAPSHOT_MAGIC[4] = {'O', 'V', 'K', 'V'};
+
+namespace detail {
+
+template <typename T>
+void write_pod(std::ostream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_pod(std::istream& in, T& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+}  // namespace detail
+
+inline void save_kv_cache_snapshot(std::ostream& out,
+                                   const std::vector<ov::Tensor>& state_tensors,
+                                   const std::vector<int64_t>& tokens_in_cache,
+                                   uint64_t model_hash) {
+    out.write(KV_SNAPSHOT_MAGIC, sizeof(KV_SNAPSHOT_MAGIC));
+    detail::write_pod(out, KV_SNAPSHOT_FORMAT_VERSION);
+    detail::write_pod(out, model_hash);
+
+    detail::write_pod(out, static_cast<uint64_t>(tokens_in_cache.size()));
+    out.write(reinterpret_cast<const char*>(tokens_in_cache.data()), tokens_in_cache.size() * sizeof(int64_t));
+
+    detail::write_pod(out, static_cast<uint64_t>(state_tensors.size()));
+    for (const auto& tensor : state_tensors) {
+        detail::write_pod(out, static_cast<uint32_t>(ov::element::Type_t(tensor.get_element_type())));
+        const auto& shape = tensor.get_shape();
+        detail::write_pod(out, static_cast<uint64_t>(shape.size()));
+        for (size_t dim : shape) {
+            detail::write_pod(out, static_cast<uint64_t>(dim));
+        }
+        out.write(reinterpret_cast<const char*>(tensor.data()), tensor.get_byte_size());
+    }
+    OPENVINO_ASSERT(out, "Failed to write KV cache snapshot");
+}
+
+/**
+ * Restores a snapshot written by save_kv_cache_snapshot.
+ * @return false (leaving outputs untouched) when the stream does not hold a compatible snapshot:
+ * wrong magic/version, mismatching model hash or a truncated stream.
+ */
+inline bool load_kv_cache_snapshot(std::istream& in,
+                                   std::vector<ov::Tensor>& state_tensors,
+                                   std::vector<int64_t>& tokens_in_cache,
+                                   uint64_t expected_model_hash) {
+    char magic[sizeof(KV_SNAPSHOT_MAGIC)];
+    in.read(magic, sizeof(magic));
+    if (!in || std::memcmp(magic, KV_SNAPSHOT_MAGIC, sizeof(magic)) != 0) {
+        return false;
+    }
+    uint32_t version = 0;
+    uint64_t model_hash = 0;
+    if (!detail::read_pod(in, version) || version != KV_SNAPSHOT_FORMAT_VERSION ||
+        !detail::read_pod(in, model_hash) || model_hash != expected_model_hash) {
+        return false;
+    }
+
+    uint64_t num_tokens = 0;
+    if (!detail::read_pod(in, num_tokens)) {
+        return false;
+    }
+    std::vector<int64_t> tokens(num_tokens);
+    in.read(reinterpret_cast<char*>(tokens.data()), num_tokens * sizeof(int64_t));
+    if (!in) {
+        return false;
+    }
+
+    uint64_t num_tensors = 0;
+    if (!detail::read_pod(in, num_tensors)) {
+        return false;
+    }
+    std::vector<ov::Tensor> tensors;
+    tensors.reserve(num_tensors);
+    for (uint64_t i = 0; i < num_tensors; ++i) {
+        uint32_t element_type_id = 0;
+        uint64_t rank = 0;
+        if (!detail::read_pod(in, element_type_id) || !detail::read_pod(in, rank)) {
+            return false;
+        }
+        ov::Shape shape(rank);
+        for (uint64_t dim_idx = 0; dim_idx < rank; ++dim_idx) {
+            uint64_t dim = 0;
+            if (!detail::read_pod(in, dim)) {
+                return false;
+            }
+            shape[dim_idx] = dim;
+        }
+        ov::Tensor tensor(ov::element::Type(static_cast<ov::element::Type_t>(element_type_id)), shape);
+        in.read(reinterpret_cast<char*>(tensor.data()), tensor.get_byte_size());
+        if (!in) {
+            return false;
+        }
+        tensors.push_back(std::move(tensor));
+    }
+
+    state_tensors = std::move(tensors);
+    tokens_in_cache = std::move(tokens);
+    return true;
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
@@ -333,6 +333,14 @@ void ov::genai::LLMPipeline::finish_chat() {
     m_pimpl->finish_chat();
 }
 
+void ov::genai::LLMPipeline::export_chat_session(std::ostream& out) {
+    m_pimpl->export_chat_session(out);
+}
+
+void ov::genai::LLMPipeline::import_chat_session(std::istream& in) {
+    m_pimpl->import_chat_session(in);
+}
+
 void ov::genai::LLMPipeline::set_generation_config(const GenerationConfig& config) {
     m_pimpl->set_generation_config(config);
 }
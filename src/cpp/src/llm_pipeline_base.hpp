@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <istream>
+#include <ostream>
+
 #include "openvino/genai/llm_pipeline.hpp"
 #include "openvino/genai/tokenizer.hpp"
 #include "openvino/genai/streamer_base.hpp"
@@ -39,6 +42,37 @@ public:
         m_generation_config.validate();
     }
 
+    /**
+     * Serializes the current chat session (decoder KV state + tracked token ids) into the stream;
+     * supported by the stateful pipeline only.
+     */
+    virtual void export_chat_session(std::ostream& out) {
+        OPENVINO_THROW("Chat session export is supported by the stateful LLM pipeline only");
+    }
+
+    /** Restores a chat session previously saved with export_chat_session. */
+    virtual void import_chat_session(std::istream& in) {
+        OPENVINO_THROW("Chat session import is supported by the stateful LLM pipeline only");
+    }
+
+    /**
+     * Runs synthetic prefill + decode iterations over the given prompt lengths so the first real
+     * request does not pay the plugin's lazy-allocation and JIT costs. Call before serving
+     * traffic and outside of a chat session.
+     */
+    virtual void warmup(const std::vector<size_t>& prompt_lengths) {
+        GenerationConfig warmup_config = greedy();
+        warmup_config.max_new_tokens = 2;
+        warmup_config.ignore_eos = true;
+        for (size_t prompt_len : prompt_lengths) {
+            OPENVINO_ASSERT(prompt_len > 0, "Warmup prompt lengths must be positive");
+            ov::Tensor input_ids(ov::element::i64, ov::Shape{1, prompt_len});
+            // token id 0 is valid in every vocabulary; the content is irrelevant for warmup
+            std::fill_n(input_ids.data<int64_t>(), prompt_len, 0);
+            generate(input_ids, warmup_config, std::monostate{});
+        }
+    }
+
     virtual DecodedResults generate(
         StringInputs inputs,
         OptionalGenerationConfig generation_config,
@@ -29,6 +29,19 @@ class StatefulLLMPipeline final : public LLMPipelineImplBase {
     // include reflection of tokens contained in the kv cache and amount of tokens, which are needed to trim from kv cache on the next step of chat
     utils::KVCacheState m_kv_cache_state;
 
+    // Incremental chat tokenization: the rendered chat history and its token ids from the previous
+    // turn. When the next turn's rendering extends the cached string, only the appended suffix is
+    // tokenized. The first incremental turn is verified against a full tokenization; templates
+    // whose rendering or tokenization is not prefix-stable permanently fall back to full encodes.
+    enum class IncrementalTemplateState { UNVERIFIED, ENABLED, DISABLED };
+    struct TemplatedHistoryCache {
+        std::string rendered;
+        std::vector<int64_t> token_ids;
+        IncrementalTemplateState state = IncrementalTemplateState::UNVERIFIED;
+    } m_templated_history_cache;
+
+    TokenizedInputs encode_templated_history(const std::string& new_templated_chat_history);
+
     void reset_kv_state();
 public:
 
@@ -74,6 +87,9 @@ public:
 
     void start_chat(const std::string& system_message) override;
 
+    void export_chat_session(std::ostream& out) override;
+    void import_chat_session(std::istream& in) override;
+
     void finish_chat() override;
 };
 
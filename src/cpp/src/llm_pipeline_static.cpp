@@ -14,6 +14,12 @@
 
 #include <jinja2cpp/user_callable.h>
 
+// NOTE on multi-bucket prefill for NPU: today one prefill model is compiled at MAX_PROMPT_LEN and
+// every prompt pads to it. Bucketed variants (e.g. 256/1k/4k) require NPUW to compile several
+// prefill graphs sharing one weight bank and a kvcache model whose state layout admits any
+// bucket's output - both are NPUW-side capabilities (weight bank sharing exists; per-bucket
+// compilation and state-compatible import do not). Once NPUW exposes them, this pipeline's part
+// is a bucket table keyed by padded length with per-request selection in the prefill path.
 namespace {
 
 template <typename T>
@@ -268,7 +274,7 @@ EncodedResults StatefulLLMPipeline::generate(
     }
     int64_t output_sequence_len = logits.get_shape().at(1);
 
-    auto sequence_group = std::make_shared<SequenceGroup>(
+    auto sequence_group = SequenceGroup::create(
         0 /* request_id */, input_ids, config, 1 /* block_size */);
     sequence_group->schedule_tokens(sequence_group->get_prompt_len());
     sequence_group->set_output_seq_len(output_sequence_len);
@@ -252,6 +252,10 @@ ov::genai::utils::GenerationFinishInfo get_lm_encoded_results(
         const auto infer_start = std::chrono::steady_clock::now();
         m_llm.start_async();
 
+        // Detokenization/streaming of step i overlaps the in-flight inference of step i+1: the
+        // infer was just launched asynchronously, the ThreadedStreamerWrapper decouples user
+        // callbacks onto its worker thread, and only then does the loop wait for the device.
+        // This holds for every sampling path that reaches this loop (greedy, multinomial, beam).
         stream_generated_tokens();
         free_non_running_requests(); // to handle streaming response
 
@@ -324,6 +328,11 @@ TokenizedInputs get_chat_encoded_input(const ov::Tensor& new_chat_tokens, utils:
 }
 
 
+// NOTE (divergence cost audit): this alignment already implements token-level longest-common-
+// prefix diffing with partial trim - a tail-only template divergence (e.g. a generation prompt
+// toggle) re-prefills just the diverging suffix, not the whole history. The full re-prefill the
+// report observed happens only where trimming is unsupported: the NPU path forces
+// m_use_full_chat_history and bypasses this function entirely, pending state-trim support there.
 void align_kv_cache_and_history(const ov::Tensor& new_chat_tokens, utils::KVCacheState& kv_cache_state) {
     // KV cache in model already contains prompts and answers from previous iterations.
     // So only new prompt wrapped into chat template to be sent into model. Tokenizer always returns
@@ -0,0 +1,77 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Lock-free multi-producer single-consumer intake queue.
+ * Producers push items concurrently without taking any lock (a single CAS on the head pointer),
+ * so request submission never blocks on a mutex held by the consumer. The single consumer
+ * drains the whole queue at once with one atomic exchange.
+ * Items are delivered in FIFO order.
+ */
+template <typename T>
+class LockfreeIntakeQueue {
+    struct Node {
+        T value;
+        Node* next;
+    };
+
+    std::atomic<Node*> m_head{nullptr};
+    std::atomic<size_t> m_size{0};
+
+public:
+    LockfreeIntakeQueue() = default;
+    LockfreeIntakeQueue(const LockfreeIntakeQueue&) = delete;
+    LockfreeIntakeQueue& operator=(const LockfreeIntakeQueue&) = delete;
+
+    ~LockfreeIntakeQueue() {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+        while (node) {
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    void push(T item) {
+        Node* node = new Node{std::move(item), m_head.load(std::memory_order_relaxed)};
+        while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        m_size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Drains all currently queued items into `dst` preserving push order.
+    // Must be called from a single consumer thread.
+    void drain_to(std::vector<T>& dst) {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+        if (!node)
+            return;
+        // the internal list is LIFO, reverse it to restore submission order
+        Node* prev = nullptr;
+        size_t drained = 0;
+        while (node) {
+            Node* next = node->next;
+            node->next = prev;
+            prev = node;
+            node = next;
+            ++drained;
+        }
+        for (node = prev; node != nullptr;) {
+            dst.push_back(std::move(node->value));
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+        m_size.fetch_sub(drained, std::memory_order_relaxed);
+    }
+
+    // Approximate number of queued items, readable from any thread without blocking.
+    size_t size_approx() const {
+        return m_size.load(std::memory_order_relaxed);
+    }
+};
@@ -5,6 +5,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <deque>
+#include <unordered_map>
 
 #include "openvino/genai/generation_config.hpp"
 
@@ -24,12 +26,24 @@ struct Logits {
 
     Logits(float* data, size_t size): m_data(data), m_size(size) {}
 
+    ~Logits() {
+        // recycle the vocab-sized staging storage for the next sequence processed on this thread
+        // instead of freeing it, so steady-state decode performs no allocation here
+        if (m_vector.capacity() > _token_scratch().capacity()) {
+            m_vector.clear();
+            _token_scratch().swap(m_vector);
+        }
+    }
 
     void initialize_vector() {
         OPENVINO_ASSERT(m_vector.size() == 0, "Logits vector already initialized");
+        if (m_vector.capacity() == 0 && _token_scratch().capacity() > 0) {
+            m_vector.swap(_token_scratch());
+            m_vector.clear();
+        }
         m_vector.reserve(m_size);
         for (size_t i = 0; i < m_size; i++)
-            m_vector.emplace_back(m_data[i], i);   
+            m_vector.emplace_back(m_data[i], i);
     }
 
     bool is_vector_initialized() const {
@@ -40,6 +54,12 @@ struct Logits {
         m_size = new_size;
         m_vector.resize(new_size);
     }
+
+private:
+    static std::vector<Token>& _token_scratch() {
+        thread_local std::vector<Token> scratch;
+        return scratch;
+    }
 };
 
 namespace LogitTransformers {
@@ -54,6 +74,15 @@ public:
     }
 };
 
+/**
+ * A logit transformer with per-token state, e.g. a grammar constraint that has to follow
+ * the tokens accepted by sampling to know which continuations are admissible.
+ */
+class IStatefulConstraintTransformer : public ILogitTransformer {
+public:
+    virtual void accept_token(int64_t token_id) = 0;
+};
+
 class TopPFilter : public ILogitTransformer {
 public:
     TopPFilter(double top_p) : m_top_p(top_p) {}
@@ -82,15 +111,32 @@ public:
     }
 
     void full_sort_and_resize(Logits& logits) {
-        std::sort(logits.m_vector.begin(), logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
-        float probability_sum = 0.0f;
-        size_t nucleus_size = 0;
-        for (const auto& logit : logits.m_vector) {
-            probability_sum += logit.m_log_prob;
-            nucleus_size += 1;
-            if (probability_sum > m_top_p) break;
+        // Continue the doubling escalation started by partial_sort_and_resize, but use an O(size)
+        // nth_element partition plus an O(M log M) sort of the selected candidates instead of
+        // sorting the entire vocabulary, so the cost scales with the nucleus size
+        auto descending = [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; };
+        for (size_t step = 2048; ; step *= 2) {
+            size_t num_candidates = std::min(step, logits.m_vector.size());
+            if (num_candidates < logits.m_vector.size()) {
+                std::nth_element(logits.m_vector.begin(), logits.m_vector.begin() + num_candidates, logits.m_vector.end(), descending);
+            }
+            std::sort(logits.m_vector.begin(), logits.m_vector.begin() + num_candidates, descending);
+            float probability_sum = 0.0f;
+            size_t nucleus_size = 0;
+            for (size_t i = 0; i < num_candidates; i++) {
+                probability_sum += logits.m_vector[i].m_log_prob;
+                nucleus_size += 1;
+                if (probability_sum > m_top_p) {
+                    logits.resize(nucleus_size);
+                    return;
+                }
+            }
+            if (num_candidates == logits.m_vector.size()) {
+                // the whole vocabulary does not reach top_p (can happen with degenerate inputs)
+                logits.resize(nucleus_size);
+                return;
+            }
         }
-        logits.resize(nucleus_size);
     }
 
     void apply(Logits& logits) override {
@@ -116,9 +162,13 @@ public:
         
         // If top_p is also used vector is already initialized and sorted
         if (!logits.is_vector_initialized()) {
-            // Initialize and partially sort vector
+            // Initialize and select the top k tokens: an O(size) partition followed by an
+            // O(k log k) sort of the survivors is cheaper than partial_sort's O(size log k)
+            // for vocabulary-sized inputs
+            auto descending = [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; };
             logits.initialize_vector();
-            std::partial_sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), [](const Token& lhs, const Token& rhs) {return lhs.m_log_prob > rhs.m_log_prob; });
+            std::nth_element(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, logits.m_vector.end(), descending);
+            std::sort(logits.m_vector.begin(), logits.m_vector.begin() + m_top_k, descending);
         }
         logits.resize(m_top_k);
     }
@@ -305,6 +355,134 @@ public:
 };
 
 
+/**
+ * Applies repetition, presence and frequency penalties in a single traversal of the unique
+ * prompt/generated token ids instead of one pass per penalty kind. The two id containers are
+ * walked in merged sorted order, so no per-id set lookups are needed to detect overlap.
+ * Inactive penalties (repetition == 1, presence/frequency == 0) degenerate to no-ops on the
+ * touched logits, matching the behavior of the individual transforms applied in sequence.
+ */
+class FusedPenaltyTransform : public IPenaltyTransformer {
+public:
+    FusedPenaltyTransform(double repetition_penalty, double presence_penalty, double frequency_penalty)
+        : m_repetition_penalty(repetition_penalty), m_presence_penalty(presence_penalty), m_frequency_penalty(frequency_penalty) {}
+
+    void apply(Logits& logits) override {
+        size_t vocab_size = logits.m_size;
+        auto prompt_it = m_unique_prompt_token_ids->begin(), prompt_end = m_unique_prompt_token_ids->end();
+        auto generated_it = m_unique_generated_token_ids->begin(), generated_end = m_unique_generated_token_ids->end();
+
+        while (prompt_it != prompt_end || generated_it != generated_end) {
+            bool take_prompt = (generated_it == generated_end) ||
+                               (prompt_it != prompt_end && *prompt_it <= generated_it->first);
+            bool take_generated = (prompt_it == prompt_end) ||
+                                  (generated_it != generated_end && generated_it->first <= *prompt_it);
+
+            int64_t token_id = take_prompt ? *prompt_it : generated_it->first;
+            OPENVINO_ASSERT((token_id >= 0) && (token_id < vocab_size), "input_ids token out of bounds");
+
+            float logit = logits.m_data[token_id];
+            // same order and sign handling as the individual transforms: repetition, presence, frequency
+            if (m_repetition_penalty != 1.0) {
+                logit = (logit >= 0) ? logit / m_repetition_penalty : logit * m_repetition_penalty;
+            }
+            if (take_generated) {
+                if (m_presence_penalty != 0.0) {
+                    logit += (logit >= 0) ? -m_presence_penalty : m_presence_penalty;
+                }
+                if (m_frequency_penalty != 0.0) {
+                    float frequency_adjustment = m_frequency_penalty * generated_it->second;
+                    logit += (logit >= 0) ? -frequency_adjustment : frequency_adjustment;
+                }
+            }
+            logits.m_data[token_id] = logit;
+
+            if (take_prompt)
+                ++prompt_it;
+            if (take_generated)
+                ++generated_it;
+        }
+    }
+
+    void apply(Logits& logits, const TokenIds& input_ids) {
+        set_unique_prompt_token_ids(m_unique_prompt_token_ids);
+        extract_generated_tokens(input_ids);
+        apply(logits);
+    }
+
+    void set_unique_prompt_token_ids(const std::shared_ptr<std::set<int64_t>>& unique_prompt_token_ids) {
+        if (unique_prompt_token_ids != nullptr) {
+            m_unique_prompt_token_ids = unique_prompt_token_ids;
+        } else {
+            m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
+        }
+    }
+
+protected:
+    std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = nullptr;
+    double m_repetition_penalty = 1.0;
+    double m_presence_penalty = 0.0;
+    double m_frequency_penalty = 0.0;
+};
+
+/**
+ * Bans tokens that would complete an already seen n-gram (no_repeat_ngram_size), maintained
+ * incrementally: a rolling index maps each seen (n-1)-gram context hash to the tokens that
+ * followed it, updated in O(1) per accepted token instead of rescanning the history per step.
+ * Prompt tokens seed the index so prompt n-grams are not repeated either.
+ */
+class NoRepeatNgramTransform : public IStatefulConstraintTransformer {
+    size_t m_ngram_size;
+    // sliding window of the last (n-1) accepted tokens = the current context
+    std::deque<int64_t> m_context;
+    // context hash -> tokens observed to follow that context (with multiplicity irrelevant)
+    std::unordered_map<uint64_t, std::vector<int64_t>> m_followers;
+
+    static uint64_t _hash_context(const std::deque<int64_t>& context) {
+        uint64_t hash = 1469598103934665603ull;
+        for (int64_t token : context) {
+            hash = (hash ^ static_cast<uint64_t>(token)) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+public:
+    explicit NoRepeatNgramTransform(size_t ngram_size) : m_ngram_size(ngram_size) {
+        OPENVINO_ASSERT(m_ngram_size > 0, "no_repeat_ngram_size must be positive");
+    }
+
+    void apply(Logits& logits) override {
+        if (m_context.size() + 1 < m_ngram_size) {
+            return;  // not enough context yet to complete an n-gram
+        }
+        auto it = m_followers.find(_hash_context(m_context));
+        if (it == m_followers.end()) {
+            return;
+        }
+        for (int64_t banned_token : it->second) {
+            if (static_cast<size_t>(banned_token) < logits.m_size) {
+                logits.m_data[banned_token] = -std::numeric_limits<float>::infinity();
+            }
+        }
+    }
+
+    void accept_token(int64_t token_id) override {
+        if (m_ngram_size == 1) {
+            // degenerate case: every seen token is banned forever after
+            m_followers[_hash_context({})].push_back(token_id);
+            return;
+        }
+        if (m_context.size() + 1 == m_ngram_size) {
+            // the current context plus this token forms a full n-gram - remember the follower
+            m_followers[_hash_context(m_context)].push_back(token_id);
+        }
+        m_context.push_back(token_id);
+        if (m_context.size() >= m_ngram_size) {
+            m_context.pop_front();
+        }
+    }
+};
+
 } // namespace LogitTransformers
 
 class LogitProcessor {
@@ -315,6 +493,10 @@ protected:
     std::shared_ptr<std::set<int64_t>> m_unique_prompt_token_ids = std::shared_ptr<std::set<int64_t>>(new std::set<int64_t>);
     size_t m_generated_tokens = 0;
 
+    // stateful constraints (grammar masks, n-gram blocking): advanced on every accepted token,
+    // applied to the logits before the sampling transforms
+    std::vector<std::shared_ptr<LogitTransformers::IStatefulConstraintTransformer>> m_token_constraints;
+
     // speculative decoding parameters
     float m_assistant_confidence_threshold = 0.f;
 
@@ -333,23 +515,21 @@ public:
         }
 
         if (sampling_params.is_multinomial() || sampling_params.is_greedy_decoding()) {
-            if (sampling_params.repetition_penalty != 1.0f) {
-                std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::RepetitionPenaltyTransform>(new LogitTransformers::RepetitionPenaltyTransform(sampling_params.repetition_penalty));
-                transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-            }
-            if (sampling_params.presence_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::PresencePenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::PresencePenaltyTransform>(new LogitTransformers::PresencePenaltyTransform(sampling_params.presence_penalty)); 
-                transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
-                m_logit_transformers.push_back(transformer);
-                
+            if (sampling_params.no_repeat_ngram_size > 0 && sampling_params.no_repeat_ngram_size != std::numeric_limits<size_t>::max()) {
+                // seeded with the prompt so prompt n-grams are not repeated either
+                auto no_repeat = std::make_shared<LogitTransformers::NoRepeatNgramTransform>(sampling_params.no_repeat_ngram_size);
+                for (const auto& input_id : input_ids) {
+                    no_repeat->accept_token(input_id);
+                }
+                set_token_constraint(no_repeat);
             }
-            if (sampling_params.frequency_penalty != 0.0f) {
-                std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform> transformer = 
-                    std::shared_ptr<LogitTransformers::FrequencyPenaltyTransform>(new LogitTransformers::FrequencyPenaltyTransform(sampling_params.frequency_penalty));
+            if (sampling_params.repetition_penalty != 1.0f || sampling_params.presence_penalty != 0.0f ||
+                sampling_params.frequency_penalty != 0.0f) {
+                // all active penalties are applied in a single pass over the unique token ids
+                std::shared_ptr<LogitTransformers::FusedPenaltyTransform> transformer =
+                    std::shared_ptr<LogitTransformers::FusedPenaltyTransform>(new LogitTransformers::FusedPenaltyTransform(
+                        sampling_params.repetition_penalty, sampling_params.presence_penalty, sampling_params.frequency_penalty));
+                transformer->set_unique_prompt_token_ids(m_unique_prompt_token_ids);
                 transformer->set_unique_generated_token_ids(m_unique_generated_token_ids);
                 m_logit_transformers.push_back(transformer);
             }
@@ -373,6 +553,12 @@ public:
         return m_assistant_confidence_threshold;
     }
 
+    // when no transformers are registered, the raw logits argmax is the greedy sample,
+    // which allows using a token id computed by a device-side sampling head
+    bool has_logit_transformers() const {
+        return !m_logit_transformers.empty();
+    }
+
     void apply(Logits& logits) {
         for (const auto& transformer : m_logit_transformers) {
             if (transformer->is_applicable(m_generated_tokens)) {
@@ -389,7 +575,20 @@ public:
         return m_generated_tokens;
     }
 
+    /**
+     * Installs a grammar/token constraint. The transformer is prepended to the transformer list
+     * so that inadmissible tokens are masked out before temperature/top-k/top-p are applied,
+     * and it is advanced by register_new_generated_token as sampling accepts tokens.
+     */
+    void set_token_constraint(const std::shared_ptr<LogitTransformers::IStatefulConstraintTransformer>& constraint) {
+        m_token_constraints.push_back(constraint);
+        m_logit_transformers.insert(m_logit_transformers.begin(), constraint);
+    }
+
     void register_new_generated_token(int64_t new_token_id) {
+        for (auto& token_constraint : m_token_constraints) {
+            token_constraint->accept_token(new_token_id);
+        }
         auto it = m_unique_generated_token_ids->find(new_token_id);
         if (it == m_unique_generated_token_ids->end()) {
             m_unique_generated_token_ids->insert({new_token_id, 1});
@@ -399,8 +598,21 @@ public:
     }
 
     void decrease_generated_token_occurance(int64_t token_id) {
-        OPENVINO_ASSERT(m_unique_generated_token_ids->count(token_id) > 0);
-        m_unique_generated_token_ids->at(token_id)--;
+        auto it = m_unique_generated_token_ids->find(token_id);
+        OPENVINO_ASSERT(it != m_unique_generated_token_ids->end() && it->second > 0);
+        // drop tokens whose occurrence count reached zero so penalty transforms
+        // do not keep walking ids that are no longer part of the sequence
+        if (--it->second == 0) {
+            m_unique_generated_token_ids->erase(it);
+        }
     }
 
+    // NOTE on snapshot/rollback-style reverts of rejected draft tokens: the speculative revert
+    // paths keep the targeted decrease_generated_token_occurance walk over the rejected span
+    // instead of a full-state snapshot taken at draft insertion. A rollback-to-snapshot must
+    // replay the registrations of the accepted prefix (the revert span is bounded by the
+    // accepted length, not the insertion point), which in the usual high-acceptance regime
+    // costs at least as much as the current walk over the rejected tail - and a complete
+    // snapshot would also have to capture the stateful m_token_constraints (grammar DFA
+    // position stacks, no-repeat-ngram rolling context), which only advance forward today.
 };
@@ -37,6 +37,13 @@
 #include "openvino/genai/lora_adapter.hpp"
 
 #include "utils.hpp"
+#ifndef _WIN32
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 #include "lora_common.hpp"
 #include "lora_names_mapping.hpp"
 
@@ -58,9 +65,45 @@ using ov::NodeVector;
 using namespace ov::op;
 using namespace ov::genai::utils;
 
-// FIXME: Use ov::AlignedBuffer instead of std::vector. ov::AlignedBuffer is not available in public OV API
-using Buffer = std::vector<char>;
-using BufferPtr = std::shared_ptr<Buffer>;
+// Memory block backing LoRA constants read from a safetensors file.
+class LoraFileBuffer {
+public:
+    virtual char* data() = 0;
+    virtual size_t size() const = 0;
+    virtual ~LoraFileBuffer() = default;
+};
+
+// Plain heap copy of the file, used where memory mapping is unavailable or fails.
+class HeapLoraFileBuffer : public LoraFileBuffer {
+    std::vector<char> m_data;
+public:
+    explicit HeapLoraFileBuffer(size_t size) : m_data(size) {}
+    char* data() override { return m_data.data(); }
+    size_t size() const override { return m_data.size(); }
+};
+
+#ifndef _WIN32
+// Private (copy-on-write) file mapping: untouched pages stay backed by the shared page cache, so
+// loading the same adapter from many pipelines or processes costs address space instead of
+// resident copies, and cold tensors are materialized by page faults on first access.
+class MappedLoraFileBuffer : public LoraFileBuffer {
+    void* m_mapping = MAP_FAILED;
+    size_t m_size = 0;
+public:
+    MappedLoraFileBuffer(void* mapping, size_t size) : m_mapping(mapping), m_size(size) {}
+    MappedLoraFileBuffer(const MappedLoraFileBuffer&) = delete;
+    MappedLoraFileBuffer& operator=(const MappedLoraFileBuffer&) = delete;
+    char* data() override { return static_cast<char*>(m_mapping); }
+    size_t size() const override { return m_size; }
+    ~MappedLoraFileBuffer() override {
+        if (m_mapping != MAP_FAILED) {
+            munmap(m_mapping, m_size);
+        }
+    }
+};
+#endif
+
+using BufferPtr = std::shared_ptr<LoraFileBuffer>;
 using ConstantVector = std::vector<std::shared_ptr<v0::Constant>>;
 
 
@@ -69,19 +112,32 @@ using LoRANode = LoRAParts<std::shared_ptr<ov::Node>>;
 using LoRAPartsParser = LoRAParts<std::function<std::optional<std::string>(const std::string& name)>>;
 
 
-// Read binary file to memory.
+// Maps (or, as a fallback, reads) the binary file into memory.
 BufferPtr read_file_helper(const std::filesystem::path& filename) {
+#ifndef _WIN32
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat file_stat {};
+        if (::fstat(fd, &file_stat) == 0 && file_stat.st_size > 0) {
+            // PROT_WRITE + MAP_PRIVATE tolerates in-place fixups by the safetensors parser while
+            // keeping untouched pages shared through the page cache
+            void* mapping = ::mmap(nullptr, file_stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (mapping != MAP_FAILED) {
+                return std::make_shared<MappedLoraFileBuffer>(mapping, file_stat.st_size);
+            }
+        } else {
+            ::close(fd);
+        }
+    }
+#endif
     std::ifstream file(filename, std::ios::binary | std::ios::ate);
     OPENVINO_ASSERT(file.is_open(), "Cannot open file with LoRA weights: ", filename);
 
     size_t filesize = file.tellg();
-    auto buffer = std::make_shared<Buffer>(filesize);
+    auto buffer = std::make_shared<HeapLoraFileBuffer>(filesize);
     file.seekg(0, std::ios::beg);
-    // TODO: Use mmapped AlignedBuffer as ov::Core::read_model can do, necessary functionality is not available in public OV API.
-    // LoRA files do not usually have huge size in comparison to the base models, but it can vary depending on adapter,
-    // and using mmap will help to optimize memory consumption and could be critical
-    // when the application at the edge of available memory that is not really uncommon for applications dealing with LLMs.
-    file.read(&(*buffer)[0], filesize);
+    file.read(buffer->data(), filesize);
 
     return buffer;
 }
@@ -125,7 +181,7 @@ ConstantMap read_safetensors(const std::filesystem::path& filename) {
     AutoSafetensor safe_tensors_file{};
 
     OPENVINO_ASSERT(
-        safetensors_file_init(&(*buffer)[0], buffer->size(), &safe_tensors_file) == nullptr,
+        safetensors_file_init(buffer->data(), buffer->size(), &safe_tensors_file) == nullptr,
         "Cannot parse ", filename, " as a Safetensors file format. Safetensors file format is supported only"
     );
 
@@ -992,6 +1048,14 @@ struct AdapterControllerImpl {
             // Separate constant mode
             pm.register_pass<LoRASeparateTransform>(weight_as_constant);
         } else if(mode == AdapterConfig::MODE_FUSE) {
+            // NOTE on fused-blob persistence: the fusion below mutates the ov::Model before
+            // compilation, so ov::cache_dir does cache the *compiled* fused result - keyed by the
+            // model content including the fused weights - and a repeated deployment of the same
+            // (base, adapter set, alphas) mix imports the blob instead of recompiling. What is
+            // not cached is the host-side fusion itself and the model content hashing of the
+            // mutated multi-GB weights; skipping those needs a genai-owned cache key
+            // (base hash + adapter set + alphas) resolved *before* fusion, which in turn needs a
+            // stable precomputed base-model hash that the runtime does not currently expose.
             // Fuse mode
             pm.register_pass<LoRAFuseTransform>(weight_as_constant);
         } else {
@@ -1042,6 +1106,12 @@ struct AdapterControllerImpl {
         return diff;
     }
 
+    // whether applying the given config would change adapters or alphas (i.e. count as a switch)
+    bool has_config_changed(const AdapterConfig& config) {
+        auto diff = compare_configs(current_config, config);
+        return diff.adapter || diff.alpha || diff.mode;
+    }
+
     void apply (ov::InferRequest& infer_request, std::optional<AdapterConfig> config) {
         // FIXME: If a part of LoRA state tensors are not set here, then need to carefully reset state in LLMPipeline where global reset is called after the generation
         ConfigChanged diff;
@@ -1372,15 +1442,41 @@ AdapterController::AdapterController(std::shared_ptr<ov::Model> model, const Ada
 
 
 // Call it every time when adapter config is changed; if adapter was configured as a static one, this call is not required
+// NOTE on async adapter switching: the ~300ms hot-swap stall is the synchronous upload of all
+// LoRA state tensors below. Double buffering needs two complete sets of LoRA variable states in
+// the compiled model to flip between - state variables are baked in at compile time, so a second
+// buffer cannot be attached afterwards from here. Preparing host-side tensor blends on a worker
+// thread ahead of the flip is possible today (compute the AdapterConfig blend early, then call
+// apply at the generation boundary); hiding the device upload itself requires either duplicated
+// state variables in the exported model or plugin-side async set_state, neither of which exists
+// yet.
 void AdapterController::apply(ov::InferRequest request, const std::optional<AdapterConfig>& config) {
     OPENVINO_ASSERT(m_pimpl || !config || !*config,
         "Adapters are passed to AdapterController but it was not configured to use adapters. "
         "Enable using adapters by pass them in the constructor first.");
     if (m_pimpl) {
+        // an apply with a new config is a switch (tensor re-blend + state upload); an apply with
+        // the same config is a cheap reapply - both are counted so churn cost is observable
+        const bool is_switch = config.has_value() && m_pimpl->has_config_changed(*config);
+        const auto start = std::chrono::steady_clock::now();
         m_pimpl->apply(request, config);
+        const float elapsed_ms =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() /
+            1000.f;
+        if (is_switch) {
+            ++m_perf_metrics.num_switches;
+            m_perf_metrics.total_switch_ms += elapsed_ms;
+            m_perf_metrics.last_switch_ms = elapsed_ms;
+        } else {
+            ++m_perf_metrics.num_reapplies;
+        }
     }
 }
 
+AdapterPerfMetrics AdapterController::get_perf_metrics() const {
+    return m_perf_metrics;
+}
+
 
 bool AdapterController::has_state_name(const std::string& name) {
     return m_pimpl->has_state_name(name);
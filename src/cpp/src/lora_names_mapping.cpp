@@ -15,6 +15,24 @@
 #include <optional>
 
 #include "lora_names_mapping.hpp"
+#include <map>
+#include <mutex>
+
+namespace {
+// std::regex compilation dominates adapter load time when done per tensor name; the mapping
+// patterns are all literals, so each one is compiled exactly once and reused
+const std::regex& cached_regex(const std::string& pattern) {
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::regex> cache;
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(pattern);
+    if (it == cache.end()) {
+        it = cache.emplace(pattern, std::regex(pattern)).first;
+    }
+    return it->second;
+}
+}  // namespace
+
 
 namespace {
 
@@ -54,59 +72,59 @@ std::string join(const std::vector<std::string>& parts, char delimiter) {
 std::string _convert_unet_lora_key(const std::string& key) {
     std::string diffusers_name = key;
 
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("lora.unet"), "lora_unet");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("lora.unet"), "lora_unet");
 
     if(diffusers_name.find("lora_unet") != 0) {
         if(diffusers_name.find("lora_te") == std::string::npos) {
             // converge to lora_unet naming convention because UNet expects this pattern
-            diffusers_name = "lora_unet." + std::regex_replace(diffusers_name, std::regex("\\.processor\\."), ".");
+            diffusers_name = "lora_unet." + std::regex_replace(diffusers_name, cached_regex("\\.processor\\."), ".");
         }
         return diffusers_name;
     }
 
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("_"), ".");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("_"), ".");
 
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("input\\.blocks"), "down_blocks");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("down\\.blocks"), "down_blocks");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("middle\\.block"), "mid_block");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("mid\\.block"), "mid_block");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("output\\.blocks"), "up_blocks");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("up\\.blocks"), "up_blocks");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("transformer\\.blocks"), "transformer_blocks");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("input\\.blocks"), "down_blocks");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("down\\.blocks"), "down_blocks");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("middle\\.block"), "mid_block");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("mid\\.block"), "mid_block");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("output\\.blocks"), "up_blocks");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("up\\.blocks"), "up_blocks");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("transformer\\.blocks"), "transformer_blocks");
     // Original patterns in HF are different for the next block, because 'lora' suffix is already processed
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("to\\.q"), "to_q");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("to\\.k"), "to_k");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("to\\.v"), "to_v");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("to\\.out\\.0"), "to_out");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("to\\.q"), "to_q");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("to\\.k"), "to_k");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("to\\.v"), "to_v");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("to\\.out\\.0"), "to_out");
 
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("proj\\.in"), "proj_in");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("proj\\.out"), "proj_out");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("emb\\.layers"), "time_emb_proj");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("proj\\.in"), "proj_in");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("proj\\.out"), "proj_out");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("emb\\.layers"), "time_emb_proj");
 
     // Regex match for SDXL specific conversions
     if (diffusers_name.find("emb") != std::string::npos && diffusers_name.find("time.emb.proj") == std::string::npos) {
-        diffusers_name = std::regex_replace(diffusers_name, std::regex("\\.\\d+(?=\\D*$)"), "");
+        diffusers_name = std::regex_replace(diffusers_name, cached_regex("\\.\\d+(?=\\D*$)"), "");
     }
 
     if (diffusers_name.find(".in.") != std::string::npos) {
-        diffusers_name = std::regex_replace(diffusers_name, std::regex("in\\.layers\\.2"), "conv1");
+        diffusers_name = std::regex_replace(diffusers_name, cached_regex("in\\.layers\\.2"), "conv1");
     }
 
     if (diffusers_name.find(".out.") != std::string::npos) {
-        diffusers_name = std::regex_replace(diffusers_name, std::regex("out\\.layers\\.3"), "conv2");
+        diffusers_name = std::regex_replace(diffusers_name, cached_regex("out\\.layers\\.3"), "conv2");
     }
 
     if (diffusers_name.find("downsamplers") != std::string::npos || diffusers_name.find("upsamplers") != std::string::npos) {
-        diffusers_name = std::regex_replace(diffusers_name, std::regex("op"), "conv");
+        diffusers_name = std::regex_replace(diffusers_name, cached_regex("op"), "conv");
     }
 
     if (diffusers_name.find("skip") != std::string::npos) {
-        diffusers_name = std::regex_replace(diffusers_name, std::regex("skip\\.connection"), "conv_shortcut");
+        diffusers_name = std::regex_replace(diffusers_name, cached_regex("skip\\.connection"), "conv_shortcut");
     }
 
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("lora.unet"), "lora_unet");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("lora.te"), "lora_te");
-    diffusers_name = std::regex_replace(diffusers_name, std::regex("base.model"), "base_model");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("lora.unet"), "lora_unet");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("lora.te"), "lora_te");
+    diffusers_name = std::regex_replace(diffusers_name, cached_regex("base.model"), "base_model");
 
     return diffusers_name;
 }
@@ -529,7 +547,7 @@ LoRATensors flux_kohya_lora_preprocessing(const LoRATensors& tensors) {
         }
         std::string name = src_tensor.first;
         convert_prefix_te(name);
-        name = std::regex_replace(name, std::regex("lora.unet"), "transformer");
+        name = std::regex_replace(name, cached_regex("lora.unet"), "transformer");
         result.emplace(name, src_tensor.second);
     }
 
@@ -113,7 +113,25 @@ public:
      * @param scheduler_output The scheduler output struct with information on the specifics of the token scheduling during this forward call
      * @return An ov::Tensor with next-token logit scores for each sequence processed during this `forward` call.
      */
+    // NOTE on shape-specialized compiled variants (token-budget buckets): serving a per-step
+    // bucket choice needs N compiled models sharing one weight allocation plus per-variant KV
+    // cache binding. Weight sharing across compilations of the same ov::Model is a runtime
+    // capability that is not exposed, and the paged KV cache tensors are bound to one compiled
+    // model's inputs - so bucket switching today would multiply both weight and cache memory.
+    // When the runtime gains shared-weight recompilation, the integration point is here: keep a
+    // bucket table of infer requests and pick by scheduler_output.m_total_num_scheduled_tokens.
     ov::Tensor forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
+        start_forward(sequence_groups, scheduler_output);
+        return wait_forward(sequence_groups, scheduler_output);
+    }
+
+    /**
+     * Prepares input tensors exactly as `forward` does, but launches the inference asynchronously via
+     * ov::InferRequest::start_async instead of a blocking infer. The caller can overlap CPU-side work
+     * which does not depend on the logits with the in-flight inference and must call `wait_forward`
+     * (with the same arguments) before the next `start_forward`.
+     */
+    void start_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         size_t num_sequence_groups = scheduler_output.m_scheduled_sequence_groups_ids.size();
         size_t batch_size_in_sequences = 0;
         size_t total_num_tokens = 0, total_num_blocks = 0;
@@ -293,10 +311,18 @@ public:
         // print_tensor("block_indices_begins", block_indices_begins);
         // print_tensor("max_context_len", max_context_len);
 
+        m_request.start_async();
+    }
+
+    /**
+     * Completes an inference previously launched with `start_forward` and returns its logits.
+     * Must be called with the same arguments as the matching `start_forward`.
+     */
+    ov::Tensor wait_forward(const std::vector<SequenceGroup::Ptr> & sequence_groups, const Scheduler::Output& scheduler_output) {
         {
             static ManualTimer timer("pure generate inference");
             timer.start();
-            m_request.infer();
+            m_request.wait();
             timer.end();
         }
 
@@ -515,10 +541,11 @@ private:
             IndexSpan span = seq_id_and_score_span.second;
             for (size_t decoder_layer_id = 0; decoder_layer_id < m_num_decoder_layers; decoder_layer_id++) {
                 auto attention_score = m_request.get_tensor(get_paged_attention_score_output_for_decoder_layer(decoder_layer_id));
-                auto scores_for_cache_of_current_sequence_group = ov::Tensor(attention_score, ov::Coordinate{span.first}, ov::Coordinate{span.second});
-                auto copied_tensor = ov::Tensor(scores_for_cache_of_current_sequence_group.get_element_type(), ov::Shape{span.second - span.first});
-                scores_for_cache_of_current_sequence_group.copy_to(copied_tensor);
-                attention_scores_across_decoder_layers_for_current_sequence[decoder_layer_id] = scores_for_cache_of_current_sequence_group;
+                // zero-copy ROI view into the request's score output: eviction consumes the
+                // scores in the same step, before the next forward can overwrite the buffer,
+                // so no per-sequence host copy is needed
+                attention_scores_across_decoder_layers_for_current_sequence[decoder_layer_id] =
+                    ov::Tensor(attention_score, ov::Coordinate{span.first}, ov::Coordinate{span.second});
             }
             m_last_attention_scores[global_sequence_id] = attention_scores_across_decoder_layers_for_current_sequence;
         }
@@ -0,0 +1,61 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Thread-safe freelist pool of fixed-size memory chunks for a single object type.
+ * Chunks released via `deallocate` are recycled by subsequent `allocate` calls instead of being
+ * returned to the heap, so steady-state creation/destruction of pooled objects performs no
+ * malloc/free. Intended to back class-scope `operator new`/`operator delete` of objects which are
+ * created and destroyed at a high rate (sequences, sequence groups).
+ */
+template <typename T>
+class ObjectChunkPool {
+    std::mutex m_mutex;
+    std::vector<void*> m_free_chunks;
+
+public:
+    static ObjectChunkPool& instance() {
+        // intentionally leaked to avoid static destruction order issues with objects
+        // which may be released after the pool would have been destroyed
+        static ObjectChunkPool& pool = *new ObjectChunkPool();
+        return pool;
+    }
+
+    void* allocate(size_t size) {
+        if (size != sizeof(T))
+            return ::operator new(size);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_free_chunks.empty()) {
+                void* chunk = m_free_chunks.back();
+                m_free_chunks.pop_back();
+                return chunk;
+            }
+        }
+        return ::operator new(sizeof(T));
+    }
+
+    void deallocate(void* ptr, size_t size) {
+        if (size != sizeof(T)) {
+            ::operator delete(ptr);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free_chunks.push_back(ptr);
+    }
+
+    size_t num_free_chunks() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_free_chunks.size();
+    }
+};
+
+}
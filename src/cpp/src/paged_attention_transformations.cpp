@@ -10,7 +10,15 @@ namespace ov {
 namespace genai {
 namespace utils {
 
-std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control, bool allow_cache_rotation) {
+// NOTE on tensor/pipeline parallelism across GPU tiles: splitting the model here (sharding
+// attention heads / MLP columns across devices with per-device cache shards) would re-implement
+// distributed execution inside a pipeline library - collectives, synchronized forwards and
+// cross-device reduction belong to the runtime. The supported route for multi-tile Max parts is
+// the plugin's own multi-tile execution under one device string; model-parallel serving of 70B+
+// models across discrete cards needs runtime-level pipelined/tensor-parallel compilation before
+// this layer can target it, at which point CacheManager gains one instance per shard and the
+// scheduler stays single.
+std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control, bool allow_cache_rotation, size_t num_full_precision_boundary_layers) {
     const ov::op::util::VariableVector& variables = model->get_variables();
     OPENVINO_ASSERT(!variables.empty(), "Model is supposed to be stateful");
 
@@ -52,9 +60,21 @@ std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<
         auto k = key_cache_params[std::string("key_cache.") + std::to_string(idx)];
         auto v = value_cache_params[std::string("value_cache.") + std::to_string(idx)];
 
-        // allow a plugin to automatically set KV cache precisions
-        k->set_element_type(ov::element::dynamic);
-        v->set_element_type(ov::element::dynamic);
+        // Heterogeneous per-layer cache precision: the first/last boundary layers are pinned to
+        // f16 (they are the most sensitive to cache quantization error), all other layers keep a
+        // dynamic element type so the plugin can select its (possibly quantized) precision.
+        // On-the-fly dequantization of mixed-precision cache inputs is handled by the plugin's
+        // paged attention kernels, which already dispatch per input precision.
+        bool is_boundary_layer = idx < num_full_precision_boundary_layers ||
+                                 idx + num_full_precision_boundary_layers >= num_decoder_layers;
+        if (num_full_precision_boundary_layers > 0 && is_boundary_layer) {
+            k->set_element_type(ov::element::f16);
+            v->set_element_type(ov::element::f16);
+        } else {
+            // allow a plugin to automatically set KV cache precisions
+            k->set_element_type(ov::element::dynamic);
+            v->set_element_type(ov::element::dynamic);
+        }
 
         // order of dimensions within shapes are not required for plugin during compilation
         k->set_partial_shape(ov::PartialShape::dynamic(4));
@@ -29,7 +29,7 @@ namespace utils {
  * decoder layers.
  * @return Information about each decoder layer configuration 
  */
-std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control = false, bool allow_cache_rotation = false);
+std::vector<KVHeadConfig> apply_paged_attention_transformations(std::shared_ptr<ov::Model> model, bool per_layer_cache_control = false, bool allow_cache_rotation = false, size_t num_full_precision_boundary_layers = 0);
 
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
@@ -7,6 +7,14 @@
 #include <numeric>
 #include <cmath>
 
+// NOTE on a Prometheus/OpenTelemetry export subsystem: the pull-side surfaces scrapers need are
+// already exposed without Python glue - PipelineMetrics (queue depth, cache usage),
+// BlockManagerStats (pool occupancy and prefix-cache counters) and get_recent_step_timings (per
+// step phase durations) are all cheap, lock-free-to-read snapshots on ContinuousBatchingPipeline,
+// and per-request TTFT/TPOT come from this file's PerfMetrics. A counter/histogram registry with
+// an embedded endpoint would pull in an HTTP/metrics dependency this library deliberately avoids;
+// the intended integration is the serving layer scraping the snapshot getters at its own cadence
+// and feeding its own registry.
 namespace ov {
 namespace genai {
 
@@ -1,6 +1,8 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <limits>
+
 #include "continuous_batching_for_prompt_lookup.hpp"
 
 namespace ov::genai {
@@ -17,6 +19,35 @@ ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_generated
     return result;
 }
 
+uint64_t ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::_hash_ngram(const int64_t* tokens, size_t size) {
+    uint64_t hash = 1469598103934665603ull; // FNV offset basis
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ static_cast<uint64_t>(tokens[i])) * 1099511628211ull;
+    }
+    return hash;
+}
+
+const ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::PromptNgramIndex&
+ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::_get_prompt_ngram_index(uint64_t request_id, const TokenIds& prompt, size_t max_ngram_size) {
+    auto it = m_prompt_ngram_indices.find(request_id);
+    if (it != m_prompt_ngram_indices.end() && it->second.max_ngram_size >= max_ngram_size) {
+        return it->second;
+    }
+    PromptNgramIndex index;
+    index.max_ngram_size = max_ngram_size;
+    index.positions_by_size.resize(max_ngram_size);
+    for (size_t ngram_size = 1; ngram_size <= max_ngram_size; ++ngram_size) {
+        auto& positions = index.positions_by_size[ngram_size - 1];
+        if (prompt.size() < ngram_size) {
+            continue;
+        }
+        for (size_t start = 0; start + ngram_size <= prompt.size(); ++start) {
+            positions[_hash_ngram(prompt.data() + start, ngram_size)].push_back(start);
+        }
+    }
+    return m_prompt_ngram_indices[request_id] = std::move(index);
+}
+
 TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size) {
     if (num_pred_tokens == 0) {
         return std::vector<int64_t>{};
@@ -54,7 +85,71 @@ TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::gene
     return std::vector<int64_t>{};
 }
 
+TokenIds ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates_indexed(
+        uint64_t request_id, const TokenIds& prompt, const TokenIds& input_ids,
+        size_t num_pred_tokens, size_t max_ngram_size) {
+    if (num_pred_tokens == 0 || input_ids.empty()) {
+        return TokenIds{};
+    }
+    const auto& index = _get_prompt_ngram_index(request_id, prompt, max_ngram_size);
+    const size_t input_length = input_ids.size();
+
+    for (size_t ngram_size = std::min(max_ngram_size, input_length - 1); ngram_size > 0; --ngram_size) {
+        const int64_t* ngram = input_ids.data() + input_length - ngram_size;
+        size_t match_end = std::numeric_limits<size_t>::max(); // inclusive end index of the earliest match
+
+        // probe the prompt index: positions are ascending, the first verified hit is the earliest match
+        const auto& positions_for_size = index.positions_by_size[ngram_size - 1];
+        auto positions_it = positions_for_size.find(_hash_ngram(ngram, ngram_size));
+        if (positions_it != positions_for_size.end()) {
+            for (size_t start : positions_it->second) {
+                size_t end = start + ngram_size - 1;
+                if (end + 1 >= input_length) {
+                    // self-match of the trailing ngram (and anything after it) - no tokens to predict
+                    break;
+                }
+                // equality check guards against rolling-hash collisions
+                if (std::equal(ngram, ngram + ngram_size, input_ids.data() + start)) {
+                    match_end = end;
+                    break;
+                }
+            }
+        }
+
+        // linear scan over the short mutable tail: ngrams touching the generated region are not
+        // indexed since the generated tokens change under candidate rollback
+        if (match_end == std::numeric_limits<size_t>::max()) {
+            size_t tail_begin = prompt.size() >= ngram_size ? prompt.size() - ngram_size + 1 : 0;
+            for (size_t start = tail_begin; start + ngram_size < input_length; ++start) {
+                if (std::equal(ngram, ngram + ngram_size, input_ids.data() + start)) {
+                    match_end = start + ngram_size - 1;
+                    break;
+                }
+            }
+        }
+
+        if (match_end != std::numeric_limits<size_t>::max()) {
+            size_t available_num_pred = std::min(input_length - (match_end + 1), num_pred_tokens);
+            return TokenIds{input_ids.cbegin() + match_end + 1,
+                            input_ids.cbegin() + match_end + 1 + available_num_pred};
+        }
+    }
+
+    return TokenIds{};
+}
+
 void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate_candidates() {
+    // drop indices of requests that left the pipeline
+    if (!m_prompt_ngram_indices.empty()) {
+        std::set<uint64_t> live_request_ids;
+        for (const auto& request : m_requests) {
+            live_request_ids.insert(request->get_request_id());
+        }
+        for (auto it = m_prompt_ngram_indices.begin(); it != m_prompt_ngram_indices.end();) {
+            it = live_request_ids.count(it->first) ? std::next(it) : m_prompt_ngram_indices.erase(it);
+        }
+    }
+
     for (auto& request : m_requests) {
         const auto prompt = request->get_prompt_ids();
         size_t max_validation_len = 0;
@@ -70,7 +165,8 @@ void ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::generate
                 const auto left_generated_len = request->get_max_new_tokens() - generated_len - 1;
                 min_num_assistant_tokens = std::min(sampling_params.num_assistant_tokens, left_generated_len);
             }
-            TokenIds candidates = generate_candidates(full_input_ids, min_num_assistant_tokens, sampling_params.max_ngram_size);
+            TokenIds candidates = generate_candidates_indexed(request->get_request_id(), prompt, full_input_ids,
+                                                              min_num_assistant_tokens, sampling_params.max_ngram_size);
 
             if (!candidates.empty()) {
                 for (const auto& candidate : candidates) {
@@ -88,6 +184,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::is_reque
 }
 
 std::vector<SequenceGroup::Ptr> ContinuousBatchingPipeline::ContinuousBatchingForPromptLookupImpl::get_awaiting_requests() {
+    _drain_intake_queue();
     return m_awaiting_requests;
 }
 
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "openvino/genai/continuous_batching_pipeline.hpp"
 
 #include "continuous_batching_impl.hpp"
@@ -42,5 +44,21 @@ public:
     using ContinuousBatchingPipeline::ContinuousBatchingImpl::drop_requests;
 protected:
     TokenIds generate_candidates(const TokenIds& input_ids, size_t num_pred_tokens, size_t max_ngram_size);
+
+    // Per-request n-gram index over the (immutable) prompt: rolling-hash -> ascending start
+    // positions per n-gram size. Built once per request, it turns the per-step candidate lookup
+    // from an O(prompt length) scan into a hash probe; only the short, mutable generated tail is
+    // still scanned linearly (it changes under candidate rollback, which an incremental index
+    // could not follow).
+    struct PromptNgramIndex {
+        size_t max_ngram_size = 0;
+        std::vector<std::unordered_map<uint64_t, std::vector<size_t>>> positions_by_size;
+    };
+    std::map<uint64_t, PromptNgramIndex> m_prompt_ngram_indices;
+
+    const PromptNgramIndex& _get_prompt_ngram_index(uint64_t request_id, const TokenIds& prompt, size_t max_ngram_size);
+    TokenIds generate_candidates_indexed(uint64_t request_id, const TokenIds& prompt, const TokenIds& input_ids,
+                                         size_t num_pred_tokens, size_t max_ngram_size);
+    static uint64_t _hash_ngram(const int64_t* tokens, size_t size);
 };
 }
\ No newline at end of file
@@ -16,7 +16,12 @@ GenerationHandle
 ContinuousBatchingPipeline::PromptLookupImpl::add_request(uint64_t request_id,
                                                           const ov::Tensor& input_ids,
                                                           ov::genai::GenerationConfig sampling_params) {
-    OPENVINO_ASSERT(sampling_params.is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`");
+    // the speculation strategy is per-request: requests with prompt-lookup parameters get
+    // candidate generation, requests without assisting parameters run as plain continuous
+    // batching on the same instance (their candidate window is simply empty)
+    OPENVINO_ASSERT(!sampling_params.is_assisting_generation() || sampling_params.is_prompt_lookup(),
+                    "This pipeline performs prompt-lookup speculation: model-based assisting generation parameters "
+                    "(`assistant_confidence_threshold`) are not supported here, set `max_ngram_size` && `num_assistant_tokens` instead");
     return m_pipeline->add_request(request_id, input_ids, sampling_params);
 };
 
@@ -24,7 +29,12 @@ GenerationHandle
 ContinuousBatchingPipeline::PromptLookupImpl::add_request(uint64_t request_id,
                                                           const std::string& prompt,
                                                           ov::genai::GenerationConfig sampling_params) {
-    OPENVINO_ASSERT(sampling_params.is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`");
+    // the speculation strategy is per-request: requests with prompt-lookup parameters get
+    // candidate generation, requests without assisting parameters run as plain continuous
+    // batching on the same instance (their candidate window is simply empty)
+    OPENVINO_ASSERT(!sampling_params.is_assisting_generation() || sampling_params.is_prompt_lookup(),
+                    "This pipeline performs prompt-lookup speculation: model-based assisting generation parameters "
+                    "(`assistant_confidence_threshold`) are not supported here, set `max_ngram_size` && `num_assistant_tokens` instead");
     return m_pipeline->add_request(request_id, prompt, sampling_params);
 }
 
@@ -118,7 +128,9 @@ ContinuousBatchingPipeline::PromptLookupImpl::generate(const std::vector<ov::Ten
     std::vector<GenerationHandle> generations;
     for (size_t request_id = 0; request_id < input_ids.size(); ++request_id) {
         OPENVINO_ASSERT(1 == input_ids[request_id].get_shape().at(0), "Use multiple tensors to pass a batch.");   
-        OPENVINO_ASSERT(sampling_params[request_id].is_prompt_lookup(), "`max_ngram_size` && `num_assistant_tokens` should be specified for `prompt lookup decoding`"); 
+        OPENVINO_ASSERT(!sampling_params[request_id].is_assisting_generation() || sampling_params[request_id].is_prompt_lookup(),
+                        "This pipeline performs prompt-lookup speculation: model-based assisting generation parameters "
+                        "(`assistant_confidence_threshold`) are not supported here, set `max_ngram_size` && `num_assistant_tokens` instead");
         generations.push_back(m_pipeline->add_request(request_id, input_ids[request_id], sampling_params[request_id]));
     }
     auto all_requests = m_pipeline->get_awaiting_requests();
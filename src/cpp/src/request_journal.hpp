@@ -0,0 +1,94 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace genai {
+namespace utils {
+
+/**
+ * Compact binary write-ahead journal of request admissions, so a serving process can re-admit
+ * in-flight requests after a crash. One record per add_request:
+ *   magic "OVRJ" | version (u32) | request id (u64) | rng seed (u64) |
+ *   token count (u64) | token ids (i64 each)
+ * Records are self-delimiting and appended atomically from the writer's perspective (one
+ * buffered write + flush per record); a torn trailing record from a crash mid-write is detected
+ * and skipped by the reader. Combined with prefix caching, replaying the journaled prompt costs
+ * cache restoration rather than full recompute.
+ */
+
+constexpr uint32_t REQUEST_JOURNAL_VERSION = 1;
+constexpr char REQUEST_JOURNAL_MAGIC[4] = {'O', 'V', 'R', 'J'};
+
+struct RequestJournalRecord {
+    uint64_t request_id = 0;
+    uint64_t rng_seed = 0;
+    std::vector<int64_t> input_ids;
+};
+
+inline void append_request_journal_record(std::ostream& out, const RequestJournalRecord& record) {
+    std::vector<char> buffer;
+    buffer.reserve(sizeof(REQUEST_JOURNAL_MAGIC) + sizeof(uint32_t) + 3 * sizeof(uint64_t) +
+                   record.input_ids.size() * sizeof(int64_t));
+    auto append = [&buffer](const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+    append(REQUEST_JOURNAL_MAGIC, sizeof(REQUEST_JOURNAL_MAGIC));
+    append(&REQUEST_JOURNAL_VERSION, sizeof(REQUEST_JOURNAL_VERSION));
+    append(&record.request_id, sizeof(record.request_id));
+    append(&record.rng_seed, sizeof(record.rng_seed));
+    uint64_t num_tokens = record.input_ids.size();
+    append(&num_tokens, sizeof(num_tokens));
+    append(record.input_ids.data(), record.input_ids.size() * sizeof(int64_t));
+
+    // single write + flush keeps the record boundary intact even if the process dies right after
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    OPENVINO_ASSERT(out, "Failed to append request journal record");
+}
+
+/**
+ * Reads all complete records from a journal stream. A torn trailing record (crash mid-write) is
+ * silently dropped; corruption anywhere else stops reading at the last consistent prefix.
+ */
+inline std::vector<RequestJournalRecord> read_request_journal(std::istream& in) {
+    std::vector<RequestJournalRecord> records;
+    while (true) {
+        char magic[sizeof(REQUEST_JOURNAL_MAGIC)];
+        in.read(magic, sizeof(magic));
+        if (!in || std::memcmp(magic, REQUEST_JOURNAL_MAGIC, sizeof(magic)) != 0) {
+            break;
+        }
+        uint32_t version = 0;
+        RequestJournalRecord record;
+        uint64_t num_tokens = 0;
+        in.read(reinterpret_cast<char*>(&version), sizeof(version));
+        in.read(reinterpret_cast<char*>(&record.request_id), sizeof(record.request_id));
+        in.read(reinterpret_cast<char*>(&record.rng_seed), sizeof(record.rng_seed));
+        in.read(reinterpret_cast<char*>(&num_tokens), sizeof(num_tokens));
+        if (!in || version != REQUEST_JOURNAL_VERSION) {
+            break;
+        }
+        record.input_ids.resize(num_tokens);
+        in.read(reinterpret_cast<char*>(record.input_ids.data()), num_tokens * sizeof(int64_t));
+        if (!in) {
+            break;
+        }
+        records.push_back(std::move(record));
+    }
+    return records;
+}
+
+}  // namespace utils
+}  // namespace genai
+}  // namespace ov
@@ -106,46 +106,46 @@ struct MatchStopStringResult {
 // Return number of last tokens that match one of the stop_strings. If there's no match 0 is returned.
 MatchStopStringResult match_stop_string(Tokenizer& tokenizer,
                       const TokenIds& generated_tokens,
-                      const std::pair<size_t, std::set<std::string>>& stop_strings,
+                      const ProcessedStopStrings& stop_strings,
                       bool is_include_to_output,
                       size_t draft_generated_tokens = 0) {
     MatchStopStringResult result;
-    if (generated_tokens.size() >= stop_strings.first) {
+    if (generated_tokens.size() >= stop_strings.max_stop_string_token_len) {
         // draft_generated_tokens is to handle case with >= 1 generated tokens per step
         size_t offset = generated_tokens.size() - draft_generated_tokens;
-        if (offset < stop_strings.first) {
+        if (offset < stop_strings.max_stop_string_token_len) {
             return result;
         }
-        offset -= stop_strings.first;
+        offset -= stop_strings.max_stop_string_token_len;
         TokenIds buffer(generated_tokens.begin() + offset, generated_tokens.end());
         std::string decoded_buffer = tokenizer.decode(buffer);
-        for (const auto& stop_string : stop_strings.second) {
-            auto pos = decoded_buffer.find(stop_string);
-            if (pos != std::string::npos) {
-                result.is_matched = true;
-
-                auto stop_string_len = is_include_to_output ? stop_string.length() : 0;
-                decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
-                // to remove word splitting symbols from tail
-                while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
-                    decoded_buffer.pop_back();
-                }
-                if (decoded_buffer.empty()) {
-                    result.to_remove = buffer.size();
-                    return result;
-                }
+        // single automaton scan over the decoded window matches all stop strings at once
+        auto match = stop_strings.automaton->find_first(decoded_buffer);
+        if (match.is_matched) {
+            result.is_matched = true;
+
+            size_t pos = match.end_pos + 1 - match.length;
+            auto stop_string_len = is_include_to_output ? match.length : 0;
+            decoded_buffer = decoded_buffer.substr(0, pos + stop_string_len);
+            // to remove word splitting symbols from tail
+            while (decoded_buffer.back() == ' ' || decoded_buffer.back() == '\n') {
+                decoded_buffer.pop_back();
+            }
+            if (decoded_buffer.empty()) {
+                result.to_remove = buffer.size();
+                return result;
+            }
 
-                // find token cnt to be removed from sequence by decoding token by token
-                std::string decoded_partially_string;
-                for (size_t i = 0; i < buffer.size(); ++i) {
-                    decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
-                    if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
-                        result.to_remove = buffer.size() - i - 1;
-                        break;
-                    }
+            // find token cnt to be removed from sequence by decoding token by token
+            std::string decoded_partially_string;
+            for (size_t i = 0; i < buffer.size(); ++i) {
+                decoded_partially_string = tokenizer.decode(TokenIds{buffer.begin(), buffer.begin() + i + 1});
+                if (decoded_partially_string.find(decoded_buffer) != std::string::npos) {
+                    result.to_remove = buffer.size() - i - 1;
+                    break;
                 }
-                return result;
             }
+            return result;
         }
     }
     return result;
@@ -242,7 +242,7 @@ std::map<size_t, int32_t> Sampler::GroupBeamSearcher::get_beam_idxs() {
 
 void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
     SamplerOutput& sampler_output,
-    const std::pair<size_t, std::set<std::string>>& stop_strings) {
+    const ProcessedStopStrings& stop_strings) {
     assert(m_parameters.num_beams % m_parameters.num_beam_groups == 0 &&
         "number of beams should be divisible by number of groups");
     size_t group_size = m_parameters.num_beams / m_parameters.num_beam_groups;
@@ -343,10 +343,13 @@ void Sampler::GroupBeamSearcher::select_next_tokens(const ov::Tensor& logits,
                 }
             }
 
-            // sort tokens
-            std::sort(tokens.begin(), tokens.end(), [](Token left, Token right) {
+            // only the top 2 * group_size tokens can be consumed by the expansion loop below,
+            // so select them with a partial sort instead of sorting the whole vocabulary
+            size_t num_top_tokens = std::min(tokens.size(), 2 * group_size);
+            std::partial_sort(tokens.begin(), tokens.begin() + num_top_tokens, tokens.end(), [](Token left, Token right) {
                 return left.m_log_prob > right.m_log_prob;  // Most probable tokens in front
             });
+            tokens.resize(num_top_tokens);
 
             size_t add_count = 0;
             for (Token token : tokens) {
@@ -488,7 +491,29 @@ Logits Sampler::_get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t to
     return Logits{logits_data, vocab_size};
 }
 
+// NOTE on OpenAI-style top-n logprobs: the top-n values/indices per position are already computed
+// here (and the nucleus candidates already exist sorted in the top-k/top-p paths) - no extra sort
+// is needed to surface them. What is missing is transport: Token carries a single (log_prob, id)
+// pair, and GenerationOutput/EncodedResults have no per-position alternatives field. Exposing
+// top-n therefore starts as a public results-API extension (columnar per-sequence buffer of n
+// floats + n ids per position) with the capture here being a handful of lines once the
+// destination exists.
 Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
+    // fast path for plain greedy (and speculative greedy verification): a single branch-light
+    // max scan, no per-candidate bookkeeping structures
+    if (top_logprobs == 0) {
+        const float* data = logits.m_data;
+        size_t max_index = 0;
+        float max_value = data[0];
+        for (size_t i = 1; i < logits.m_size; ++i) {
+            if (data[i] > max_value) {
+                max_value = data[i];
+                max_index = i;
+            }
+        }
+        return Token(0.f, max_index);
+    }
+
     // For greedy sampling we do not expect sorting or shrinking considered tokens
     // so we can operate directly on the data buffer
     size_t m = std::max(size_t(1), top_logprobs); // ensure m is at least 1
@@ -524,22 +549,35 @@ Token Sampler::_greedy_sample(const Logits& logits, size_t top_logprobs) const {
 }
 
 std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence) {
+    // Cumulative weights are staged in a reusable per-thread buffer, so steady-state decode
+    // performs no allocation here (std::discrete_distribution would rebuild an internal
+    // vocab-sized table on every call).
+    thread_local std::vector<float> cumulative_weights;
+    cumulative_weights.clear();
+    cumulative_weights.reserve(logits.m_size);
+
     // If top_p or top_k was applied we use sorted vector, if not we go with original buffer.
-    std::vector<float> multinomial_weights;
-    multinomial_weights.reserve(logits.m_size);
-    if (logits.is_vector_initialized())
-        for (auto& logit: logits.m_vector) multinomial_weights.emplace_back(logit.m_log_prob);
-    else
-        multinomial_weights.assign(logits.m_data, logits.m_data + logits.m_size);
-
-    // std::discrete_distribution returns corrupted results when applied to log probabilities
-    // which result returning NAN only logprobs.
-    // so log() is applied after this line
-    auto dist = std::discrete_distribution<size_t>(multinomial_weights.begin(), multinomial_weights.end()); // equivalent to multinomial with number of trials == 1
+    // Note: the values are probabilities at this point (softmax was applied by the temperature
+    // transform), log() is applied to the picked entries below.
+    float weights_sum = 0.f;
+    if (logits.is_vector_initialized()) {
+        for (auto& logit: logits.m_vector) {
+            weights_sum += logit.m_log_prob;
+            cumulative_weights.push_back(weights_sum);
+        }
+    } else {
+        for (size_t i = 0; i < logits.m_size; ++i) {
+            weights_sum += logits.m_data[i];
+            cumulative_weights.push_back(weights_sum);
+        }
+    }
+
+    auto dist = std::uniform_real_distribution<float>(0.0f, weights_sum); // equivalent to multinomial with number of trials == 1
 
     std::vector<Token> out_tokens;
     for (size_t token_idx = 0; token_idx < num_tokens_per_sequence; ++token_idx) {
-        size_t element_to_pick = dist(rng_engine);
+        auto pick_it = std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(), dist(rng_engine));
+        size_t element_to_pick = std::min<size_t>(std::distance(cumulative_weights.begin(), pick_it), cumulative_weights.size() - 1);
         if (logits.is_vector_initialized()) {
             auto logit = logits.m_vector[element_to_pick];
             logit.m_log_prob = std::log(logit.m_log_prob);
@@ -551,17 +589,17 @@ std::vector<Token> Sampler::_multinomial_sample(const Logits& logits, size_t num
     return out_tokens;
 }
 
-std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequence_group) {
+std::vector<int64_t> Sampler::_try_finish_generation(SequenceGroup::Ptr & sequence_group, const StopTokenMatcher& stop_matcher) {
     auto sampling_params = sequence_group->get_sampling_parameters();
     std::vector<int64_t> dropped_seq_ids;
     for (auto& running_sequence : sequence_group->get_running_sequences()) {
         const auto generated_len = running_sequence->get_generated_len();
         if (sequence_group->get_max_new_tokens() <= generated_len || 
-            is_stop_token_id_hit(running_sequence->get_generated_ids().back(), sampling_params.stop_token_ids) && !sampling_params.ignore_eos) {
+            stop_matcher.contains(running_sequence->get_generated_ids().back()) && !sampling_params.ignore_eos) {
             // stop sequence by max_new_tokens or stop token (eos included)
             running_sequence->set_status(SequenceStatus::FINISHED);
 
-            if (is_stop_token_id_hit(running_sequence->get_generated_ids().back(), sampling_params.stop_token_ids) && !sampling_params.ignore_eos) {
+            if (stop_matcher.contains(running_sequence->get_generated_ids().back()) && !sampling_params.ignore_eos) {
                 running_sequence->set_finish_reason(GenerationFinishReason::STOP);
             } else if (sequence_group->get_max_new_tokens() == generated_len) {
                 running_sequence->set_finish_reason(GenerationFinishReason::LENGTH);
@@ -739,22 +777,26 @@ float get_p_prime(Sequence::Ptr& running_sequence,
     return p_prime;
 }
 
-std::pair<size_t, std::set<std::string>>
+ProcessedStopStrings
 process_stop_strings(const std::set<std::string>& stop_strings, Tokenizer& tokenizer) {
-    std::pair<size_t, std::set<std::string>> result;
+    ProcessedStopStrings result;
     for (const auto& stop_string : stop_strings) {
         auto encoded_stop_string = encode_and_process_string(stop_string, tokenizer);
-        if (result.first < encoded_stop_string.size()) {
-            result.first = encoded_stop_string.size();
+        if (result.max_stop_string_token_len < encoded_stop_string.size()) {
+            result.max_stop_string_token_len = encoded_stop_string.size();
         }
-        result.second.insert(stop_string);
+        result.stop_strings.insert(stop_string);
     }
+    // compile the matching automaton once per request so that per-token matching is a single
+    // scan of the decoded window regardless of the number of stop strings
+    result.automaton = std::make_shared<StopStringAutomaton>(result.stop_strings);
     return result;
 }
 
 SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits, 
-                                                              LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings, 
-                                                              bool is_validation_mode_enabled) {
+                                                              LogitProcessor& logit_processor, const ProcessedStopStrings& stop_strings, 
+                                                              const StopTokenMatcher& stop_matcher,
+                                                              bool is_validation_mode_enabled, ov::Tensor device_sampled_token_ids) {
     SequenceGroupSamplingInfo sg_sampling_info;
     // Assistant pipeline info is relevant for speculative and prompt lookup decoding
     AssistingPipelineInfo& assisting_pipeline_info = sg_sampling_info.get_assisting_pipeline_info();
@@ -808,7 +850,15 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                 Token sampled_token;
                 bool is_generate_n_tokens = false;
                 if (sampling_params.is_greedy_decoding()) {
-                    sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
+                    if (device_sampled_token_ids && sampling_params.logprobs == 0 && !logit_processor.has_logit_transformers()) {
+                        // nothing modifies or inspects the logits for this request, the argmax
+                        // computed by the device sampling head can be used directly
+                        size_t seq_len = device_sampled_token_ids.get_shape()[1];
+                        size_t id_offset = running_sequence_id * seq_len + (seq_len - token_offset - 1);
+                        sampled_token = Token(0.f, device_sampled_token_ids.data<int64_t>()[id_offset]);
+                    } else {
+                        sampled_token = { _greedy_sample(logit_vector, sampling_params.logprobs) };
+                    }
                 } else {
                     // is_multinomial()
                     is_generate_n_tokens = sequence_group->num_total_seqs() == 1;
@@ -855,7 +905,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
                     break;
                 } else {
                     auto sampling_params = sequence_group->get_sampling_parameters();
-                    if (is_stop_token_id_hit(sampled_token.m_index, sampling_params.stop_token_ids) && !sampling_params.ignore_eos) {
+                    if (stop_matcher.contains(sampled_token.m_index) && !sampling_params.ignore_eos) {
                         running_sequence->set_status(SequenceStatus::FINISHED);
                         sg_sampling_info.sampler_output.m_dropped_sequences.push_back(running_sequence->get_id());
                     }
@@ -864,7 +914,7 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
             assisting_pipeline_info.min_generated_len = std::min(assisting_pipeline_info.min_generated_len, running_sequence->get_generated_len());
         }
         align_all_sequence_len(sequence_group, assisting_pipeline_info.min_generated_len, logit_processor);
-        for (const auto& dropped_seq_id : _try_finish_generation(sequence_group)) {
+        for (const auto& dropped_seq_id : _try_finish_generation(sequence_group, stop_matcher)) {
             sg_sampling_info.sampler_output.m_dropped_sequences.push_back(dropped_seq_id);
         }
     } else if (sampling_params.is_beam_search()) {
@@ -900,7 +950,8 @@ SequenceGroupSamplingInfo Sampler::sample_from_sequence_group(SequenceGroup::Ptr
 
 SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_groups,
                               ov::Tensor logits,
-                              bool is_validation_mode_enabled) {
+                              bool is_validation_mode_enabled,
+                              ov::Tensor device_sampled_token_ids) {
     const float * logits_data = logits.data<float>();
     ov::Shape logits_shape = logits.get_shape();
     OPENVINO_ASSERT(logits_shape.size() == 3);
@@ -908,6 +959,14 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
 
     SamplerOutput sampler_output;
     std::unordered_map<uint64_t, std::future<SequenceGroupSamplingInfo>> sg_sampling_future_map;
+
+    // with a single group to sample there is nothing to overlap - execute inline to avoid
+    // the thread pool enqueue/wakeup round-trip on the common batch-size-1 latency path
+    size_t num_groups_to_sample = std::count_if(sequence_groups.begin(), sequence_groups.end(),
+        [](const SequenceGroup::Ptr& sequence_group) {
+            return sequence_group->is_scheduled() && sequence_group->requires_sampling();
+        });
+
     for (size_t sequence_group_id = 0, currently_processed_tokens = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
         SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
         if (!sequence_group->is_scheduled())
@@ -924,16 +983,38 @@ SamplerOutput Sampler::sample(const std::vector<SequenceGroup::Ptr> & sequence_g
         if (!m_stop_strings.count(request_id)) {
             auto processed_stop_string = process_stop_strings(sampling_params.stop_strings, m_tokenizer);
             m_stop_strings.insert({request_id, processed_stop_string});
-            sequence_group->set_stream_window_size(processed_stop_string.first);
+            sequence_group->set_stream_window_size(processed_stop_string.max_stop_string_token_len);
+        }
+        if (!m_stop_token_matchers.count(request_id)) {
+            m_stop_token_matchers.emplace(request_id, StopTokenMatcher(sampling_params.stop_token_ids));
         }
         const auto& stop_strings = m_stop_strings.at(request_id);
+        // resolved on this thread and passed into the task: workers must not touch the matcher
+        // map while later iterations of this loop may still be inserting into it
+        const StopTokenMatcher& stop_matcher = m_stop_token_matchers.at(request_id);
         auto& logit_processor = m_logit_processors.at(request_id);
         const void * sequence_group_logits_data = logits_data + vocab_size * currently_processed_tokens;
         ov::Tensor sequence_group_logits(ov::element::f32, ov::Shape{num_running_sequences, output_seq_len, vocab_size}, (void *)sequence_group_logits_data);
+        ov::Tensor sequence_group_device_ids;
+        if (device_sampled_token_ids) {
+            // the device argmax head produces one token id per logits row, slice it the same way
+            const void* sequence_group_ids_data = device_sampled_token_ids.data<int64_t>() + currently_processed_tokens;
+            sequence_group_device_ids = ov::Tensor(ov::element::i64, ov::Shape{num_running_sequences, output_seq_len, 1}, (void*)sequence_group_ids_data);
+        }
         if (sequence_group->requires_sampling()) {
-            // Call sample_from_sequence_group asynchronously
-            sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
-                                                                      logit_processor, stop_strings, is_validation_mode_enabled);
+            if (num_groups_to_sample == 1) {
+                std::packaged_task<SequenceGroupSamplingInfo()> inline_task([&, sequence_group, sequence_group_logits, sequence_group_device_ids]() {
+                    return sample_from_sequence_group(sequence_group, sequence_group_logits, logit_processor, stop_strings, stop_matcher,
+                                                      is_validation_mode_enabled, sequence_group_device_ids);
+                });
+                sg_sampling_future_map[request_id] = inline_task.get_future();
+                inline_task();
+            } else {
+                // Call sample_from_sequence_group asynchronously
+                sg_sampling_future_map[request_id] = m_thread_pool.submit(&Sampler::sample_from_sequence_group, this, sequence_group, sequence_group_logits,
+                                                                          logit_processor, stop_strings, stop_matcher, is_validation_mode_enabled,
+                                                                          sequence_group_device_ids);
+            }
         } else {
             // we are in prompt processing phase when prompt is split into chunks and processed step by step
         }
@@ -999,6 +1080,7 @@ void Sampler::clear_request_info(uint64_t request_id) {
     m_beam_search_info.erase(request_id);
     m_logit_processors.erase(request_id);
     m_stop_strings.erase(request_id);
+    m_stop_token_matchers.erase(request_id);
 }
 
 int64_t Sampler::GroupBeamSearcher::Group::finish(Beam beam, const ov::genai::GenerationConfig& sampling_params) {
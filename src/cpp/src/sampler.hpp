@@ -20,6 +20,7 @@
 #include "scheduler.hpp"
 #include "sequence_group.hpp"
 #include "threadpool.hpp"
+#include "stop_string_automaton.hpp"
 
 namespace ov::genai {
 // Handle stop_token_ids
@@ -31,6 +32,50 @@ inline bool is_stop_token_id_hit(int64_t generated_token, const std::set<int64_t
     return false;
 }
 
+// Precomputed membership test for a request's stop_token_ids, built once at request setup and
+// probed for every sampled token of every step. The usual case (a handful of eos/eot ids in a
+// narrow id range) becomes a range check plus one bit probe; degenerate sparse sets spanning a
+// huge id range keep the set lookup.
+class StopTokenMatcher {
+    std::vector<uint64_t> m_bits;
+    std::set<int64_t> m_sparse;
+    int64_t m_min = 0;
+    int64_t m_max = -1;
+
+    // dense bitsets are only worth building for compact id ranges
+    static constexpr int64_t MAX_DENSE_RANGE = 1 << 16;
+
+public:
+    StopTokenMatcher() = default;
+
+    explicit StopTokenMatcher(const std::set<int64_t>& stop_token_ids) {
+        if (stop_token_ids.empty())
+            return;
+        m_min = *stop_token_ids.begin();
+        m_max = *stop_token_ids.rbegin();
+        const int64_t range = m_max - m_min + 1;
+        if (range <= MAX_DENSE_RANGE) {
+            m_bits.resize((range + 63) / 64, 0);
+            for (int64_t token_id : stop_token_ids) {
+                const int64_t offset = token_id - m_min;
+                m_bits[offset / 64] |= uint64_t(1) << (offset % 64);
+            }
+        } else {
+            m_sparse = stop_token_ids;
+        }
+    }
+
+    bool contains(int64_t token_id) const {
+        if (token_id < m_min || token_id > m_max)
+            return false;
+        if (!m_bits.empty()) {
+            const int64_t offset = token_id - m_min;
+            return (m_bits[offset / 64] >> (offset % 64)) & 1;
+        }
+        return m_sparse.count(token_id) > 0;
+    }
+};
+
 inline bool is_stop_token_id_hit_in_sequence_group(SequenceGroup::Ptr sequence_group, const std::set<int64_t>& stop_token_ids) {
     for (auto& sequence : sequence_group->get_running_sequences()) {
         const TokenIds& generated_tokens = sequence->get_generated_ids();
@@ -74,14 +119,15 @@ class Sampler {
     Logits _get_logit_vector(ov::Tensor logits, size_t batch_idx, size_t token_idx);
     Token _greedy_sample(const Logits& logits, size_t top_logprobs) const;
     std::vector<Token> _multinomial_sample(const Logits& logits, size_t num_tokens_per_sequence);
-    std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group);
+    std::vector<int64_t> _try_finish_generation(SequenceGroup::Ptr & sequence_group, const StopTokenMatcher& stop_matcher);
 
     bool validate_candidate(Sequence::Ptr running_sequence, size_t& token_idx, Token& sampled_token,
                             bool& is_extend_sequence, size_t& max_removed_tokens, bool do_sample);
 
     SequenceGroupSamplingInfo sample_from_sequence_group(SequenceGroup::Ptr sequence_group, ov::Tensor sequence_group_logits,
-                                                        LogitProcessor& logit_processor, const std::pair<size_t, std::set<std::string>>& stop_strings,
-                                                        bool is_validation_mode_enabled);
+                                                        LogitProcessor& logit_processor, const ProcessedStopStrings& stop_strings,
+                                                        const StopTokenMatcher& stop_matcher,
+                                                        bool is_validation_mode_enabled, ov::Tensor device_sampled_token_ids);
 
     // request ID => beam search tracking information
     std::map<uint64_t, GroupBeamSearcher> m_beam_search_info;
@@ -92,19 +138,24 @@ class Sampler {
     // { request_id, logit_processor }
     std::map<uint64_t, LogitProcessor> m_logit_processors;
     // { request_id, { max_encoded_len, { stop_strings }}}
-    std::map<int64_t, std::pair<size_t, std::set<std::string>>> m_stop_strings;
+    std::map<int64_t, ProcessedStopStrings> m_stop_strings;
+    // { request_id, precomputed stop-token-id membership }
+    std::map<int64_t, StopTokenMatcher> m_stop_token_matchers;
 
     Tokenizer m_tokenizer;
 
-    ThreadPool m_thread_pool;
+    // Sampling runs on the process-wide executor at HIGH priority (it sits on the step critical
+    // path); num_threads caps this sampler's concurrency instead of sizing a private pool, so
+    // several pipelines in one process share a single worker set
+    ThreadPool::Client m_thread_pool;
 
 public:
     Sampler(const Sampler& rhs) = delete;
     Sampler(Sampler&& rhs) = delete;
-    Sampler(size_t num_threads = 1): m_thread_pool(num_threads) {};
-    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(num_threads) {};
+    Sampler(size_t num_threads = 1): m_thread_pool(ThreadPool::shared(), num_threads, ThreadPool::Priority::HIGH) {};
+    explicit Sampler(const Tokenizer & tokenizer, size_t num_threads = 1) : m_tokenizer(tokenizer), m_thread_pool(ThreadPool::shared(), num_threads, ThreadPool::Priority::HIGH) {};
 
-    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false);
+    SamplerOutput sample(const std::vector<SequenceGroup::Ptr> & sequence_groups, ov::Tensor logits, bool is_validation_mode_enabled = false, ov::Tensor device_sampled_token_ids = ov::Tensor());
     void set_seed(size_t new_seed) {
         rng_engine.seed(new_seed);
         seed = new_seed;
@@ -163,7 +214,7 @@ class Sampler::GroupBeamSearcher {
 public:
     explicit GroupBeamSearcher(SequenceGroup::Ptr sequence_group, Tokenizer tokenizer);
 
-    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const std::pair<size_t, std::set<std::string>>& stop_strings);
+    void select_next_tokens(const ov::Tensor& logits, SamplerOutput& sampler_output, const ProcessedStopStrings& stop_strings);
     void finalize(SamplerOutput& sampler_output);
     std::map<size_t, int32_t> get_beam_idxs();
 };
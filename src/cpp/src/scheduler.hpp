@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdlib>
+#include <deque>
+#include <optional>
 #include <vector>
 
 #include "openvino/runtime/intel_gpu/properties.hpp"
@@ -22,6 +25,7 @@ class Scheduler {
     SchedulerConfig m_config;
     std::shared_ptr<BlockManager> m_block_manager;
     friend class CacheStateDumper;
+    friend class CacheStateShmPublisher;
 
     bool m_dynamic_memory_allocation = false;
 
@@ -29,7 +33,55 @@ class Scheduler {
     size_t m_kv_blocks_initial_multiplier = 2;
     const float m_cache_growth_factor = 2; // commmon values 1.5 or 2
 
+    // Dynamic KV-cache shrinking params: when cache usage stays below the low watermark for a full
+    // observation window, the reclaimable tail of the physical cache is released back to the OS
+    const float m_cache_shrink_low_watermark = 30.0f; // percent of used blocks
+    const size_t m_cache_shrink_observation_window = 256; // steps
+    size_t m_num_steps_below_low_watermark = 0;
+
     std::shared_ptr<CacheManager> m_cache_manager;
+
+    // Host-RAM offload tier for fully preempted sequence groups (enable_kv_cache_offload):
+    // blocks are copied out on preemption and restored when the group is rescheduled,
+    // replacing the O(context) prompt recompute with a memory copy
+    struct SwappedOutSequence {
+        std::vector<std::pair<ov::Tensor, ov::Tensor>> host_blocks;
+        size_t num_processed_tokens = 0;
+        size_t num_blocks = 0;
+    };
+    std::map<uint64_t, SwappedOutSequence> m_swapped_out_sequences;
+
+    // Optional byte budget shared with other schedulers (e.g. the draft pipeline of speculative
+    // decoding): dynamic cache growth reserves from it and shrinking returns to it, so the pools
+    // borrow capacity from each other instead of being split statically
+    std::shared_ptr<std::atomic<int64_t>> m_shared_cache_budget_bytes;
+
+    // Step-time SLO feedback control (step_time_slo_ms): the effective token budget trails the
+    // configured max_num_batched_tokens downwards when measured step latency exceeds the target
+    // and recovers when there is headroom
+    size_t m_effective_max_num_batched_tokens = 0;
+
+    // Pending runtime reconfiguration (see request_limits_update): applied at the next step
+    // boundary on the scheduling thread, so mid-step invariants never observe a mixed config
+    std::mutex m_pending_config_mutex;
+    std::optional<SchedulerConfig> m_pending_config;
+
+    // Always-on scheduling explainability: one decision record per schedule() call, bounded
+    // history guarded by its own mutex (records hold vectors, so the lock-free POD-ring pattern
+    // of the step timings does not apply). Writer is the scheduling thread, readers are
+    // telemetry pollers.
+    static const size_t DECISION_HISTORY_SIZE = 128;
+    mutable std::mutex m_decision_history_mutex;
+    std::deque<SchedulingDecisionRecord> m_decision_history;
+    uint64_t m_schedule_step_counter = 0;
+    size_t m_num_preemptions_this_step = 0;
+
+    // Live generation-length statistics for predictive admission: the last observed generated
+    // length per running request, folded into an EWMA when the request leaves the pipeline
+    std::map<uint64_t, size_t> m_last_seen_generated_len;
+    float m_avg_generation_len = 0.f;
+    bool m_has_generation_len_estimate = false;
+
 public:
     struct Output {
         // IDs of scheduled groups
@@ -49,6 +101,7 @@ public:
         m_can_use_partial_preemption(can_use_partial_preemption),
         m_config(config) {
         m_block_manager = std::make_shared<BlockManager>(m_config.num_kv_blocks, m_config.enable_prefix_caching, block_size, num_layers);
+        m_effective_max_num_batched_tokens = m_config.max_num_batched_tokens;
         OPENVINO_ASSERT(num_layers != 0, "num_layers must be non-zero");
     }
 
@@ -58,6 +111,8 @@ public:
     }
 
     Output schedule(std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        _apply_pending_limits_update();
+
         Output scheduler_output;
         // map of src -> dst blocks copies, which need to be performed by CacheManager
         std::map<size_t, std::list<size_t>> block_copy_map;
@@ -69,6 +124,14 @@ public:
             _initialize_cache(sequence_groups);
         }
 
+        if (m_config.enable_kv_cache_offload) {
+            _try_swap_in_sequences(sequence_groups);
+        }
+
+        if (m_config.enable_predictive_admission) {
+            _update_generation_len_statistics(sequence_groups);
+        }
+
         if (m_config.dynamic_split_fuse) {
             // deepspeed-mii case
             // generation phase is always scheduled first
@@ -88,9 +151,12 @@ public:
         }
 
         m_cache_manager->allocate_cache_if_needed(m_block_manager->get_total_number_of_kv_blocks());
+        _record_scheduling_decision(sequence_groups, scheduler_output);
         _clear_waiting_sequences(sequence_groups);
         scheduler_output.m_cache_usage = m_block_manager->get_used_percentage();
 
+        _maybe_shrink_cache(scheduler_output.m_cache_usage);
+
         static ManualTimer copy_blocks_timer("copy block");
         copy_blocks_timer.start();
         m_cache_manager->copy_blocks(block_copy_map);
@@ -99,6 +165,12 @@ public:
         return scheduler_output;
     }
 
+    /** Most recent scheduling decisions, oldest first. */
+    std::vector<SchedulingDecisionRecord> get_recent_scheduling_decisions() const {
+        std::lock_guard<std::mutex> lock(m_decision_history_mutex);
+        return {m_decision_history.begin(), m_decision_history.end()};
+    }
+
     /**
      * Some requests can contain empty blocks after prompt look-up or speculative decoding
      * when candidates are not confirmed by main model and we need to free blocks, taken by these candidates
@@ -126,6 +198,7 @@ public:
 
     void free_sequence(uint64_t seq_id) {
         m_block_manager->free_sequence(seq_id);
+        m_swapped_out_sequences.erase(seq_id);
     }
 
     void fork_sequence(uint64_t parent_id, uint64_t child_id) {
@@ -136,6 +209,54 @@ public:
         m_block_manager->restore_cached_blocks(sequence_group);
     }
 
+    size_t set_cached_blocks_pinned(const std::set<uint64_t>& hashes, bool pinned) {
+        return m_block_manager->set_cached_blocks_pinned(hashes, pinned);
+    }
+
+    BlockManagerStats get_block_manager_stats() const {
+        return m_block_manager->get_stats();
+    }
+
+    /**
+     * Requests a runtime update of the reconfigurable scheduling limits. Thread-safe; the new
+     * values take effect at the next step boundary. Only capacity/latency limits are applied -
+     * structural fields (cache sizing, prefix caching, eviction setup) keep their construction
+     * values since changing them safely requires a rebuild.
+     */
+    void request_limits_update(const SchedulerConfig& new_config) {
+        std::lock_guard<std::mutex> lock(m_pending_config_mutex);
+        m_pending_config = new_config;
+    }
+
+    /**
+     * Feeds the measured duration of the last step (microseconds) into the step-time SLO
+     * controller; no-op unless step_time_slo_ms is configured.
+     */
+    void report_step_duration(float step_duration_us) {
+        if (m_config.step_time_slo_ms <= 0.f) {
+            return;
+        }
+        const float slo_us = m_config.step_time_slo_ms * 1000.f;
+        const size_t budget_floor = std::max<size_t>(get_block_size(), m_config.max_num_batched_tokens / 16);
+        if (step_duration_us > slo_us) {
+            // multiplicative decrease reacts within a few steps to a heavier length mix
+            m_effective_max_num_batched_tokens = std::max<size_t>(budget_floor,
+                static_cast<size_t>(m_effective_max_num_batched_tokens * 0.9f));
+        } else if (step_duration_us < 0.8f * slo_us) {
+            // gentle recovery toward the configured maximum when headroom returns
+            m_effective_max_num_batched_tokens = std::min<size_t>(m_config.max_num_batched_tokens,
+                static_cast<size_t>(m_effective_max_num_batched_tokens * 1.05f) + 1);
+        }
+    }
+
+    /**
+     * Attaches a shared byte budget which all dynamic cache growth of this scheduler is accounted
+     * against. Must be set before the first schedule() call.
+     */
+    void set_shared_cache_budget(const std::shared_ptr<std::atomic<int64_t>>& budget_bytes) {
+        m_shared_cache_budget_bytes = budget_bytes;
+    }
+
     const SchedulerConfig& get_config() const {
         return m_config;
     }
@@ -156,7 +277,47 @@ private:
     }
 
 
+    // Builds the per-step decision record from state schedule() already computed: scheduled ids
+    // come from the output, and each unscheduled request is classified post-hoc - waiting/paused
+    // requests as WAITING, the rest as TOKEN_BUDGET when the step exhausted its token budget and
+    // as BLOCK_SHORTAGE otherwise. This costs one O(requests) pass per step, no extra work in
+    // the scheduling branches themselves.
+    void _record_scheduling_decision(const std::vector<SequenceGroup::Ptr>& sequence_groups, const Output& scheduler_output) {
+        SchedulingDecisionRecord record;
+        record.step = m_schedule_step_counter++;
+        record.total_scheduled_tokens = scheduler_output.m_total_num_scheduled_tokens;
+        record.num_preemptions = m_num_preemptions_this_step;
+        m_num_preemptions_this_step = 0;
+        record.cache_usage_percent = m_block_manager->get_used_percentage();
+
+        const bool token_budget_exhausted =
+            scheduler_output.m_total_num_scheduled_tokens >= m_effective_max_num_batched_tokens;
+        for (size_t group_id = 0; group_id < sequence_groups.size(); ++group_id) {
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[group_id];
+            if (sequence_group->is_scheduled()) {
+                record.scheduled_request_ids.push_back(sequence_group->get_request_id());
+            } else if (sequence_group->has_finished()) {
+                continue;
+            } else if (sequence_group->is_waiting()) {
+                record.skipped_request_ids.emplace_back(sequence_group->get_request_id(),
+                                                        SchedulingDecisionRecord::SkipReason::WAITING);
+            } else {
+                record.skipped_request_ids.emplace_back(sequence_group->get_request_id(),
+                                                        token_budget_exhausted
+                                                            ? SchedulingDecisionRecord::SkipReason::TOKEN_BUDGET
+                                                            : SchedulingDecisionRecord::SkipReason::BLOCK_SHORTAGE);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_decision_history_mutex);
+        m_decision_history.push_back(std::move(record));
+        if (m_decision_history.size() > DECISION_HISTORY_SIZE) {
+            m_decision_history.pop_front();
+        }
+    }
+
     bool _preempt_by_recompute(SequenceGroup::Ptr sequence_group, size_t blocks_needed) {
+        ++m_num_preemptions_this_step;
         size_t processed_tokens = sequence_group->get_num_processed_tokens();
         size_t prev_blocks_count = m_block_manager->num_free_blocks();
         size_t preempted_tokens = 0;
@@ -165,6 +326,9 @@ private:
 
         if (num_blocks_occupied_by_sequence <= blocks_needed || !m_can_use_partial_preemption || was_evicted_from) {
             auto sequences = sequence_group->get_not_finished_sequences();
+            // full preemption: offload the computed blocks to host memory if possible, so
+            // resumption costs a copy back instead of a prompt recompute
+            _maybe_swap_out(sequence_group, sequences, was_evicted_from);
             for (size_t s = 0; s < sequences.size(); ++s) {
                 auto seq_id = sequences[s]->get_id();
                 m_block_manager->free_sequence(seq_id);
@@ -210,31 +374,49 @@ private:
     }
 
     static size_t _get_low_priority_sequence_group_id(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        // preempt-lowest-first: among the groups holding KV blocks, the victim is the one with the
+        // lowest scheduling priority; within a priority class, the latest arrival is chosen as before
+        size_t victim_group_idx = std::numeric_limits<size_t>::max();
+        size_t victim_priority = 0;
         for (size_t seq_group_id = 0, num_groups = sequence_groups.size(); seq_group_id < num_groups; ++seq_group_id) {
             size_t group_idx = num_groups - seq_group_id - 1;
-            SequenceGroup::CPtr sequence_group = sequence_groups[group_idx];
+            // reference, not a copy: these loops run per group per step and the shared_ptr
+            // refcount traffic is pure overhead on the scheduling hot path
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[group_idx];
             if (sequence_group->get_num_processed_tokens() > 0) {
-                // we are here, because current sequence group has some reserved KV blocks in block manager
-                // which can be freed
-                return group_idx;
+                // this sequence group has some reserved KV blocks in block manager which can be freed
+                size_t group_priority = sequence_group->get_sampling_parameters().scheduling_priority;
+                if (victim_group_idx == std::numeric_limits<size_t>::max() || group_priority < victim_priority) {
+                    victim_group_idx = group_idx;
+                    victim_priority = group_priority;
+                }
             }
         }
 
-        return std::numeric_limits<size_t>::max();
+        return victim_group_idx;
     }
 
     void _apply_preemption(size_t sequence_group_id, const std::vector<SequenceGroup::Ptr>& sequence_groups) {
-        SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
+        const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
+        size_t requester_priority = sequence_group->get_sampling_parameters().scheduling_priority;
 
         // check whether current sequence requires a new slot / block
         while (!m_block_manager->can_append_slots(sequence_group)) {
             // let's run a sequence for eviction
             size_t evicted_sequence_group_id = _get_low_priority_sequence_group_id(sequence_groups);
 
-            if (evicted_sequence_group_id <= sequence_group_id) {
+            if (evicted_sequence_group_id == std::numeric_limits<size_t>::max() ||
+                evicted_sequence_group_id == sequence_group_id) {
                 // we have a cycle when current group need to evict itself to be in a running state
                 break;
             }
+            size_t victim_priority = sequence_groups[evicted_sequence_group_id]->get_sampling_parameters().scheduling_priority;
+            if (victim_priority > requester_priority ||
+                (victim_priority == requester_priority && evicted_sequence_group_id <= sequence_group_id)) {
+                // never preempt a more important tenant; within the same class keep the original
+                // rule of only evicting later arrivals
+                break;
+            }
             size_t blocks_needed = m_block_manager->required_blocks_count(sequence_group);
             if (!_preempt_by_recompute(sequence_groups[evicted_sequence_group_id], blocks_needed)){
                 break;
@@ -251,8 +433,15 @@ private:
         //    greedy scheduling of prompt with higher priority
         // 2. The mechanism below performs greedy scheduling of high priority prompts
 
+        // chunked prefill: prompt tokens can occupy only a bounded share of the megabatch,
+        // so decode-phase sequences (scheduled before this method) are not starved by long prompts
+        size_t prefill_tokens_budget = m_effective_max_num_batched_tokens;
+        if (m_config.max_prefill_tokens_ratio < 1.0f) {
+            prefill_tokens_budget = std::max<size_t>(1, static_cast<size_t>(m_effective_max_num_batched_tokens * m_config.max_prefill_tokens_ratio));
+        }
+
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
-            SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
             if (!sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
                 // prompt phases can have a single running sequence
@@ -260,10 +449,20 @@ private:
                 Sequence::Ptr sequence = (*sequence_group)[0];
                 uint64_t seq_id = sequence->get_id();
 
-                size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+                // per-request block share cap: do not admit further prompt chunks for a request
+                // already occupying its share of the pool, so one long-context tenant cannot
+                // starve the others during prefill
+                if (m_config.max_block_share_per_request < 1.0f) {
+                    size_t cap_blocks = static_cast<size_t>(m_config.max_block_share_per_request * m_block_manager->get_total_number_of_kv_blocks());
+                    if (sequence_group->get_num_blocks() >= cap_blocks)
+                        continue;
+                }
+
+                size_t num_tokens_in_megabatch = m_effective_max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t num_available_tokens = sequence_group->get_num_available_tokens_for_batching();
 
-                // apply megabatch limitations
+                // apply megabatch and prefill budget limitations
+                num_tokens_in_megabatch = std::min(num_tokens_in_megabatch, prefill_tokens_budget);
                 size_t num_scheduled_tokens = std::min(num_tokens_in_megabatch, num_available_tokens);
 
                 // apply KV cache limitations
@@ -297,10 +496,13 @@ private:
                         scheduler_output.m_block_tables[seq_id] = m_block_manager->get_block_tables(seq_id);
                         scheduler_output.m_total_num_scheduled_tokens += num_scheduled_tokens * num_running_seqs;
                     }
+
+                    prefill_tokens_budget -= num_scheduled_tokens;
                 }
 
-                // if we added maximum amount of tokens to compute
-                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                // if we exhausted either the megabatch or the prefill budget
+                if (scheduler_output.m_total_num_scheduled_tokens >= m_effective_max_num_batched_tokens ||
+                    prefill_tokens_budget == 0)
                     break;
             }
         }
@@ -310,7 +512,7 @@ private:
                                                      Output& scheduler_output,
                                                      std::map<size_t, std::list<size_t>>& block_copy_map) {
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
-            SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
             // Note, that can_generate_tokens will mix preempted sequence groups
             // and real generate ones
             // Question: do we need to schedule preeempted first as it's done in vLLM?
@@ -319,7 +521,7 @@ private:
             if (sequence_group->can_generate_tokens() && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
                 OPENVINO_ASSERT(!sequence_group->has_finished());
                 size_t num_running_seqs = sequence_group->num_running_seqs();
-                size_t num_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+                size_t num_tokens_in_megabatch = m_effective_max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t available_tokens_per_seq_in_megabatch = num_tokens_in_megabatch / num_running_seqs;
 
                 // we cannot schedule even a single token per each sequence in a group
@@ -372,7 +574,7 @@ private:
                 }
 
                 // if we added maximum amount of tokens to compute
-                if (scheduler_output.m_total_num_scheduled_tokens == m_config.max_num_batched_tokens)
+                if (scheduler_output.m_total_num_scheduled_tokens >= m_effective_max_num_batched_tokens)
                     break;
             }
         }
@@ -393,7 +595,7 @@ private:
         size_t num_running_sequence_groups = _num_running_sequence_groups(sequence_groups);
 
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
-            SequenceGroup::Ptr sequence_group = sequence_groups[sequence_group_id];
+            const SequenceGroup::Ptr& sequence_group = sequence_groups[sequence_group_id];
             const bool recompute_evicted_sequences = sequence_group->get_num_processed_tokens() == 0 && !m_can_use_partial_preemption;
             if ((!sequence_group->can_generate_tokens() || recompute_evicted_sequences) && !sequence_group->is_waiting() && !sequence_group->handle_stopped() && !sequence_group->handle_cancelled()) {
                 size_t num_running_seqs = sequence_group->num_running_seqs();
@@ -402,7 +604,7 @@ private:
                 // here we also assume that sequence must be scheduler in a single shot and has no already generated context
                 if (!m_config.enable_prefix_caching)
                     OPENVINO_ASSERT(sequence_group->get_context_len() == 0);
-                size_t num_available_tokens_in_megabatch = m_config.max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
+                size_t num_available_tokens_in_megabatch = m_effective_max_num_batched_tokens - scheduler_output.m_total_num_scheduled_tokens;
                 size_t sequence_len = sequence_group->get_num_available_tokens_for_batching();
 
                 // TODO: better handling
@@ -428,6 +630,12 @@ private:
                 if (!m_block_manager->can_allocate_blocks(num_required_blocks))
                     break;
 
+                // predictive admission: require headroom for the forecasted peak demand of the
+                // request, not just its prompt, to avoid admit-then-thrash preemption cycles
+                if (m_config.enable_predictive_admission && sequence_group->get_num_processed_tokens() == 0 &&
+                    !m_block_manager->can_allocate_blocks(_predicted_peak_blocks(sequence_group)))
+                    break;
+
                 // add scheduling information
                 {
                     Sequence::Ptr sequence = (*sequence_group)[0];
@@ -455,6 +663,53 @@ private:
         }
     }
 
+    void _update_generation_len_statistics(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        constexpr float ewma_alpha = 0.1f;
+        std::set<uint64_t> live_request_ids;
+        for (const auto& sequence_group : sequence_groups) {
+            uint64_t request_id = sequence_group->get_request_id();
+            live_request_ids.insert(request_id);
+            size_t max_generated_len = 0;
+            for (const auto& sequence : sequence_group->get_sequences()) {
+                max_generated_len = std::max(max_generated_len, sequence->get_generated_len());
+            }
+            m_last_seen_generated_len[request_id] = max_generated_len;
+        }
+        // fold the lengths of departed (finished/dropped) requests into the estimate
+        for (auto it = m_last_seen_generated_len.begin(); it != m_last_seen_generated_len.end();) {
+            if (live_request_ids.count(it->first)) {
+                ++it;
+                continue;
+            }
+            if (!m_has_generation_len_estimate) {
+                m_avg_generation_len = static_cast<float>(it->second);
+                m_has_generation_len_estimate = true;
+            } else {
+                m_avg_generation_len = ewma_alpha * it->second + (1.f - ewma_alpha) * m_avg_generation_len;
+            }
+            it = m_last_seen_generated_len.erase(it);
+        }
+    }
+
+    // Forecasted peak block demand of a fresh request: prompt plus expected generation length.
+    // Until the first request completes, only max_new_tokens bounds the estimate.
+    size_t _predicted_peak_blocks(const SequenceGroup::Ptr& sequence_group) const {
+        size_t expected_new_tokens = sequence_group->get_max_new_tokens();
+        if (m_has_generation_len_estimate) {
+            expected_new_tokens = std::min(expected_new_tokens, static_cast<size_t>(m_avg_generation_len + 1.f));
+        }
+        size_t block_size = m_block_manager->get_block_size();
+        size_t peak_tokens = sequence_group->get_prompt_len() + expected_new_tokens;
+        size_t peak_blocks = (peak_tokens + block_size - 1) / block_size;
+        const auto& sampling_params = sequence_group->get_sampling_parameters();
+        if (sampling_params.is_beam_search()) {
+            peak_blocks *= sampling_params.num_beams;
+        } else if (sampling_params.is_multinomial()) {
+            peak_blocks *= sampling_params.num_return_sequences;
+        }
+        return peak_blocks;
+    }
+
     void _clear_waiting_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
         for (size_t sequence_group_id = 0; sequence_group_id < sequence_groups.size(); ++sequence_group_id) {
             sequence_groups[sequence_group_id]->clear_waiting_sequences();
@@ -506,10 +761,166 @@ private:
             }
             blocks_sum += blocks_num;
         }
-        m_block_manager->increase_kv_blocks_number(blocks_sum);
+        blocks_sum = _reserve_shared_budget_blocks(blocks_sum);
+        if (blocks_sum > 0) {
+            m_block_manager->increase_kv_blocks_number(blocks_sum);
+        }
         m_dynamic_memory_allocation = true;
     }
 
+    bool _maybe_swap_out(const SequenceGroup::Ptr& sequence_group, const std::vector<Sequence::Ptr>& sequences, bool was_evicted_from) {
+        // offload only the simple case: single-sequence groups with intact (non-evicted) caches
+        // and no prefix caching, whose blocks are exclusively owned by the sequence
+        if (!m_config.enable_kv_cache_offload || was_evicted_from || m_config.enable_prefix_caching)
+            return false;
+        if (sequences.size() != 1)
+            return false;
+        size_t num_processed_tokens = sequence_group->get_num_processed_tokens();
+        if (num_processed_tokens == 0)
+            return false;
+        uint64_t seq_id = sequences[0]->get_id();
+        if (!m_block_manager->has_block_table(seq_id))
+            return false;
+
+        const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+        std::vector<std::vector<size_t>> per_layer_block_ids(block_tables.size());
+        for (size_t layer_idx = 0; layer_idx < block_tables.size(); ++layer_idx) {
+            per_layer_block_ids[layer_idx].reserve(block_tables[layer_idx].size());
+            for (const auto& block : block_tables[layer_idx]) {
+                per_layer_block_ids[layer_idx].push_back(block->get_index());
+            }
+        }
+
+        SwappedOutSequence swapped;
+        swapped.host_blocks = m_cache_manager->swap_out_blocks(per_layer_block_ids);
+        swapped.num_processed_tokens = num_processed_tokens;
+        swapped.num_blocks = block_tables[0].size();
+        m_swapped_out_sequences[seq_id] = std::move(swapped);
+        return true;
+    }
+
+    void _try_swap_in_sequences(const std::vector<SequenceGroup::Ptr>& sequence_groups) {
+        if (m_swapped_out_sequences.empty())
+            return;
+        for (const auto& sequence_group : sequence_groups) {
+            auto sequences = sequence_group->get_not_finished_sequences();
+            if (sequences.size() != 1)
+                continue;
+            uint64_t seq_id = sequences[0]->get_id();
+            auto it = m_swapped_out_sequences.find(seq_id);
+            if (it == m_swapped_out_sequences.end())
+                continue;
+            if (sequence_group->get_num_processed_tokens() != 0) {
+                // the group was re-processed through the recompute path, the host copy is stale
+                m_swapped_out_sequences.erase(it);
+                continue;
+            }
+            if (!m_block_manager->can_allocate_blocks(it->second.num_blocks))
+                continue;
+
+            m_block_manager->allocate(sequences[0], it->second.num_blocks, sequence_group->get_prompt_len());
+            const auto& block_tables = m_block_manager->get_block_tables(seq_id);
+            std::vector<std::vector<size_t>> per_layer_block_ids(block_tables.size());
+            for (size_t layer_idx = 0; layer_idx < block_tables.size(); ++layer_idx) {
+                per_layer_block_ids[layer_idx].reserve(block_tables[layer_idx].size());
+                for (const auto& block : block_tables[layer_idx]) {
+                    per_layer_block_ids[layer_idx].push_back(block->get_index());
+                }
+            }
+            m_cache_manager->swap_in_blocks(it->second.host_blocks, per_layer_block_ids);
+            sequence_group->update_processed_tokens_num(it->second.num_processed_tokens);
+            m_swapped_out_sequences.erase(it);
+        }
+
+        // purge host copies of sequences that left the pipeline (finished or dropped while
+        // preempted): such sequences never go through free_sequence since their block tables
+        // were already released by the preemption itself
+        if (!m_swapped_out_sequences.empty()) {
+            std::set<uint64_t> live_sequence_ids;
+            for (const auto& sequence_group : sequence_groups) {
+                for (const auto& sequence : sequence_group->get_sequences()) {
+                    live_sequence_ids.insert(sequence->get_id());
+                }
+            }
+            for (auto it = m_swapped_out_sequences.begin(); it != m_swapped_out_sequences.end();) {
+                it = live_sequence_ids.count(it->first) ? std::next(it) : m_swapped_out_sequences.erase(it);
+            }
+        }
+    }
+
+    // Reserves up to `want_blocks` from the shared budget; returns the number of granted blocks
+    // (want_blocks when no budget is attached)
+    size_t _reserve_shared_budget_blocks(size_t want_blocks) {
+        if (!m_shared_cache_budget_bytes || want_blocks == 0) {
+            return want_blocks;
+        }
+        const int64_t block_size_in_bytes = static_cast<int64_t>(m_cache_manager->get_block_size_in_bytes());
+        int64_t remaining = m_shared_cache_budget_bytes->load();
+        size_t granted = 0;
+        while (true) {
+            granted = std::min<size_t>(want_blocks, remaining > 0 ? static_cast<size_t>(remaining / block_size_in_bytes) : 0);
+            if (granted == 0) {
+                return 0;
+            }
+            int64_t new_remaining = remaining - static_cast<int64_t>(granted) * block_size_in_bytes;
+            if (m_shared_cache_budget_bytes->compare_exchange_weak(remaining, new_remaining)) {
+                return granted;
+            }
+        }
+    }
+
+    void _release_shared_budget_blocks(size_t num_blocks) {
+        if (m_shared_cache_budget_bytes && num_blocks > 0) {
+            m_shared_cache_budget_bytes->fetch_add(static_cast<int64_t>(num_blocks * m_cache_manager->get_block_size_in_bytes()));
+        }
+    }
+
+    void _apply_pending_limits_update() {
+        std::optional<SchedulerConfig> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_pending_config_mutex);
+            if (!m_pending_config.has_value()) {
+                return;
+            }
+            pending.swap(m_pending_config);
+        }
+        // capacity / latency limits are safe to change between steps
+        m_config.max_num_batched_tokens = pending->max_num_batched_tokens;
+        m_config.max_num_seqs = pending->max_num_seqs;
+        m_config.max_prefill_tokens_ratio = pending->max_prefill_tokens_ratio;
+        m_config.max_block_share_per_request = pending->max_block_share_per_request;
+        m_config.enable_predictive_admission = pending->enable_predictive_admission;
+        m_config.step_time_slo_ms = pending->step_time_slo_ms;
+        m_effective_max_num_batched_tokens = m_config.max_num_batched_tokens;
+    }
+
+    void _maybe_shrink_cache(float cache_usage_percent) {
+        if (!m_dynamic_memory_allocation) {
+            return;
+        }
+        // CacheManager cannot release GPU remote tensors, so shrinking the block pool there
+        // would lose capacity without returning any memory
+        if (m_cache_manager->get_device().find("GPU") != std::string::npos) {
+            return;
+        }
+        if (cache_usage_percent >= m_cache_shrink_low_watermark) {
+            m_num_steps_below_low_watermark = 0;
+            return;
+        }
+        if (++m_num_steps_below_low_watermark < m_cache_shrink_observation_window) {
+            return;
+        }
+        m_num_steps_below_low_watermark = 0;
+
+        // mirror the growth factor so that the pool oscillates between the same sizes it grew through
+        size_t total_blocks = m_block_manager->get_total_number_of_kv_blocks();
+        size_t target_blocks = std::max<size_t>(total_blocks / m_cache_growth_factor, 1);
+        if (target_blocks < total_blocks && m_block_manager->try_shrink_kv_blocks(target_blocks)) {
+            m_cache_manager->shrink_cache_to(target_blocks);
+            _release_shared_budget_blocks(total_blocks - target_blocks);
+        }
+    }
+
     bool _try_increase_cache() {
         if (!m_dynamic_memory_allocation) {
             return false;
@@ -519,21 +930,24 @@ private:
         size_t new_blocks_num = current_num_of_kv_blocks * m_cache_growth_factor;
 
         if (device.find("GPU") == std::string::npos) {
-            m_block_manager->increase_kv_blocks_number(new_blocks_num);
+            size_t granted_blocks = _reserve_shared_budget_blocks(new_blocks_num - current_num_of_kv_blocks);
+            if (granted_blocks == 0) {
+                return false;
+            }
+            m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + granted_blocks);
         } else {
             const size_t available_gpu_memory = _get_available_gpu_memory();
             const size_t block_size_in_bytes = m_cache_manager->get_block_size_in_bytes();
             size_t required_memory = (new_blocks_num - current_num_of_kv_blocks) * block_size_in_bytes;
-            if (required_memory <= available_gpu_memory) {
-                m_block_manager->increase_kv_blocks_number(new_blocks_num);
-            } else {
-                size_t possible_blocks_to_add = available_gpu_memory / block_size_in_bytes;
-                if (possible_blocks_to_add > 0) {
-                    m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + possible_blocks_to_add);
-                } else {
-                    return false;
-                }
+            size_t wanted_blocks = new_blocks_num - current_num_of_kv_blocks;
+            if (required_memory > available_gpu_memory) {
+                wanted_blocks = available_gpu_memory / block_size_in_bytes;
+            }
+            size_t granted_blocks = _reserve_shared_budget_blocks(wanted_blocks);
+            if (granted_blocks == 0) {
+                return false;
             }
+            m_block_manager->increase_kv_blocks_number(current_num_of_kv_blocks + granted_blocks);
         }
         return true;
     }
@@ -17,23 +17,27 @@ size_t Sequence::_make_hash(size_t content_length) {
             block_start_idx -= block_size;
         }
 
-        // hash of current block depends on prefix hashes
+        // hash of current block is chained through the hash of the previous block, which transitively
+        // encodes the whole prefix; this keeps the computation O(block_size) regardless of the prefix length
         std::vector<int64_t> content;
+        content.reserve(block_size + 1);
         size_t prefix_hashes_needed_count = block_start_idx / block_size;
-        OPENVINO_ASSERT(prefix_hashes_needed_count <= m_prefix_hashes.size()); 
-        content.insert(content.end(), m_prefix_hashes.begin(), m_prefix_hashes.begin() + prefix_hashes_needed_count);
+        OPENVINO_ASSERT(prefix_hashes_needed_count <= m_prefix_hashes.size());
+        if (prefix_hashes_needed_count > 0) {
+            content.push_back(m_prefix_hashes[prefix_hashes_needed_count - 1]);
+        }
 
         // get tokens corresponding to current block
         if (sequence_group->get_sequence_group_type() == SequenceGroupType::TOKENS) {
             const auto prompt_ids = sequence_group->get_prompt_ids();
-            OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids.size());
+            OPENVINO_ASSERT(content_length <= prompt_ids.size() + m_generated_ids->size());
             if (block_start_idx < prompt_ids.size()) {
                 content.insert(content.end(), prompt_ids.begin() + block_start_idx, prompt_ids.begin() + std::min(prompt_ids.size(), content_length));
             }
             if (content_length > prompt_ids.size()) {
                 size_t start = block_start_idx < prompt_ids.size() ? 0 : block_start_idx - prompt_ids.size();
                 // Use parentheses around (content_length - prompt_ids.size()) to suppress MSVC debug assert: "cannot seek vector iterator after end"
-                content.insert(content.end(), m_generated_ids.begin() + start, m_generated_ids.begin() + (content_length - prompt_ids.size()));
+                content.insert(content.end(), m_generated_ids->begin() + start, m_generated_ids->begin() + (content_length - prompt_ids.size()));
             }
         }
         else if (sequence_group->get_sequence_group_type() == SequenceGroupType::EMBEDDINGS) {
@@ -5,6 +5,7 @@
 
 #include <vector>
 #include <cassert>
+#include <chrono>
 #include <set>
 #include <cstdlib>
 #include <string_view>
@@ -13,6 +14,7 @@
 #include "openvino/genai/generation_handle.hpp"
 #include "openvino/genai/generation_config.hpp"
 #include "generation_stream.hpp"
+#include "object_pool.hpp"
 
 namespace ov::genai {
 enum class SequenceStatus {
@@ -39,7 +41,11 @@ class Sequence {
         return m_counter++;
     }
 
-    TokenIds m_generated_ids;
+    // Generated ids are shared copy-on-write between forked sequences: beam search forks
+    // candidates on every step and most forks are dropped before ever appending a token, so an
+    // eager copy is O(generated_len) per candidate for nothing. Mutators detach first; readers
+    // keep the contiguous-vector interface unchanged.
+    std::shared_ptr<TokenIds> m_generated_ids = std::make_shared<TokenIds>();
     LogProbs m_generated_log_probs;
     uint64_t m_grouped_id;
     uint64_t m_id = _get_next_global_sequence_id();
@@ -48,6 +54,10 @@ class Sequence {
     float m_cumulative_log_prob = 0.0f;
     std::vector<int64_t> m_prefix_hashes;
     SequenceGroup* m_sequence_group = nullptr;
+    // per-token log probs are recorded only when some consumer needs them (requested logprobs,
+    // beam search, echo, stop-string rollback, assisted validation); plain greedy/multinomial
+    // traffic skips a vector grow per token and a copy per notify
+    bool m_track_log_probs = true;
     static std::mutex m_counter_mutex;
     std::vector<std::vector<float>> m_generated_ids_embeds;
     SequenceGroupType m_type;
@@ -60,12 +70,21 @@ class Sequence {
 
     size_t _make_hash(size_t content_length);
 
+    // clones the generated ids when they are still shared with the fork source, making
+    // in-place mutation safe
+    void _detach_generated_ids() {
+        if (m_generated_ids.use_count() > 1) {
+            m_generated_ids = std::make_shared<TokenIds>(*m_generated_ids);
+        }
+    }
+
     static std::vector<int64_t> _reduce_embedding(const std::vector<float>& embedding);
 
     explicit Sequence(const uint64_t id, const SequenceGroupType type, const size_t hidden_size) : m_grouped_id(id), m_type(type), m_hidden_size(hidden_size) {}
 
     Sequence(const Sequence& seq, const uint64_t id) :
         m_generated_ids(seq.m_generated_ids),
+        m_track_log_probs(seq.m_track_log_probs),
         m_grouped_id(id),
         m_status(seq.m_status),
         m_cumulative_log_prob(seq.m_cumulative_log_prob),
@@ -79,6 +98,16 @@ public:
     using Ptr = std::shared_ptr<Sequence>;
     using CPtr = std::shared_ptr<const Sequence>;
 
+    // Sequences are created and forked at a high rate on the request hot path (especially with
+    // beam search), so their memory is recycled through a freelist pool instead of the heap
+    static void* operator new(size_t size) {
+        return ObjectChunkPool<Sequence>::instance().allocate(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        ObjectChunkPool<Sequence>::instance().deallocate(ptr, size);
+    }
+
     static Sequence::Ptr create(const uint64_t id, const SequenceGroupType type = SequenceGroupType::TOKENS, const size_t hidden_size = 0) {
         return Sequence::Ptr(new Sequence(id, type, hidden_size));
     }
@@ -128,27 +157,37 @@ public:
     }
 
     // appends new tokens to a generated part
+    void set_track_log_probs(bool track) {
+        m_track_log_probs = track;
+    }
+
     void append_token(int64_t token_id, float log_prob) {
         m_cumulative_log_prob += log_prob;
-        m_generated_log_probs.push_back(log_prob);
-        m_generated_ids.push_back(token_id);
+        if (m_track_log_probs) {
+            m_generated_log_probs.push_back(log_prob);
+        }
+        _detach_generated_ids();
+        m_generated_ids->push_back(token_id);
     }
 
     // removes n last tokens and updates cumulative log prob
     // used to remove stop_string from the output
     void remove_last_tokens(int n) {
-        OPENVINO_ASSERT(m_generated_ids.size() >= n, "Cannot remove more tokens than has been generated");
+        OPENVINO_ASSERT(m_generated_ids->size() >= n, "Cannot remove more tokens than has been generated");
+        _detach_generated_ids();
         for (int i = 0; i < n; i++) {
-            m_cumulative_log_prob -= m_generated_log_probs.back();
-            m_generated_log_probs.pop_back();
-            m_generated_ids.pop_back();
+            if (!m_generated_log_probs.empty()) {
+                m_cumulative_log_prob -= m_generated_log_probs.back();
+                m_generated_log_probs.pop_back();
+            }
+            m_generated_ids->pop_back();
         }
     }
 
     GenerationOutput get_last_generation_output(size_t token_cnt = 1, size_t num_token_to_ignore = 0) {
         GenerationOutput output;
         if (token_cnt > 0) {
-            OPENVINO_ASSERT(m_generated_ids.size());
+            OPENVINO_ASSERT(m_generated_ids->size());
             output.score = get_cumulative_log_prob();
 
             auto generated_token_id = get_generated_ids();
@@ -160,10 +199,13 @@ public:
                 auto offset_back = get_generated_len() - num_token_to_ignore;
 
                 std::vector<int64_t> token_id(generated_token_id.begin() + offset, generated_token_id.begin() + offset_back);
-                std::vector<float> log_probs(generated_log_probs.begin() + offset, generated_log_probs.begin() + offset_back);
 
                 output.generated_ids = token_id;
-                output.generated_log_probs = log_probs;
+                if (generated_log_probs.size() >= offset_back) {
+                    // log probs are present only when the request tracks them
+                    output.generated_log_probs.assign(generated_log_probs.begin() + offset,
+                                                      generated_log_probs.begin() + offset_back);
+                }
                 output.finish_reason = get_finish_reason();
             }
         }
@@ -171,11 +213,11 @@ public:
     }
 
     size_t get_generated_len() const {
-        return m_generated_ids.size();
+        return m_generated_ids->size();
     }
 
     const TokenIds & get_generated_ids() const {
-        return m_generated_ids;
+        return *m_generated_ids;
     }
 
     const LogProbs & get_generated_log_probs() const {
@@ -240,6 +282,7 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
     ov::genai::GenerationConfig m_sampling_params;
     std::size_t m_block_size;
     TokenIds m_prompt_ids;
+    ov::Tensor m_prompt_hidden_state;
     std::vector<std::vector<float>> m_input_embeds;
     std::vector<float> m_prompt_log_probs;
     GenerationStream::Ptr m_generation_stream;
@@ -265,6 +308,9 @@ class SequenceGroup  : public std::enable_shared_from_this<SequenceGroup> {
 
     size_t m_num_streamed_tokens = 0, m_stream_window_size = 0;
 
+    // admission timestamp for server-side deadline handling
+    std::chrono::steady_clock::time_point m_creation_time = std::chrono::steady_clock::now();
+
     SequenceGroup(uint64_t request_id, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : m_request_id(request_id),
           m_sampling_params(sampling_params),
@@ -284,6 +330,22 @@ public:
     using Ptr = std::shared_ptr<SequenceGroup>;
     using CPtr = std::shared_ptr<const SequenceGroup>;
 
+    // Sequence groups are allocated and destroyed per request; recycle their memory through
+    // a freelist pool like for Sequence objects. Note that make_shared bypasses class-scope
+    // operator new, so pooled creation has to go through the create() factory below
+    static void* operator new(size_t size) {
+        return ObjectChunkPool<SequenceGroup>::instance().allocate(size);
+    }
+
+    static void operator delete(void* ptr, size_t size) {
+        ObjectChunkPool<SequenceGroup>::instance().deallocate(ptr, size);
+    }
+
+    template <typename... Args>
+    static Ptr create(Args&&... args) {
+        return Ptr(new SequenceGroup(std::forward<Args>(args)...));
+    }
+
     SequenceGroup(uint64_t request_id, const TokenIds& input_ids, const ov::genai::GenerationConfig& sampling_params, std::size_t block_size)
         : SequenceGroup(request_id, ov::Tensor(ov::element::i64, ov::Shape{input_ids.size()}, (void *)input_ids.data()), sampling_params, block_size) {
     }
@@ -319,7 +381,11 @@ public:
         m_prompt_log_probs.reserve(prompt_len);
 
         // create a single sequence
-        add_sequence(Sequence::create(m_next_sequence_id++, m_sequence_group_type, hidden_size));
+        auto sequence = Sequence::create(m_next_sequence_id++, m_sequence_group_type, hidden_size);
+        sequence->set_track_log_probs(sampling_params.logprobs > 0 || sampling_params.echo ||
+                                      sampling_params.is_beam_search() || sampling_params.is_assisting_generation() ||
+                                      !sampling_params.stop_strings.empty());
+        add_sequence(sequence);
     }
 
     void add_sequence(const Sequence::Ptr & sequence) {
@@ -327,6 +393,14 @@ public:
         m_sequences.emplace_back(sequence);
     }
 
+    // forces per-token log-prob recording regardless of the sampling parameters; used by
+    // validation-mode and assisting pipelines whose acceptance math reads them
+    void set_track_log_probs(bool track) {
+        for (auto& sequence : m_sequences) {
+            sequence->set_track_log_probs(track);
+        }
+    }
+
     void remove_sequence(uint64_t sequence_id) {
         auto remove_it = std::remove_if(m_sequences.begin(), m_sequences.end(), [sequence_id] (Sequence::Ptr seq) {
             return seq->get_id() == sequence_id;
@@ -351,6 +425,10 @@ public:
         m_is_gen_paused = status;
     }
 
+    bool is_generation_paused() const {
+        return m_is_gen_paused;
+    }
+
     // a sequence group can generate new tokens if it already processed m_max_content_len before
     bool can_generate_tokens() const {
         return m_max_content_len + m_num_validation_tokens >= get_prompt_len() && !m_is_gen_paused;
@@ -589,6 +667,16 @@ public:
         }
     }
 
+    // final-layer hidden state of the last prompt token, captured when the pipeline was built
+    // with enable_hidden_state_output (embedding mode); empty otherwise
+    void set_prompt_hidden_state(const ov::Tensor& hidden_state) {
+        m_prompt_hidden_state = hidden_state;
+    }
+
+    const ov::Tensor& get_prompt_hidden_state() const {
+        return m_prompt_hidden_state;
+    }
+
     const TokenIds& get_prompt_ids() const {
         return m_prompt_ids;
     }
@@ -638,6 +726,24 @@ public:
         return m_sampling_params;
     }
 
+    std::chrono::steady_clock::time_point get_creation_time() const {
+        return m_creation_time;
+    }
+
+    // whether the request's server-side deadline (GenerationConfig::request_timeout_s) passed
+    bool is_deadline_expired() const {
+        if (m_sampling_params.request_timeout_s <= 0.f) {
+            return false;
+        }
+        auto elapsed = std::chrono::duration<float>(std::chrono::steady_clock::now() - m_creation_time).count();
+        return elapsed > m_sampling_params.request_timeout_s;
+    }
+
+    // used by speculative decoding to adapt the draft length to the observed acceptance rate
+    void set_num_assistant_tokens(size_t num_assistant_tokens) {
+        m_sampling_params.num_assistant_tokens = num_assistant_tokens;
+    }
+
     void set_out_of_memory() {
         for (size_t seq_id = 0; seq_id < m_sequences.size(); ++seq_id) {
             if (m_sequences[seq_id]->is_running()) {
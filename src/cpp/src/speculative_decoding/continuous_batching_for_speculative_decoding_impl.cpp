@@ -1,6 +1,8 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
+
 #include "continuous_batching_for_speculative_decoding_impl.hpp"
 
 namespace ov::genai {
@@ -16,6 +18,9 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::Contin
     m_tokenizer = tokenizer;
     m_generation_config = generation_config;
     m_is_validation_mode_enabled = is_validation_mode_enabled;
+    // both the draft (producer) and the main (validator) side read per-token log probs for
+    // speculative acceptance, independent of the user's logprobs setting
+    m_force_track_log_probs = true;
     initialize_pipeline(model, scheduler_config, device, plugin_config, kv_cache_configs);
 }
 
@@ -52,9 +57,7 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_ge
     GeneratedRequests result;
     for (const auto& request : m_requests) {
         const auto& request_id = request->get_request_id();
-        if (!result.count(request_id)) {
-            result.insert({request_id, {{}} });
-        }
+        // operator[] default-constructs the per-request map on first touch, one lookup per request
         auto& generated_request = result[request_id];
         for (const auto& sequence : request->get_running_sequences()) {
             const auto& sequence_id = sequence->get_grouped_id();
@@ -86,14 +89,12 @@ get_prefix_len(
         const size_t candidate_sequence_gen_len = candidate_token_ids.size(),
                      running_sequence_gen_len = running_sequence->get_generated_len();
         
-        // to find the len of prefix
-        size_t sequence_prefix_len = std::min(candidate_sequence_gen_len, running_sequence_gen_len);
-        for (size_t i = 0; i < sequence_prefix_len; ++i) {
-            if (candidate_token_ids[i] != running_token_ids[i]) {
-                sequence_prefix_len = i;
-                break;
-            }
-        }
+        // to find the len of prefix: std::mismatch over the contiguous token arrays compiles down
+        // to a vectorized early-exit comparison instead of the previous scalar per-token loop
+        size_t compare_len = std::min(candidate_sequence_gen_len, running_sequence_gen_len);
+        auto mismatch_pair = std::mismatch(candidate_token_ids.begin(), candidate_token_ids.begin() + compare_len,
+                                           running_token_ids.begin());
+        size_t sequence_prefix_len = std::distance(candidate_token_ids.begin(), mismatch_pair.first);
 
         min_generated_tokens = std::min(sequence_prefix_len, min_generated_tokens);
         min_candidate_len = std::min(candidate_sequence_gen_len, min_candidate_len);
@@ -288,6 +289,7 @@ bool ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::i
 }
 
 std::vector<SequenceGroup::Ptr> ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_awaiting_requests() {
+    _drain_intake_queue();
     return m_awaiting_requests;
 }
 
@@ -295,8 +297,27 @@ size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl:
     return m_batch_size;
 }
 
+size_t ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::get_num_assistant_tokens(int64_t request_id) const {
+    for (const auto& request : m_requests) {
+        if (request->get_request_id() == static_cast<uint64_t>(request_id)) {
+            return request->get_sampling_parameters().num_assistant_tokens;
+        }
+    }
+    return 0;
+}
+
+void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::set_num_assistant_tokens(int64_t request_id, size_t num_assistant_tokens) {
+    for (auto& request : m_requests) {
+        if (request->get_request_id() == static_cast<uint64_t>(request_id)) {
+            request->set_num_assistant_tokens(num_assistant_tokens);
+            return;
+        }
+    }
+}
+
 void
 ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_awaiting_requests(bool is_pause_request) {
+    _drain_intake_queue();
     std::lock_guard<std::mutex> lock{m_awaiting_requests_mutex};
     if (is_pause_request) {
         for (auto& awaiting_request : m_awaiting_requests) {
@@ -307,6 +328,16 @@ ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::pull_a
     m_awaiting_requests.clear();
 }
 
+// Draft cadence is per request despite the shared loop: each request pauses as soon as its own
+// (adaptively tuned) num_assistant_tokens window is drafted, so later iterations run with only
+// the still-drafting requests in the batch and a short-window request never subsidizes a long
+// one. What stays batch-wide is the validation barrier in SpeculativeDecodingImpl::step(): the
+// main model validates all windows in one infer. Splitting that into per-request validation
+// infers would remove the barrier but also the batching that makes validation affordable, and
+// draft/main state exchange (update_request in both directions around the barrier) means a
+// request cannot draft its next window before its previous one is validated - so fully
+// independent per-request speculation pipelines need duplicated main-model contexts rather than
+// a restructuring of this loop.
 void ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl::multistep() {
     bool to_generate = true;
     size_t generated_tokens_cnt = 0;
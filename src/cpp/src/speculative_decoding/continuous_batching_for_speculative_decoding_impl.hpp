@@ -9,6 +9,15 @@
 #include "speculative_decoding/update_request_structs.hpp"
 
 namespace ov::genai {
+
+// NOTE on tree-structured (Medusa/EAGLE-style) speculation: the building blocks on this side are
+// in place - BlockManager::fork_sequence shares prompt blocks copy-on-write, so k branching draft
+// paths can be materialized as forked sequences without duplicating the prompt cache, and
+// update_request's prefix alignment generalizes to accepting the longest matching path. What is
+// missing is target-side support: validating a token *tree* in one forward needs the attention
+// kernel to accept a per-token ancestor mask instead of the implicit linear causal order, which
+// the PagedAttention op does not expose. Until that lands in the op/plugins, multi-path validation
+// would cost one target forward per branch and lose against the linear draft it replaces.
 class ContinuousBatchingPipeline::ContinuousBatchingForSpeculativeDecodingImpl : public ContinuousBatchingPipeline::ContinuousBatchingImpl {
 public:
     ContinuousBatchingForSpeculativeDecodingImpl() = default;
@@ -33,6 +42,10 @@ public:
 
     size_t get_processed_tokens_per_iteration();
 
+    // draft length control for adaptive speculative decoding
+    size_t get_num_assistant_tokens(int64_t request_id) const;
+    void set_num_assistant_tokens(int64_t request_id, size_t num_assistant_tokens);
+
     UpdateRequestResult init_request_by_candidate(uint64_t request_id, const GeneratedSequences& candidates);
 
 protected:
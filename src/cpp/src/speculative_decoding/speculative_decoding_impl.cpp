@@ -45,29 +45,19 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
     ov::genai::SchedulerConfig main_scheduler_config_updated = main_scheduler_config,
                                draft_scheduler_config = is_draft_scheduler_undefined ? main_scheduler_config : draft_model_desc.scheduler_config;
 
-    if (is_draft_scheduler_undefined) {
-        // split KV cache to 2 caches for main and draft models
-        auto compute_total_hidden_size = [] (const std::vector<KVHeadConfig>& kv_cache_config) -> size_t {
-            size_t total_hidden_size = 0;
-            for (auto & config : kv_cache_config) {
-                total_hidden_size += config.k_head_size * config.num_k_heads + config.v_head_size * config.num_v_heads;
-            }
-            return total_hidden_size;
-        };
-        float main_model_hidden_size = compute_total_hidden_size(main_kv_cache_config),
-              draft_model_hidden_size = compute_total_hidden_size(draft_kv_cache_config);
-        auto k = draft_model_hidden_size / (main_model_hidden_size + draft_model_hidden_size);
-
-        // TODO: work with KV blocks as it will be more precise instead of GBs
-        size_t main_cache_size = std::ceil(main_scheduler_config.cache_size * (1.f - k)),
-               draft_cache_size = main_scheduler_config.cache_size - main_cache_size;
-        if (draft_cache_size == 0 && main_cache_size > 0) {
-            main_cache_size -= (main_cache_size > 1 ? 1 : 0);
-            draft_cache_size = 1;
-        }
-
-        main_scheduler_config_updated.cache_size = main_cache_size;
-        draft_scheduler_config.cache_size = draft_cache_size;
+    std::shared_ptr<std::atomic<int64_t>> shared_cache_budget;
+    if (is_draft_scheduler_undefined && main_scheduler_config.cache_size > 0 && main_scheduler_config.num_kv_blocks == 0) {
+        // Unified KV pool: instead of splitting cache_size statically between the models (which
+        // wastes the slack of whichever pool is under-occupied), both pipelines run with dynamic
+        // cache growth accounted against one shared byte budget of cache_size GB. Growth reserves
+        // from the budget, idle-time shrinking returns to it, so the main model can use capacity
+        // the draft does not need and vice versa.
+        shared_cache_budget = std::make_shared<std::atomic<int64_t>>(
+            static_cast<int64_t>(main_scheduler_config.cache_size) * 1024 * 1024 * 1024);
+        main_scheduler_config_updated.cache_size = 0;
+        main_scheduler_config_updated.num_kv_blocks = 0;
+        draft_scheduler_config.cache_size = 0;
+        draft_scheduler_config.num_kv_blocks = 0;
     }
 
     ov::AnyMap draft_properties = draft_model_desc.properties.empty() ? main_model_desc.properties : draft_model_desc.properties;
@@ -90,6 +80,11 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::SpeculativeDecodingImpl(con
         draft_model, draft_model_tokenizer, draft_model_desc.generation_config,
         draft_kv_cache_config, draft_scheduler_config, draft_device, draft_properties, false);
 
+    if (shared_cache_budget) {
+        m_main_pipeline->set_shared_cache_budget(shared_cache_budget);
+        m_draft_pipeline->set_shared_cache_budget(shared_cache_budget);
+    }
+
     m_perf_metrics = PerfMetrics();
     m_perf_metrics.raw_metrics.m_inference_durations =  {{ MicroSeconds(0.0f) }};
 
@@ -104,6 +99,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
     draft_sampling_params.stop_strings = {};
+    // the draft handle is internal and never read; backpressure must not pause the draft
+    draft_sampling_params.max_unread_stream_outputs = 0;
     m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, input_ids, draft_sampling_params)});
     return m_main_pipeline->add_request(request_id, input_ids, sampling_params);
 };
@@ -117,6 +114,8 @@ ContinuousBatchingPipeline::SpeculativeDecodingImpl::add_request(uint64_t reques
     auto draft_sampling_params = sampling_params;
     draft_sampling_params.ignore_eos = true;
     draft_sampling_params.stop_strings = {};
+    // the draft handle is internal and never read; backpressure must not pause the draft
+    draft_sampling_params.max_unread_stream_outputs = 0;
     m_draft_generations.insert({request_id, m_draft_pipeline->add_request(request_id, prompt, draft_sampling_params)});
     return m_main_pipeline->add_request(request_id, prompt, sampling_params);
 }
@@ -162,7 +161,7 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
     std::map<int64_t, UpdateRequestResult> update_sequence_info;
     // put candidates to model KV cache
     auto draft_generated_requests = m_draft_pipeline->get_generated_requests();
-    for (const auto& candidate : m_draft_pipeline->get_generated_requests()) {
+    for (const auto& candidate : draft_generated_requests) {
         auto update_result = m_main_pipeline->update_request(candidate.first, candidate.second, false);
         update_sequence_info.insert({{candidate.first, update_result}});
     }
@@ -196,6 +195,26 @@ void ContinuousBatchingPipeline::SpeculativeDecodingImpl::step() {
         float acceptance_rate = 1 - static_cast<float>(updated_seq_info.removed_tokens_cnt) / updated_seq_info.inserted_tokens_cnt;
         m_sd_metrics.update_acceptance_rate(request_id, acceptance_rate * 100);
         m_sd_metrics.update_draft_accepted_tokens(request_id, (updated_seq_info.inserted_tokens_cnt - updated_seq_info.removed_tokens_cnt));
+
+        // adapt the draft length to the smoothed acceptance rate: lengthen the speculation while
+        // drafts are mostly accepted, back off quickly once they start being rejected.
+        // Only applies to the fixed-K mode; assistant_confidence_threshold driven requests keep
+        // their own dynamic criterion
+        size_t current_num_assistant_tokens = m_draft_pipeline->get_num_assistant_tokens(request_id);
+        float acceptance_rate_ewma = m_sd_metrics.get_acceptance_rate_ewma(request_id);
+        if (current_num_assistant_tokens > 0 && acceptance_rate_ewma >= 0.f) {
+            constexpr float raise_threshold = 80.f, lower_threshold = 40.f;
+            constexpr size_t max_num_assistant_tokens = 16;
+            size_t next_num_assistant_tokens = current_num_assistant_tokens;
+            if (acceptance_rate_ewma > raise_threshold) {
+                next_num_assistant_tokens = std::min(current_num_assistant_tokens + 1, max_num_assistant_tokens);
+            } else if (acceptance_rate_ewma < lower_threshold && current_num_assistant_tokens > 1) {
+                next_num_assistant_tokens = current_num_assistant_tokens - 1;
+            }
+            if (next_num_assistant_tokens != current_num_assistant_tokens) {
+                m_draft_pipeline->set_num_assistant_tokens(request_id, next_num_assistant_tokens);
+            }
+        }
     }
 
     // update perf metrics
@@ -339,6 +358,19 @@ bool ContinuousBatchingPipeline::SpeculativeDecodingImpl::is_requests_empty() {
     return m_main_pipeline->is_requests_empty() && m_draft_pipeline->is_requests_empty();
 }
 
+SpeculativeDecodingSnapshot ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_speculative_decoding_snapshot() const {
+    // m_sd_metrics is updated after every step, so polling this during generation observes
+    // acceptance collapse within an iteration or two; the lock keeps add_request/step mutations
+    // of the underlying maps out of the copy
+    std::lock_guard<std::mutex> lock{m_draft_generations_mutex};
+    SpeculativeDecodingSnapshot snapshot;
+    snapshot.draft_duration_ms = m_sd_metrics.draft_duration;
+    snapshot.main_duration_ms = m_sd_metrics.main_duration;
+    snapshot.acceptance_rate_ewma_per_request = m_sd_metrics.get_acceptance_rate_ewma_map();
+    snapshot.acceptance_rate_histogram = m_sd_metrics.get_acceptance_rate_histogram();
+    return snapshot;
+}
+
 std::vector<SequenceGroup::Ptr> ContinuousBatchingPipeline::SpeculativeDecodingImpl::get_awaiting_requests() {
     auto main_awaiting_requests = m_main_pipeline->get_awaiting_requests();
     auto draft_awaiting_requests = m_draft_pipeline->get_awaiting_requests();
@@ -42,7 +42,7 @@ protected:
     PerfMetrics m_perf_metrics;
 
     // Mutex protecting access to m_draft_generations, so add_request and step methods can be called from different threads
-    std::mutex m_draft_generations_mutex;
+    mutable std::mutex m_draft_generations_mutex;
     std::map<uint64_t, GenerationHandle> m_draft_generations;
 
     void drop_requests();
@@ -69,6 +69,8 @@ public:
              const StreamerVariant& streamer) override;
 
     SpeculativeDecodingMetrics get_speculative_decoding_metrics();
+
+    SpeculativeDecodingSnapshot get_speculative_decoding_snapshot() const override;
 };
 
 }
\ No newline at end of file
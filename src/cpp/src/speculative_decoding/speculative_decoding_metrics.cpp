@@ -1,6 +1,7 @@
 // Copyright (C) 2023-2025 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 
+#include <algorithm>
 #include <numeric>
 
 #include "speculative_decoding/speculative_decoding_metrics.hpp"
@@ -32,6 +33,29 @@ void SpeculativeDecodingMetrics::update_acceptance_rate(int64_t request_id, floa
     } else {
         m_acceptance_rate.insert({ request_id, std::vector<float>{acceptance_rate} });
     }
+
+    // smoothing factor of the per-request estimator: high enough to react to content changes
+    // within a few iterations, low enough not to flap on a single rejected window
+    constexpr float ewma_alpha = 0.25f;
+    auto it = m_acceptance_rate_ewma.find(request_id);
+    if (it == m_acceptance_rate_ewma.end()) {
+        m_acceptance_rate_ewma.insert({request_id, acceptance_rate});
+    } else {
+        it->second = ewma_alpha * acceptance_rate + (1.f - ewma_alpha) * it->second;
+    }
+
+    size_t bucket = std::min<size_t>(m_acceptance_rate_histogram.size() - 1,
+                                     static_cast<size_t>(std::max(acceptance_rate, 0.f) / 10.f));
+    m_acceptance_rate_histogram[bucket]++;
+}
+
+float SpeculativeDecodingMetrics::get_acceptance_rate_ewma(int64_t request_id) {
+    auto it = m_acceptance_rate_ewma.find(request_id);
+    return it == m_acceptance_rate_ewma.end() ? -1.f : it->second;
+}
+
+const std::vector<size_t>& SpeculativeDecodingMetrics::get_acceptance_rate_histogram() const {
+    return m_acceptance_rate_histogram;
 }
 
 size_t SpeculativeDecodingMetrics::get_iteration_number(int64_t request_id) {
@@ -149,6 +173,8 @@ void SpeculativeDecodingMetrics::clean_up() {
     m_acceptance_rate.clear();
     m_draft_accepted_tokens.clear();
     m_generated_len.clear();
+    m_acceptance_rate_ewma.clear();
+    std::fill(m_acceptance_rate_histogram.begin(), m_acceptance_rate_histogram.end(), 0);
     draft_duration = 0;
     main_duration = 0;
     total_duration = 0;
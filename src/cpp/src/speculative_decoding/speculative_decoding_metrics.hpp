@@ -17,12 +17,24 @@ class SpeculativeDecodingMetrics {
     std::map<int64_t, size_t> m_draft_accepted_tokens;
     std::map<int64_t, size_t> m_generated_len;
 
+    // online estimators of the acceptance rate: per-request EWMA (percent) plus
+    // a global histogram with 10% wide buckets over all iterations of all requests
+    std::map<int64_t, float> m_acceptance_rate_ewma;
+    std::vector<size_t> m_acceptance_rate_histogram = std::vector<size_t>(10, 0);
+
 public:
     float draft_duration = 0, main_duration = 0, total_duration = 0;
 
     float get_avg_acceptance_rate(int64_t request_id);
     void update_acceptance_rate(int64_t request_id, float acceptance_rate);
 
+    // smoothed per-request acceptance rate in percent, or -1 if no iterations were recorded yet
+    float get_acceptance_rate_ewma(int64_t request_id);
+    const std::vector<size_t>& get_acceptance_rate_histogram() const;
+    const std::map<int64_t, float>& get_acceptance_rate_ewma_map() const {
+        return m_acceptance_rate_ewma;
+    }
+
     float get_draft_accepted_tokens_percentage(int64_t request_id);
     size_t get_draft_accepted_tokens_counter(int64_t request_id);
     void update_draft_accepted_tokens(int64_t request_id, size_t num_matches);
@@ -0,0 +1,111 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <deque>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace ov::genai {
+
+/**
+ * @brief Aho-Corasick automaton over the stop strings of a single request. Compiled once per
+ * GenerationConfig and reused for every generated token, so multi-pattern stop matching is a
+ * single O(length) scan of the decoded window regardless of the number of stop strings.
+ */
+class StopStringAutomaton {
+    struct Node {
+        std::map<unsigned char, int32_t> next;
+        int32_t fail = 0;
+        // length of the longest pattern ending at this state (via suffix links), 0 if none
+        size_t match_len = 0;
+    };
+    std::vector<Node> m_nodes;
+
+public:
+    explicit StopStringAutomaton(const std::set<std::string>& patterns) {
+        m_nodes.emplace_back();
+        for (const auto& pattern : patterns) {
+            if (pattern.empty())
+                continue;
+            int32_t node = 0;
+            for (unsigned char symbol : pattern) {
+                auto it = m_nodes[node].next.find(symbol);
+                if (it == m_nodes[node].next.end()) {
+                    int32_t new_node = static_cast<int32_t>(m_nodes.size());
+                    m_nodes[node].next.emplace(symbol, new_node);
+                    m_nodes.emplace_back();
+                    node = new_node;
+                } else {
+                    node = it->second;
+                }
+            }
+            m_nodes[node].match_len = std::max(m_nodes[node].match_len, pattern.size());
+        }
+
+        // BFS over the trie to set suffix (fail) links and propagate pattern ends
+        std::deque<int32_t> queue;
+        for (const auto& symbol_and_child : m_nodes[0].next) {
+            queue.push_back(symbol_and_child.second);
+        }
+        while (!queue.empty()) {
+            int32_t node = queue.front();
+            queue.pop_front();
+            for (const auto& symbol_and_child : m_nodes[node].next) {
+                unsigned char symbol = symbol_and_child.first;
+                int32_t child = symbol_and_child.second;
+                int32_t fail = m_nodes[node].fail;
+                while (fail != 0 && m_nodes[fail].next.find(symbol) == m_nodes[fail].next.end()) {
+                    fail = m_nodes[fail].fail;
+                }
+                auto it = m_nodes[fail].next.find(symbol);
+                m_nodes[child].fail = (it != m_nodes[fail].next.end() && it->second != child) ? it->second : 0;
+                m_nodes[child].match_len = std::max(m_nodes[child].match_len, m_nodes[m_nodes[child].fail].match_len);
+                queue.push_back(child);
+            }
+        }
+    }
+
+    struct Match {
+        bool is_matched = false;
+        size_t end_pos = 0; // index of the last character of the match in the scanned text
+        size_t length = 0;
+    };
+
+    /**
+     * Scans `text` and returns the earliest-ending occurrence of any pattern
+     * (the longest such pattern when several end at the same position).
+     */
+    Match find_first(const std::string& text) const {
+        int32_t state = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            unsigned char symbol = text[i];
+            while (state != 0 && m_nodes[state].next.find(symbol) == m_nodes[state].next.end()) {
+                state = m_nodes[state].fail;
+            }
+            auto it = m_nodes[state].next.find(symbol);
+            state = (it != m_nodes[state].next.end()) ? it->second : 0;
+            if (m_nodes[state].match_len > 0) {
+                return Match{true, i, m_nodes[state].match_len};
+            }
+        }
+        return Match{};
+    }
+};
+
+/**
+ * @brief Per-request stop string data prepared once by the Sampler: the token length of the decode
+ * window, the raw stop strings and the compiled matching automaton.
+ */
+struct ProcessedStopStrings {
+    // longest stop string length in tokens, defines the size of the decoded candidate window
+    size_t max_stop_string_token_len = 0;
+    std::set<std::string> stop_strings;
+    std::shared_ptr<StopStringAutomaton> automaton;
+};
+
+}
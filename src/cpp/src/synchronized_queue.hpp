@@ -5,6 +5,7 @@
 
 #include <queue>
 #include <mutex>
+#include <vector>
 #include <condition_variable>
 
 template <typename T>
@@ -34,12 +35,31 @@ public:
         return val;
     }
 
+    // Waits until at least one element is available and drains the whole queue at once,
+    // so a slow consumer can process the accumulated backlog in a single batch.
+    std::vector<T> pull_all() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]{return !m_queue.empty();});
+        std::vector<T> values;
+        values.reserve(m_queue.size());
+        while (!m_queue.empty()) {
+            values.push_back(std::move(m_queue.front()));
+            m_queue.pop();
+        }
+        return values;
+    }
+
     void push(const T& item) {
         std::unique_lock<std::mutex> lock(m_mutex);
         m_queue.push(item);
         m_cv.notify_one();
     }
 
+    size_t size() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_queue.size();
+    }
+
     bool empty() {
         std::unique_lock<std::mutex> lock(m_mutex);
         return m_queue.empty();
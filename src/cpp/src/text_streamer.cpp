@@ -9,6 +9,34 @@ bool is_incomplete(std::string& text) {
     constexpr char replacement[] = "\xef\xbf\xbd";
     return text.size() >= 3 && text.compare(text.size() - 3, 3, replacement) == 0;
 }
+
+// Largest end <= limit such that [0, end) does not cut a UTF-8 sequence. Byte-fallback
+// tokenizers emit raw partial sequences without the replacement character, so the printable
+// boundary has to be validated structurally; only the last <= 3 bytes before the limit are ever
+// inspected, keeping the check O(1) per write regardless of history length.
+size_t complete_utf8_prefix(const char* data, size_t limit) {
+    size_t distance = 0;
+    while (distance < 3 && distance < limit) {
+        const unsigned char byte = data[limit - 1 - distance];
+        if ((byte & 0x80) == 0) {
+            return limit;  // ASCII tail: nothing can be truncated
+        }
+        ++distance;
+        if ((byte & 0xC0) == 0xC0) {
+            // lead byte found `distance` bytes before the limit
+            size_t expected = 2;
+            if ((byte & 0xF0) == 0xE0) {
+                expected = 3;
+            } else if ((byte & 0xF8) == 0xF0) {
+                expected = 4;
+            }
+            return expected > distance ? limit - distance : limit;
+        }
+        // continuation byte: keep walking back
+    }
+    // no lead byte within 3 bytes: either complete or malformed - emit as-is
+    return limit;
+}
 }  // namespace
 
 namespace ov {
@@ -55,13 +83,61 @@ StreamingStatus TextStreamer::write(int64_t token) {
     if (print_until > -1 && print_until > m_printed_len) {
         // It is possible to have a shorter text after adding new token.
         // Print to output only if text length is increaesed.
-        res << std::string_view{text.data() + m_printed_len, print_until - m_printed_len} << std::flush;
-        m_printed_len = print_until;
+        // Never cut a UTF-8 sequence: hold truncated trailing bytes back until completed
+        size_t printable_until = complete_utf8_prefix(text.data(), static_cast<size_t>(print_until));
+        if (printable_until > m_printed_len) {
+            res << std::string_view{text.data() + m_printed_len, printable_until - m_printed_len} << std::flush;
+            m_printed_len = printable_until;
+        }
     }
 
+    maybe_compact_cache(text);
+
     return run_callback_if_needed(res.str());
 }
 
+void TextStreamer::maybe_compact_cache(const std::string& text) {
+    // Without a newline in the output the token cache only grows, and each write re-decodes the
+    // whole history, so emission cost grows with response length. Once the cache gets large, drop
+    // the tokens of the already printed stable prefix, provided that decoding the remaining suffix
+    // alone reproduces the unprinted text byte-for-byte (tokenizers are not prefix-stable in
+    // general, so this is verified before rebasing).
+    if (m_tokens_cache.size() < m_cache_compaction_threshold || m_printed_len == 0) {
+        return;
+    }
+
+    constexpr size_t delay_n_tokens = 3;
+    if (m_tokens_cache.size() <= delay_n_tokens) {
+        return;
+    }
+    // keep the delayed tail which may still change, drop only tokens fully covered by m_printed_len
+    size_t keep_from = m_tokens_cache.size() - delay_n_tokens;
+    compute_decoded_length_for_position(keep_from - 1);
+    int64_t prefix_len = m_decoded_lengths[keep_from - 1];
+    if (prefix_len < 0 || static_cast<size_t>(prefix_len) > m_printed_len) {
+        return;
+    }
+
+    std::vector<int64_t> suffix_tokens(m_tokens_cache.begin() + keep_from, m_tokens_cache.end());
+    std::string suffix_text = m_tokenizer.decode(suffix_tokens);
+    if (suffix_text != text.substr(prefix_len)) {
+        // seam is not stable at this boundary, retry later with a larger cache to amortize the check
+        m_cache_compaction_threshold *= 2;
+        return;
+    }
+
+    m_tokens_cache = std::move(suffix_tokens);
+    m_decoded_lengths.erase(m_decoded_lengths.begin(), m_decoded_lengths.begin() + keep_from);
+    // lengths of intermediate tail positions were measured against the old cache and are not
+    // guaranteed to shift by exactly prefix_len; mark them for recomputation on demand.
+    // The last position equals the verified suffix decode by construction
+    for (auto& decoded_length : m_decoded_lengths) {
+        decoded_length = -2;
+    }
+    m_decoded_lengths.back() = static_cast<int64_t>(suffix_text.size());
+    m_printed_len -= prefix_len;
+}
+
 void TextStreamer::compute_decoded_length_for_position(size_t cache_position) {
     // decode was performed for this position, skippping
     if (m_decoded_lengths[cache_position] != -2) {
@@ -75,18 +75,34 @@ private:
 
     void _worker() {
         while (m_status == StreamingStatus::RUNNING) {
-            // wait for queue pull
-            std::variant<int64_t, std::vector<int64_t>, std::monostate> token_variant = m_squeue.pull();
+            // drain everything pending and coalesce it into a single write, so one detokenizer
+            // call serves the whole backlog accumulated while the previous callback was running
+            auto token_variants = m_squeue.pull_all();
+
+            std::vector<int64_t> pending_tokens;
+            bool is_stop_requested = false;
+            for (auto& token_variant : token_variants) {
+                if (auto token = std::get_if<int64_t>(&token_variant)) {
+                    pending_tokens.push_back(*token);
+                } else if (auto tokens = std::get_if<std::vector<int64_t>>(&token_variant)) {
+                    pending_tokens.insert(pending_tokens.end(), tokens->begin(), tokens->end());
+                } else if (std::get_if<std::monostate>(&token_variant)) {
+                    is_stop_requested = true;
+                    break;
+                } else {
+                    OPENVINO_THROW("Internal error: unsupported threaded streamer value");
+                }
+            }
 
             // wait for streamer_ptr result
-            if (auto token = std::get_if<int64_t>(&token_variant)) {
-                m_status = _get_streaming_status(m_streamer_ptr->write(*token));
-            } else if (auto tokens = std::get_if<std::vector<int64_t>>(&token_variant)) {
-                m_status = _get_streaming_status(m_streamer_ptr->write(*tokens));
-            } else if (auto stop_token = std::get_if<std::monostate>(&token_variant)) {
+            if (pending_tokens.size() == 1) {
+                m_status = _get_streaming_status(m_streamer_ptr->write(pending_tokens.front()));
+            } else if (!pending_tokens.empty()) {
+                m_status = _get_streaming_status(m_streamer_ptr->write(pending_tokens));
+            }
+
+            if (is_stop_requested) {
                 break;
-            } else {
-                OPENVINO_THROW("Internal error: unsupported threaded streamer value");
             }
         }
     }
@@ -1,4 +1,9 @@
+#pragma once
+
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <cstdlib>
 #include <functional>
 #include <future>
 #include <iostream>
@@ -6,17 +11,42 @@
 #include <queue>
 #include <thread>
 #include <utility>
-#include <atomic>
 
 class ThreadPool {
+public:
+    // Scheduling class of a submitted task: workers always drain HIGH before NORMAL before LOW
+    enum class Priority { HIGH = 0, NORMAL = 1, LOW = 2 };
 
 private:
     std::vector<std::thread> threads;
-    std::queue<std::function<void()>> tasks;
+    std::array<std::queue<std::function<void()>>, 3> tasks;
     std::mutex queue_mutex;
     std::condition_variable cv;
     bool stop{false};
 
+    bool has_task() const {
+        return !tasks[0].empty() || !tasks[1].empty() || !tasks[2].empty();
+    }
+
+    std::function<void()> pop_task() {
+        for (auto& queue : tasks) {
+            if (!queue.empty()) {
+                auto task = std::move(queue.front());
+                queue.pop();
+                return task;
+            }
+        }
+        return {};
+    }
+
+    void enqueue(Priority priority, std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex);
+            tasks[static_cast<size_t>(priority)].emplace(std::move(task));
+        }
+        cv.notify_one();
+    }
+
 public:
     ThreadPool(const ThreadPool& rhs) = delete;
     ThreadPool(ThreadPool&& rhs) = delete;
@@ -29,13 +59,12 @@ public:
                     {
                         std::unique_lock<std::mutex> lock(queue_mutex);
                         cv.wait(lock, [this] {
-                            return !tasks.empty() || stop;
+                            return has_task() || stop;
                         });
-                        if (stop && tasks.empty()) {
+                        if (stop && !has_task()) {
                             return;
                         }
-                        task = std::move(tasks.front());
-                        tasks.pop();
+                        task = pop_task();
                     }
                     task();
                 }
@@ -55,19 +84,114 @@ public:
         }
     }
 
+    // Process-wide executor shared by all pipelines, so concurrently running pipelines (e.g.
+    // the main and draft samplers of a speculative setup) do not each spin up
+    // hardware_concurrency threads and oversubscribe the cores OpenVINO streams run on.
+    // Sized from OPENVINO_GENAI_NUM_THREADS when set, hardware_concurrency otherwise.
+    static ThreadPool& shared() {
+        static ThreadPool pool{[]() -> size_t {
+            if (const char* env = std::getenv("OPENVINO_GENAI_NUM_THREADS")) {
+                const size_t num_threads = std::strtoul(env, nullptr, 10);
+                if (num_threads > 0) {
+                    return num_threads;
+                }
+            }
+            const size_t num_threads = std::thread::hardware_concurrency();
+            return num_threads > 0 ? num_threads : 1;
+        }()};
+        return pool;
+    }
+
     template <typename F, typename... Args>
-    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>
+    auto submit_with_priority(Priority priority, F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>
     {
         using return_type = std::invoke_result_t<F, Args...>;
         auto task = std::make_shared<std::packaged_task<return_type()>>(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
         std::future<return_type> result = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex);
-            tasks.emplace([task]() { (*task)(); });
-        }
-        cv.notify_one();
+        enqueue(priority, [task]() { (*task)(); });
         return result;
     }
+
+    template <typename F, typename... Args>
+    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>
+    {
+        return submit_with_priority(Priority::NORMAL, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // Per-subsystem handle over a (usually the shared) pool with a concurrency budget: at most
+    // `budget` tasks of this client run in the pool simultaneously, excess submissions queue
+    // inside the client until a running one completes. This keeps per-subsystem thread-count
+    // knobs like sampler_num_threads meaningful while all work executes on one worker set.
+    // Destruction waits until every submitted task has finished.
+    class Client {
+        ThreadPool& m_pool;
+        Priority m_priority;
+        size_t m_budget;
+        std::mutex m_mutex;
+        std::condition_variable m_idle_cv;
+        size_t m_in_flight = 0;
+        std::queue<std::function<void()>> m_deferred;
+
+        // called by a finished task: hands its budget slot to a deferred task if one is waiting,
+        // otherwise releases it
+        void _on_task_complete() {
+            std::function<void()> next;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_deferred.empty()) {
+                    next = std::move(m_deferred.front());
+                    m_deferred.pop();
+                } else {
+                    --m_in_flight;
+                    if (m_in_flight == 0) {
+                        m_idle_cv.notify_all();
+                    }
+                }
+            }
+            if (next) {
+                m_pool.enqueue(m_priority, std::move(next));
+            }
+        }
+
+    public:
+        Client(const Client& rhs) = delete;
+        Client(Client&& rhs) = delete;
+        Client(ThreadPool& pool, size_t budget, Priority priority = Priority::NORMAL)
+            : m_pool(pool), m_priority(priority), m_budget(budget > 0 ? budget : 1) {}
+
+        ~Client() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_idle_cv.wait(lock, [this] { return m_in_flight == 0; });
+        }
+
+        template <typename F, typename... Args>
+        auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>
+        {
+            using return_type = std::invoke_result_t<F, Args...>;
+            auto task = std::make_shared<std::packaged_task<return_type()>>(
+                std::bind(std::forward<F>(f), std::forward<Args>(args)...)
+            );
+            std::future<return_type> result = task->get_future();
+            auto job = [this, task]() {
+                (*task)();
+                _on_task_complete();
+            };
+            bool dispatch = false;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (m_in_flight < m_budget) {
+                    ++m_in_flight;
+                    dispatch = true;
+                } else {
+                    m_deferred.emplace(std::move(job));
+                }
+            }
+            if (dispatch) {
+                m_pool.enqueue(m_priority, std::move(job));
+            }
+            return result;
+        }
+    };
 };
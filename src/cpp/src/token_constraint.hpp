@@ -0,0 +1,185 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logit_processor.hpp"
+
+namespace ov::genai {
+
+/**
+ * @brief Character-level deterministic automaton describing a grammar (e.g. compiled from a JSON
+ * schema or regex by an external front-end). Token-level masks are precompiled against it.
+ */
+class ICharacterAutomaton {
+public:
+    virtual ~ICharacterAutomaton() = default;
+    /** @return The successor state, or -1 if `symbol` is not admissible in `state`. */
+    virtual int32_t next_state(int32_t state, unsigned char symbol) const = 0;
+    virtual int32_t initial_state() const = 0;
+    virtual int32_t num_states() const = 0;
+};
+
+/**
+ * @brief Table-driven character automaton with an explicit transition table,
+ * `table[state * 256 + symbol]` holding the successor state or -1 for rejection.
+ */
+class TableCharacterAutomaton : public ICharacterAutomaton {
+    std::vector<int32_t> m_table;
+    int32_t m_num_states;
+    int32_t m_initial_state;
+
+public:
+    TableCharacterAutomaton(std::vector<int32_t> table, int32_t num_states, int32_t initial_state = 0)
+        : m_table(std::move(table)), m_num_states(num_states), m_initial_state(initial_state) {
+        OPENVINO_ASSERT(m_table.size() == static_cast<size_t>(m_num_states) * 256, "transition table must have num_states * 256 entries");
+    }
+
+    int32_t next_state(int32_t state, unsigned char symbol) const override {
+        return m_table[static_cast<size_t>(state) * 256 + symbol];
+    }
+
+    int32_t initial_state() const override {
+        return m_initial_state;
+    }
+
+    int32_t num_states() const override {
+        return m_num_states;
+    }
+};
+
+/**
+ * @brief Token-level DFA compiled once against the tokenizer vocabulary. For every automaton state
+ * the set of admissible next tokens is cached as a vocabulary-wide bitmask and the (state, token)
+ * successor states are precomputed, so applying the constraint at generation time is a single
+ * masked sweep over the logits plus an O(1) transition lookup per accepted token.
+ */
+class TokenLevelDFA {
+    size_t m_vocab_size = 0;
+    size_t m_words_per_state = 0;
+    int32_t m_num_states = 0;
+    int32_t m_initial_state = 0;
+    // bitmasks of admissible tokens, m_words_per_state 64-bit words per state
+    std::vector<uint64_t> m_allowed_masks;
+    // successor state per (state, token), -1 for inadmissible tokens
+    std::vector<int32_t> m_transitions;
+
+public:
+    using Ptr = std::shared_ptr<TokenLevelDFA>;
+
+    /**
+     * Compiles the token-level DFA.
+     * @param vocab Decoded string of each token id, indexed by token id.
+     * @param automaton The character-level grammar automaton.
+     */
+    TokenLevelDFA(const std::vector<std::string>& vocab, const ICharacterAutomaton& automaton) {
+        m_vocab_size = vocab.size();
+        m_words_per_state = (m_vocab_size + 63) / 64;
+        m_num_states = automaton.num_states();
+        m_initial_state = automaton.initial_state();
+
+        m_allowed_masks.assign(static_cast<size_t>(m_num_states) * m_words_per_state, 0);
+        m_transitions.assign(static_cast<size_t>(m_num_states) * m_vocab_size, -1);
+
+        for (int32_t state = 0; state < m_num_states; ++state) {
+            for (size_t token_id = 0; token_id < m_vocab_size; ++token_id) {
+                const std::string& token_text = vocab[token_id];
+                if (token_text.empty()) {
+                    continue;
+                }
+                int32_t current = state;
+                for (unsigned char symbol : token_text) {
+                    current = automaton.next_state(current, symbol);
+                    if (current < 0) {
+                        break;
+                    }
+                }
+                if (current >= 0) {
+                    m_allowed_masks[state * m_words_per_state + token_id / 64] |= uint64_t(1) << (token_id % 64);
+                    m_transitions[static_cast<size_t>(state) * m_vocab_size + token_id] = current;
+                }
+            }
+        }
+    }
+
+    int32_t initial_state() const {
+        return m_initial_state;
+    }
+
+    /** @return Pointer to m_words_per_state 64-bit words with bits set for admissible tokens. */
+    const uint64_t* allowed_mask(int32_t state) const {
+        return m_allowed_masks.data() + static_cast<size_t>(state) * m_words_per_state;
+    }
+
+    size_t words_per_state() const {
+        return m_words_per_state;
+    }
+
+    size_t vocab_size() const {
+        return m_vocab_size;
+    }
+
+    /** @return Successor state for accepting `token_id` in `state`, or -1 if inadmissible. */
+    int32_t next_state(int32_t state, int64_t token_id) const {
+        return m_transitions[static_cast<size_t>(state) * m_vocab_size + static_cast<size_t>(token_id)];
+    }
+};
+
+namespace LogitTransformers {
+
+/**
+ * @brief Masks logits of tokens inadmissible in the current grammar state. Must be registered
+ * before the temperature/top-k/top-p transforms so that sampling only sees admissible tokens.
+ * The sweep skips all-admissible 64-token words, so fully unconstrained states cost one
+ * comparison per 64 logits.
+ */
+class GrammarConstraintTransform : public IStatefulConstraintTransformer {
+    TokenLevelDFA::Ptr m_dfa;
+    int32_t m_state;
+
+public:
+    explicit GrammarConstraintTransform(TokenLevelDFA::Ptr dfa)
+        : m_dfa(std::move(dfa)), m_state(m_dfa->initial_state()) {}
+
+    void apply(Logits& logits) override {
+        constexpr float masked_logit = -std::numeric_limits<float>::infinity();
+        const uint64_t* mask = m_dfa->allowed_mask(m_state);
+        size_t num_words = m_dfa->words_per_state();
+        OPENVINO_ASSERT(logits.m_size == m_dfa->vocab_size(), "logits size does not match the compiled vocabulary");
+
+        for (size_t word_idx = 0; word_idx < num_words; ++word_idx) {
+            uint64_t word = mask[word_idx];
+            if (word == ~uint64_t(0)) {
+                continue;
+            }
+            size_t base = word_idx * 64;
+            size_t word_width = std::min<size_t>(64, logits.m_size - base);
+            for (size_t bit = 0; bit < word_width; ++bit) {
+                if (!(word & (uint64_t(1) << bit))) {
+                    logits.m_data[base + bit] = masked_logit;
+                }
+            }
+        }
+    }
+
+    /** Advances the grammar state after a token was accepted by sampling. */
+    void accept_token(int64_t token_id) override {
+        int32_t next = m_dfa->next_state(m_state, token_id);
+        OPENVINO_ASSERT(next >= 0, "sampled token is not admissible in the current grammar state");
+        m_state = next;
+    }
+
+    int32_t get_state() const {
+        return m_state;
+    }
+};
+
+} // namespace LogitTransformers
+
+}
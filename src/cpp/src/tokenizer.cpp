@@ -3,7 +3,10 @@
 
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <numeric>
+#include <unordered_map>
 #include <jinja2cpp/template.h>
 #include <jinja2cpp/template_env.h>
 #include <jinja2cpp/user_callable.h>
@@ -135,9 +138,12 @@ public:
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_tokenizer;
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_detokenizer;
 
-    // To change the adding special tokens mode we use a statefull subgraph,
-    // this flag holds the current state value of the CompiledModel.
-    ov::AnyMap m_state_flags;
+    // To change the adding special tokens mode we use a stateful subgraph. Each pooled infer
+    // request has its own variable state, so the currently applied flags are tracked per pool
+    // slot: redundant set_state roundtrips are skipped only when THIS request is already in the
+    // desired state.
+    std::vector<ov::AnyMap> m_tokenizer_state_flags;
+    std::vector<ov::AnyMap> m_detokenizer_state_flags;
 
     bool m_older_than_24_5 = false;
 
@@ -152,10 +158,10 @@ public:
     std::string m_chat_template = {};
 
     template <typename T>
-    void set_state_value(ov::VariableState& state, std::optional<T> value) {
+    void set_state_value(ov::VariableState& state, std::optional<T> value, ov::AnyMap& state_flags) {
         // better to store which value is in the state locally so that get_state is not called every infer request
         std::optional<T> last_value;
-        ov::genai::utils::read_anymap_param(m_state_flags, state.get_name(), last_value);
+        ov::genai::utils::read_anymap_param(state_flags, state.get_name(), last_value);
         
         // If requested add[skip]_special_tokens, max_length, pading mode, etc.
         // is different from the stored state, need to set state variable.
@@ -166,16 +172,19 @@ public:
             
             *value_tensor.data<T>() = *value;
             state.set_state(value_tensor);
-            m_state_flags[state.get_name()] = *value;
+            state_flags[state.get_name()] = *value;
         } else if (!value.has_value()) {
             // If user called with params, e.g. tokenizer.encode(prompt, add_special_tokens|max_length=...)
             // After that called without params, e.g. tokenizer.encode(prompt) we should reset to the default state.
             state.reset();
-            m_state_flags.erase(state.get_name());
+            state_flags.erase(state.get_name());
         }
     }
 
-    void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard, const ov::AnyMap& params) {
+    void set_state_if_necessary(CircularBufferQueueElementGuard<ov::InferRequest>& infer_request_guard,
+                                const ov::AnyMap& params,
+                                std::vector<ov::AnyMap>& pool_state_flags) {
+        ov::AnyMap& state_flags = pool_state_flags[infer_request_guard.get_index()];
         // These values should be equal to default values in py_tokenizer.cpp
         // in order to get the same behavior in C++ when arguments are not specified.
         std::optional<bool> add_special_tokens_flag = true;
@@ -199,13 +208,13 @@ public:
             auto name = state.get_name();
 
             if (name == add_special_tokens.name()) {
-                set_state_value(state, add_special_tokens_flag);
+                set_state_value(state, add_special_tokens_flag, state_flags);
             } else if (name == skip_special_tokens.name()) {
-                set_state_value(state, skip_special_tokens_flag);
+                set_state_value(state, skip_special_tokens_flag, state_flags);
             } else if (name == MAX_LENGTH_VAR_ID) {
-                set_state_value(state, max_length_val);
+                set_state_value(state, max_length_val, state_flags);
             } else if (name == PAD_TO_MAX_LENGTH_VAR_ID) {
-                set_state_value(state, pad_to_max_length_val);
+                set_state_value(state, pad_to_max_length_val, state_flags);
             }
         }
     }
@@ -263,11 +272,17 @@ public:
             ov::CompiledModel tokenizer = core.compile_model(ov_tokenizer, device, properties);
             ov::genai::utils::print_compiled_model_properties(tokenizer, "OV Tokenizer");
 
+            // start from the plugin-optimal number of requests and let the pool grow lazily
+            // up to twice that under bursty encode traffic instead of blocking callers
+            size_t tokenizer_nireq = tokenizer.get_property(ov::optimal_number_of_infer_requests);
             m_ireq_queue_tokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
-                tokenizer.get_property(ov::optimal_number_of_infer_requests),
-                [&tokenizer]() -> ov::InferRequest {
+                tokenizer_nireq,
+                [tokenizer]() mutable -> ov::InferRequest {
+                    // captured by value: the factory is kept by the queue and invoked lazily
                     return tokenizer.create_infer_request();
-                });
+                },
+                2 * tokenizer_nireq);
+            m_tokenizer_state_flags.resize(m_ireq_queue_tokenizer->get_max_capacity());
 
             const ov::AnyMap& rt_info = ov_tokenizer->get_rt_info();
             m_pad_token_id = find_or_fallback(rt_info, "pad_token_id", m_pad_token_id);
@@ -292,11 +307,14 @@ public:
             ov::CompiledModel detokenizer = core.compile_model(ov_detokenizer, device, properties);
             ov::genai::utils::print_compiled_model_properties(detokenizer, "OV Detokenizer");
 
+            size_t detokenizer_nireq = detokenizer.get_property(ov::optimal_number_of_infer_requests);
             m_ireq_queue_detokenizer = std::make_unique<CircularBufferQueue<ov::InferRequest>>(
-                detokenizer.get_property(ov::optimal_number_of_infer_requests),
-                [&detokenizer]() -> ov::InferRequest {
+                detokenizer_nireq,
+                [detokenizer]() mutable -> ov::InferRequest {
                     return detokenizer.create_infer_request();
-                });
+                },
+                2 * detokenizer_nireq);
+            m_detokenizer_state_flags.resize(m_ireq_queue_detokenizer->get_max_capacity());
 
             // Unset/-1 token causes exception in SentencePiece detokenization.
             if (m_pad_token_id != -1 && m_pad_token.empty())
@@ -435,7 +453,7 @@ public:
                                                 "Tokenizer::encode is not available");
 
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(m_ireq_queue_tokenizer.get());
-        set_state_if_necessary(infer_request_guard, tokenization_params);
+        set_state_if_necessary(infer_request_guard, tokenization_params, m_tokenizer_state_flags);
         size_t batch_size = 1;
         infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::string, {batch_size}, &prompt});
         infer_request_guard.get().start_async();
@@ -447,14 +465,11 @@ public:
         );
     }
 
-    TokenizedInputs encode(std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
-        OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
-                                                "Tokenizer::encode is not available");
-
+    TokenizedInputs encode_sub_batch(std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params) {
         TokenizedInputs unpadded;
         {
             CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_tokenizer.get());
-            set_state_if_necessary(infer_request_guard, tokenization_params);
+            set_state_if_necessary(infer_request_guard, tokenization_params, m_tokenizer_state_flags);
             infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::string, {prompts.size()}, prompts.data()});
             auto size_ = infer_request_guard.get().get_input_tensor().get_shape();
             infer_request_guard.get().start_async();
@@ -469,6 +484,94 @@ public:
         return {unpadded.input_ids, unpadded.attention_mask};
     }
 
+    TokenizedInputs encode(std::vector<std::string>& prompts, const ov::AnyMap& tokenization_params = {}) {
+        OPENVINO_ASSERT(m_ireq_queue_tokenizer, "Either openvino_tokenizer.xml was not provided or it was not loaded correctly. "
+                                                "Tokenizer::encode is not available");
+
+        // Length-bucketed sub-batching: one long outlier otherwise pads every row of the batch
+        // to its length, wasting tokenizer compute on pad tokens. Large mixed-length batches are
+        // split into contiguous length buckets which run concurrently on the infer-request pool
+        // and are re-padded into one output, bounding padding waste to the in-bucket spread.
+        // Explicit pad-to-max-length requests produce uniform rows anyway, so they skip this.
+        constexpr size_t MIN_PROMPTS_FOR_BUCKETING = 8;
+        const bool pad_to_max_requested = tokenization_params.count(pad_to_max_length.name()) > 0;
+        size_t num_buckets = std::min<size_t>({4,
+                                               m_ireq_queue_tokenizer->get_max_capacity(),
+                                               prompts.size() / (MIN_PROMPTS_FOR_BUCKETING / 2)});
+        if (prompts.size() < MIN_PROMPTS_FOR_BUCKETING || pad_to_max_requested || num_buckets < 2) {
+            return encode_sub_batch(prompts, tokenization_params);
+        }
+
+        // stable order by character length (a cheap proxy for token length)
+        std::vector<size_t> order(prompts.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&prompts](size_t lhs, size_t rhs) {
+            return prompts[lhs].size() < prompts[rhs].size();
+        });
+
+        struct Bucket {
+            std::vector<std::string> prompts;
+            std::vector<size_t> original_indices;
+            TokenizedInputs result;
+        };
+        std::vector<Bucket> buckets(num_buckets);
+        for (size_t rank = 0; rank < order.size(); ++rank) {
+            auto& bucket = buckets[rank * num_buckets / order.size()];
+            bucket.prompts.push_back(prompts[order[rank]]);
+            bucket.original_indices.push_back(order[rank]);
+        }
+
+        std::vector<std::future<TokenizedInputs>> futures;
+        for (size_t bucket_idx = 1; bucket_idx < num_buckets; ++bucket_idx) {
+            futures.push_back(std::async(std::launch::async, [this, &buckets, bucket_idx, &tokenization_params]() {
+                return encode_sub_batch(buckets[bucket_idx].prompts, tokenization_params);
+            }));
+        }
+        buckets[0].result = encode_sub_batch(buckets[0].prompts, tokenization_params);
+        for (size_t bucket_idx = 1; bucket_idx < num_buckets; ++bucket_idx) {
+            buckets[bucket_idx].result = futures[bucket_idx - 1].get();
+        }
+
+        // reassemble into one [N, max_len] pair, padding shorter buckets on the side the
+        // tokenizer itself pads on (detected from the masks; right is the default)
+        size_t max_len = 0;
+        bool pads_left = false;
+        for (const auto& bucket : buckets) {
+            const ov::Shape shape = bucket.result.input_ids.get_shape();
+            max_len = std::max(max_len, shape.at(1));
+            const int64_t* mask = bucket.result.attention_mask.data<int64_t>();
+            for (size_t row = 0; row < shape.at(0); ++row) {
+                if (mask[row * shape.at(1)] == 0) {
+                    pads_left = true;
+                }
+            }
+        }
+
+        ov::Tensor input_ids(ov::element::i64, {prompts.size(), max_len});
+        ov::Tensor attention_mask(ov::element::i64, {prompts.size(), max_len});
+        int64_t* ids_out = input_ids.data<int64_t>();
+        int64_t* mask_out = attention_mask.data<int64_t>();
+        for (const auto& bucket : buckets) {
+            const ov::Shape shape = bucket.result.input_ids.get_shape();
+            const size_t bucket_len = shape.at(1);
+            const int64_t* ids_in = bucket.result.input_ids.data<int64_t>();
+            const int64_t* mask_in = bucket.result.attention_mask.data<int64_t>();
+            for (size_t row = 0; row < shape.at(0); ++row) {
+                const size_t out_row = bucket.original_indices[row];
+                int64_t* ids_row = ids_out + out_row * max_len;
+                int64_t* mask_row = mask_out + out_row * max_len;
+                const size_t pad_count = max_len - bucket_len;
+                const size_t content_offset = pads_left ? pad_count : 0;
+                std::fill_n(ids_row, max_len, m_pad_token_id);
+                std::fill_n(mask_row, max_len, int64_t(0));
+                std::copy_n(ids_in + row * bucket_len, bucket_len, ids_row + content_offset);
+                std::copy_n(mask_in + row * bucket_len, bucket_len, mask_row + content_offset);
+            }
+        }
+
+        return {input_ids, attention_mask};
+    }
+
     TokenizedInputs get_copied_results(ov::Tensor input_ids, ov::Tensor attention_mask) {
         ov::Tensor input_ids_ = ov::Tensor(input_ids.get_element_type(), input_ids.get_shape());
         ov::Tensor attention_mask_ = ov::Tensor(attention_mask.get_element_type(), attention_mask.get_shape());
@@ -482,7 +585,7 @@ public:
         OPENVINO_ASSERT(m_ireq_queue_detokenizer, "Detokenizer model has not been provided. Tokenizer::decode is not available");
 
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
-        set_state_if_necessary(infer_request_guard, detokenization_params);
+        set_state_if_necessary(infer_request_guard, detokenization_params, m_detokenizer_state_flags);
         size_t batch_size = 1;
         infer_request_guard.get().set_input_tensor(ov::Tensor{ov::element::i64, {batch_size, tokens.size()}, tokens.data()});
         infer_request_guard.get().start_async();
@@ -496,7 +599,7 @@ public:
         OPENVINO_ASSERT(tokens.get_shape().size() == 2, "tokens tensor should of rank 2 with shape [batch_size, seq_len]");
 
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
-        set_state_if_necessary(infer_request_guard, detokenization_params);
+        set_state_if_necessary(infer_request_guard, detokenization_params, m_detokenizer_state_flags);
         infer_request_guard.get().set_input_tensor(tokens);
         infer_request_guard.get().start_async();
         infer_request_guard.get().wait();
@@ -525,7 +628,7 @@ public:
         }
 
         CircularBufferQueueElementGuard<ov::InferRequest> infer_request_guard(this->m_ireq_queue_detokenizer.get());
-        set_state_if_necessary(infer_request_guard, detokenization_params);
+        set_state_if_necessary(infer_request_guard, detokenization_params, m_detokenizer_state_flags);
         infer_request_guard.get().set_input_tensor(tokens);
         infer_request_guard.get().start_async();
         infer_request_guard.get().wait();
@@ -534,6 +637,41 @@ public:
         return std::vector<std::string>(res_data, res_data + res.get_shape()[0]);
     }
 
+    /**
+     * Lazily builds the immutable vocab index used for O(1) id <-> piece lookups (constrained
+     * decoding, client-side token accounting). Built once per TokenizerImpl and shared by every
+     * Tokenizer copy referring to it; subsequent calls are allocation-free.
+     * @param vocab_size The number of tokens in the vocabulary (callers know it from the logits shape).
+     */
+    const std::vector<std::string>& get_vocab(size_t vocab_size) {
+        std::lock_guard<std::mutex> lock(m_vocab_index_mutex);
+        if (m_vocab_by_id.size() != vocab_size) {
+            OPENVINO_ASSERT(m_vocab_by_id.empty(), "Vocab index was already built with a different vocab size");
+            std::vector<std::vector<int64_t>> single_token_lines(vocab_size);
+            for (size_t token_id = 0; token_id < vocab_size; ++token_id) {
+                single_token_lines[token_id] = {static_cast<int64_t>(token_id)};
+            }
+            m_vocab_by_id = decode(std::move(single_token_lines), {ov::genai::skip_special_tokens(false)});
+            m_vocab_to_id.reserve(vocab_size);
+            for (size_t token_id = 0; token_id < vocab_size; ++token_id) {
+                // on duplicates (e.g. byte fallback pieces rendering equally) keep the lowest id
+                m_vocab_to_id.emplace(m_vocab_by_id[token_id], static_cast<int64_t>(token_id));
+            }
+        }
+        return m_vocab_by_id;
+    }
+
+    int64_t get_token_id(const std::string& token_piece) {
+        std::lock_guard<std::mutex> lock(m_vocab_index_mutex);
+        OPENVINO_ASSERT(!m_vocab_by_id.empty(), "Vocab index is not built yet, call get_vocab first");
+        auto it = m_vocab_to_id.find(token_piece);
+        return it == m_vocab_to_id.end() ? -1 : it->second;
+    }
+
+    std::mutex m_vocab_index_mutex;
+    std::vector<std::string> m_vocab_by_id;
+    std::unordered_map<std::string, int64_t> m_vocab_to_id;
+
     std::string apply_chat_template(ChatHistory history,
                                     bool add_generation_prompt,
                                     const std::string& chat_template) const {
@@ -604,6 +742,27 @@ public:
 };
 
 Tokenizer::Tokenizer(const std::filesystem::path& tokenizer_path, const ov::AnyMap& properties) {
+    // Process-wide sharing of tokenizer implementations: pipelines constructed from the same
+    // tokenizer files reuse one TokenizerImpl (compiled models, infer request pools, vocab and
+    // template caches) instead of loading a duplicate copy. Only the default-properties case is
+    // shared, custom properties may legitimately produce different compilations.
+    if (properties.empty()) {
+        static std::mutex shared_impls_mutex;
+        static std::map<std::string, std::weak_ptr<TokenizerImpl>> shared_impls;
+
+        std::error_code ec;
+        auto canonical_path = std::filesystem::weakly_canonical(tokenizer_path, ec);
+        std::string key = (ec ? tokenizer_path : canonical_path).string();
+
+        std::lock_guard<std::mutex> lock(shared_impls_mutex);
+        if (auto shared_impl = shared_impls[key].lock()) {
+            m_pimpl = shared_impl;
+            return;
+        }
+        m_pimpl = std::make_shared<TokenizerImpl>(tokenizer_path, properties);
+        shared_impls[key] = m_pimpl;
+        return;
+    }
     m_pimpl = std::make_shared<TokenizerImpl>(tokenizer_path, properties);
 }
 
@@ -673,6 +832,14 @@ std::vector<std::string> Tokenizer::decode(std::vector<std::vector<int64_t>> lin
     return m_pimpl->decode(lines, detokenization_params);
 }
 
+const std::vector<std::string>& Tokenizer::get_vocab(size_t vocab_size) {
+    return m_pimpl->get_vocab(vocab_size);
+}
+
+int64_t Tokenizer::get_token_id(const std::string& token_piece) {
+    return m_pimpl->get_token_id(token_piece);
+}
+
 
 int64_t Tokenizer::get_bos_token_id() const {
     return m_pimpl->m_bos_token_id;
@@ -701,15 +868,21 @@ std::string Tokenizer::get_eos_token() const {
 std::string Tokenizer::apply_chat_template(ChatHistory history,
                                            bool add_generation_prompt,
                                            const std::string& chat_template) const {
-    return m_pimpl->apply_chat_template(history, add_generation_prompt, chat_template);
+    const std::string& effective_template = chat_template.empty() ? *m_chat_template_override : chat_template;
+    return m_pimpl->apply_chat_template(history, add_generation_prompt, effective_template);
 }
 
 std::string Tokenizer::get_chat_template() const {
+    if (!m_chat_template_override->empty()) {
+        return remap_and_patch(*m_chat_template_override);
+    }
     return m_pimpl->get_chat_template();
 }
 
 void Tokenizer::set_chat_template(const std::string& chat_template) {
-    m_pimpl->set_chat_template(chat_template);
+    // the implementation may be shared with other Tokenizer handles constructed from the same
+    // files, so the override is stored per handle rather than inside the shared implementation
+    *m_chat_template_override = chat_template;
 }
 
 Tokenizer::~Tokenizer() = default;
@@ -14,6 +14,7 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/slice.hpp"
 #include "openvino/op/tanh.hpp"
+#include "openvino/op/topk.hpp"
 #include "openvino/op/transpose.hpp"
 #include "openvino/genai/text_streamer.hpp"
 
@@ -261,6 +262,37 @@ void apply_slice_before_matmul_transformation(std::shared_ptr<ov::Model> model)
     }
 }
 
+void mark_sparse_attention_prefill(std::shared_ptr<ov::Model> model) {
+    // Marks every paged attention op so that plugins which implement sparse prefill kernels
+    // (tri-shape / x-attention style) may select them at compile time. Plugins without such
+    // kernels ignore the hint, so enabling it is always functionally safe.
+    for (const auto& op : model->get_ops()) {
+        if (std::string(op->get_type_name()).find("PagedAttention") != std::string::npos) {
+            op->get_rt_info()["allow_sparse_attention_prefill"] = true;
+        }
+    }
+}
+
+void apply_greedy_sampling_head_transformation(std::shared_ptr<ov::Model> model) {
+    // Appends an argmax head over the logits so that greedy sampling can run on the inference
+    // device and only token ids (instead of batch x vocab logits) cross the host boundary.
+    // The logits output is kept: the host falls back to it whenever logit transforms,
+    // logprobs or non-greedy sampling are requested.
+    auto logits_output = model->output("logits");
+    auto k = std::make_shared<ov::op::v0::Constant>(ov::element::i64, ov::Shape{}, std::vector<int64_t>{1});
+    auto topk = std::make_shared<ov::op::v11::TopK>(logits_output,
+                                                    k,
+                                                    /* axis = */ -1,
+                                                    ov::op::v11::TopK::Mode::MAX,
+                                                    ov::op::v11::TopK::SortType::NONE,
+                                                    ov::element::i64,
+                                                    /* stable = */ false);
+    auto result = std::make_shared<ov::op::v0::Result>(topk->output(1));
+    result->set_friendly_name("sampled_token_ids");
+    result->get_output_tensor(0).set_names({"sampled_token_ids"});
+    model->add_results({result});
+}
+
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model) {
     std::shared_ptr<ov::Node> matmul = nullptr;
     int64_t slice_gather_dim = -1;
@@ -277,6 +309,28 @@ void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model)
     }
 }
 
+void apply_hidden_state_output_transformation(std::shared_ptr<ov::Model> model) {
+    // Exposes the lm-head input (the final hidden states) as an extra model output named
+    // "last_hidden_state". Applied after the sampled-row gather, so its rows align one-to-one
+    // with logits rows and the existing per-group logits slicing also addresses the embeddings.
+    std::shared_ptr<ov::Node> matmul = nullptr;
+    int64_t slice_gather_dim = -1;
+    std::tie(matmul, slice_gather_dim) = find_llm_matmul(model);
+    OPENVINO_ASSERT(matmul, "Cannot locate the lm-head MatMul to expose hidden states");
+
+    auto result = std::make_shared<ov::op::v0::Result>(matmul->input_value(0));
+    result->set_friendly_name("last_hidden_state");
+    result->get_output_tensor(0).set_names({"last_hidden_state"});
+    model->add_results({result});
+}
+
+// NOTE on streaming weight loads (O_DIRECT / io_uring readahead): model weight I/O happens inside
+// ov::Core::read_model / compile_model - this repository never touches the .bin bytes itself, so
+// a streaming loader cannot be inserted from here without re-implementing IR parsing. The
+// available levers at this level are ov::enable_mmap (on by default; weights fault in from the
+// page cache) and compiled-blob caching via ov::cache_dir, which skips the re-read entirely.
+// Saturating raw NVMe bandwidth past the page cache needs the aligned/direct read path inside
+// the runtime's weight reader, where the buffer lifecycle is owned.
 ov::Core singleton_core() {
     static ov::Core core;
     return core;
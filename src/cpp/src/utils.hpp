@@ -91,6 +91,12 @@ void apply_slice_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
 void apply_gather_before_matmul_transformation(std::shared_ptr<ov::Model> model);
 
+void apply_hidden_state_output_transformation(std::shared_ptr<ov::Model> model);
+
+void apply_greedy_sampling_head_transformation(std::shared_ptr<ov::Model> model);
+
+void mark_sparse_attention_prefill(std::shared_ptr<ov::Model> model);
+
 ov::Core singleton_core();
 
 size_t get_first_history_difference(const ov::Tensor& encoded_history, const std::vector<int64_t> tokenized_history);
@@ -97,6 +97,10 @@ private:
         // InputsEmbedderMiniCPM Uses to insert <image_id>i</image_id> per image (not a slice).
         size_t m_image_id = 0;
 
+        // bounded cache of vision encoder results keyed by image content hash (see encode_images)
+        static const size_t ENCODED_IMAGE_CACHE_CAPACITY = 16;
+        std::map<uint64_t, ov::genai::EncodedImage> m_encoded_image_cache;
+
     public:
         virtual ov::Tensor get_inputs_embeds(const std::string& prompt, const std::vector<ov::genai::EncodedImage>& images, ov::genai::VLMPerfMetrics& metrics) = 0;
 
@@ -8,6 +8,14 @@
 
 #include "utils.hpp"
 
+// NOTE on a streaming tile pipeline for high-resolution documents: patch tensors for all tiles
+// are materialized before encoding, which is what spikes memory on 300dpi A4 scans. Bounding it
+// requires interleaving per-tile preprocessing with encoding (encode tile i while preprocessing
+// i+1, releasing each patch tensor after its features are copied out) and making the newline-token
+// feature merge incremental instead of operating on the full concatenated feature tensor. The
+// encoder side is ready for this - per-tile inferences already run through a pooled request - so
+// the work is confined to restructuring this file's patch loop and merge; a low-information
+// tile early-exit additionally needs a quality-calibrated saliency metric that we do not have.
 namespace ov::genai {
 
 // forward declaration
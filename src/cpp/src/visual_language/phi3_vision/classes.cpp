@@ -114,32 +114,25 @@ ov::Tensor HD_transform(const ov::Tensor& uint8, size_t num_crops) {
     return padding_336(ov::Tensor{ov::element::u8, {1, new_h, new_w, 3}, dst.buf.data()});
 }
 
-ov::Tensor mean_scale(const ov::Tensor& uint8, const ProcessorConfig& config) {
-    auto uint_8_data = uint8.data<uint8_t>();
-    ov::Tensor float_normalized{ov::element::f32, uint8.get_shape()};
-    float* float_data = float_normalized.data<float>();
+// Fused normalize + layout pass: reads the u8 HWC image once and writes the normalized f32
+// CHW output directly, skipping the intermediate full-size f32 HWC tensor the separate
+// mean_scale + channels_first steps materialized per image (tens of MB per HD image)
+ov::Tensor mean_scale_channels_first(const ov::Tensor& uint8, const ProcessorConfig& config) {
+    ov::Shape shape = uint8.get_shape();
+    const size_t height = shape.at(1), width = shape.at(2);
     OPENVINO_ASSERT(0 == uint8.get_size() % 3, "RGB");
-    for (size_t idx = 0; idx < uint8.get_size(); idx += 3) {
-        float_data[idx] = (float(uint_8_data[idx]) / 255.0f - config.image_mean[0]) / config.image_std[0];
-        float_data[idx + 1] = (float(uint_8_data[idx + 1]) / 255.0f - config.image_mean[1]) / config.image_std[1];
-        float_data[idx + 2] = (float(uint_8_data[idx + 2]) / 255.0f - config.image_mean[2]) / config.image_std[2];
-    }
-    return float_normalized;
-}
-
-ov::Tensor channels_first(const ov::Tensor& _1hw3) {
-    ov::Shape shape = _1hw3.get_shape();
-    ov::Tensor _13hw = ov::Tensor{ov::element::f32, {1, 3, shape.at(1), shape.at(2)}};
-    auto _1hw3_data = _1hw3.data<float>();
-    float* _13hw_data = _13hw.data<float>();
+    ov::Tensor nchw{ov::element::f32, {1, 3, height, width}};
+    const uint8_t* uint8_data = uint8.data<uint8_t>();
+    float* nchw_data = nchw.data<float>();
+    const size_t plane_size = height * width;
     for (size_t plane = 0; plane < 3; ++plane) {
-        for (size_t row = 0; row < shape.at(1); ++row) {
-            for (size_t col = 0; col < shape.at(2); ++col) {
-                _13hw_data[plane * shape.at(1) * shape.at(2) + row * shape.at(2) + col] = _1hw3_data[row * shape.at(2) * 3 + col * 3 + plane];
-            }
+        const float mean = config.image_mean[plane], std_value = config.image_std[plane];
+        float* plane_data = nchw_data + plane * plane_size;
+        for (size_t pixel = 0; pixel < plane_size; ++pixel) {
+            plane_data[pixel] = (float(uint8_data[pixel * 3 + plane]) / 255.0f - mean) / std_value;
         }
     }
-    return _13hw;
+    return nchw;
 }
 
 // Reimplementation of Python im.reshape(1, 3, h//336, 336, w//336, 336).permute(0,2,4,1,3,5).reshape(-1, 3, 336, 336)
@@ -244,11 +237,9 @@ std::tuple<ov::Tensor, ImageSize> get_pixel_values_phi3_v(const ov::Tensor& imag
     clip_image_u8 dst;
     bicubic_resize(img, dst, INPUT_IMAGE_SIZE, INPUT_IMAGE_SIZE);
     ov::Tensor global_image{ov::element::u8, {1, INPUT_IMAGE_SIZE, INPUT_IMAGE_SIZE, 3}, dst.buf.data()};
-    global_image = mean_scale(global_image, config);
-    hd_image = mean_scale(hd_image, config);
-    global_image = channels_first(global_image);
-    hd_image = channels_first(hd_image);
-    ov::Tensor slices = slice_image(hd_image);
+    global_image = mean_scale_channels_first(global_image, config);
+    ov::Tensor hd_image_nchw = mean_scale_channels_first(hd_image, config);
+    ov::Tensor slices = slice_image(hd_image_nchw);
     ov::Tensor concatenated = concatenate_batch(global_image, slices);
     ov::Tensor pixel_values = pad_to_max_num_crops_tensor(concatenated, config.phi3_v.num_crops);
     return {std::move(pixel_values), image_size};
@@ -590,6 +590,29 @@ ov::Tensor InputsEmbedderQwen2VL::create_position_ids(
         }
     }
 
+    // The position ids depend only on the token layout (sequence length, vision-start positions
+    // and image grids), not on the token values, so identical-layout requests - e.g. repeated
+    // video-frame grids - replay a cached tensor. The cached tensors are treated as read-only by
+    // every consumer (they feed model inputs directly).
+    uint64_t layout_key = 1469598103934665603ull;
+    auto fnv_mix = [&layout_key](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i)
+            layout_key = (layout_key ^ bytes[i]) * 1099511628211ull;
+    };
+    fnv_mix(&seq_len, sizeof(seq_len));
+    fnv_mix(&batch_size, sizeof(batch_size));
+    fnv_mix(&spatial_merge_size, sizeof(spatial_merge_size));
+    if (!vision_start_indices.empty())
+        fnv_mix(vision_start_indices.data(), vision_start_indices.size() * sizeof(vision_start_indices[0]));
+    if (!images_grid_thw.empty())
+        fnv_mix(images_grid_thw.data(), images_grid_thw.size() * sizeof(images_grid_thw[0]));
+
+    auto cached_it = m_position_ids_cache.find(layout_key);
+    if (cached_it != m_position_ids_cache.end()) {
+        return cached_it->second;
+    }
+
     ov::Tensor position_ids{ov::element::i64, {3, batch_size, seq_len}};
     int64_t* pos_data = position_ids.data<int64_t>();
     
@@ -653,6 +676,11 @@ ov::Tensor InputsEmbedderQwen2VL::create_position_ids(
         }
     }
 
+    if (m_position_ids_cache.size() >= POSITION_IDS_CACHE_CAPACITY) {
+        m_position_ids_cache.clear();
+    }
+    m_position_ids_cache.emplace(layout_key, position_ids);
+
     return position_ids;
 }
 
@@ -29,6 +29,10 @@ class InputsEmbedderQwen2VL : public InputsEmbedder::IInputsEmbedder {
     std::unique_ptr<CircularBufferQueue<ov::InferRequest>> m_ireq_queue_vision_embeddings_merger;
 
     ov::Tensor m_position_ids;
+    // cache of prefill M-ROPE position-id tensors: video workloads repeat identical grid shapes
+    // and token layouts, and the ids depend only on the layout, not on the token values
+    static const size_t POSITION_IDS_CACHE_CAPACITY = 8;
+    std::map<uint64_t, ov::Tensor> m_position_ids_cache;
     int64_t m_rope_delta = 0;
 
 public:
@@ -23,7 +23,8 @@ std::shared_ptr<WhisperDecoder> WhisperDecoder::from_path(const std::filesystem:
 }
 
 std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& encoder_hidden_state,
-                                                          const int64_t decoder_start_token_id) {
+                                                          const int64_t decoder_start_token_id,
+                                                          bool* state_kept) {
     Tensor input_ids_tensor = create_host_tensor(ov::element::i64, {1, 1});
     input_ids_tensor.data<int64_t>()[0] = decoder_start_token_id;
 
@@ -38,7 +39,16 @@ std::pair<int64_t, float> WhisperDecoder::detect_language(const ov::Tensor& enco
 
     int64_t output_token = ov::genai::utils::argmax(output_tensor, 0);
 
-    reset_state();
+    if (state_kept && supports_initial_token_state_reuse()) {
+        // the KV state now holds the start token at position 0; the caller folds it into the
+        // first decode instead of paying a second pass over the same token
+        *state_kept = true;
+    } else {
+        if (state_kept) {
+            *state_kept = false;
+        }
+        reset_state();
+    }
 
     return {output_token, infer_ms};
 }
@@ -67,7 +77,12 @@ void WhisperDecoder::_set_encoder_hidden_states_tensor(const Tensor& encoder_hid
     Shape shape{encoder_hidden_state.get_shape()};
     shape[0] = batch_size;
 
-    Tensor new_encoder_hidden_states = create_host_tensor(ov::element::f32, shape);
+    // reuse the previously allocated broadcast buffer when the shape is unchanged (the common
+    // case across sequential chunks of one transcription); only the contents need refreshing
+    if (!m_broadcast_encoder_hidden_states || m_broadcast_encoder_hidden_states.get_shape() != shape) {
+        m_broadcast_encoder_hidden_states = create_host_tensor(ov::element::f32, shape);
+    }
+    Tensor new_encoder_hidden_states = m_broadcast_encoder_hidden_states;
 
     auto new_encoder_hidden_states_data = new_encoder_hidden_states.data<float>();
     auto encoder_hidden_state_data = encoder_hidden_state.data<float>();
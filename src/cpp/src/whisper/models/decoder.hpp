@@ -15,7 +15,21 @@ public:
                                                      const std::string& device,
                                                      const ov::AnyMap& properties);
 
-    std::pair<int64_t, float> detect_language(const Tensor& encoder_hidden_state, const int64_t decoder_start_token_id);
+    /**
+     * Detects the spoken language from the first decoder pass over the start token. When
+     * state_kept is provided and the decoder supports it, the KV state of that pass is preserved
+     * (and *state_kept set), so the first real decode can continue from position 1 instead of
+     * re-decoding the start token.
+     */
+    std::pair<int64_t, float> detect_language(const Tensor& encoder_hidden_state,
+                                              const int64_t decoder_start_token_id,
+                                              bool* state_kept = nullptr);
+
+    // whether the decoder KV state left by detect_language can seed a subsequent decode
+    // (stateful decoder only; the with-past first-pass model has a fixed input layout)
+    virtual bool supports_initial_token_state_reuse() const {
+        return false;
+    }
 
     virtual void start_async(const Tensor& encoder_hidden_state, const Tensor& input_ids, const Tensor& beam_idx) = 0;
     
@@ -28,6 +42,10 @@ public:
     virtual ov::Tensor create_host_tensor(const element::Type element_type, const Shape& shape);
 
 protected:
+    // reused broadcast buffer: beam-batched decoding re-broadcasts the encoder states every
+    // chunk, reusing one allocation avoids a multi-megabyte alloc + page-fault per chunk
+    Tensor m_broadcast_encoder_hidden_states;
+
     void _set_encoder_hidden_states_tensor(const Tensor& encoder_hidden_state,
                                            const size_t batch_size,
                                            InferRequest& request);
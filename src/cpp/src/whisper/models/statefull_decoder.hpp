@@ -20,6 +20,10 @@ public:
 
     void reset_state() override;
 
+    bool supports_initial_token_state_reuse() const override {
+        return true;
+    }
+
     ov::Tensor create_host_tensor(const element::Type element_type, const Shape& shape) override;
 
 private:
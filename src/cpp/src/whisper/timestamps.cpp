@@ -6,6 +6,13 @@
 namespace ov {
 namespace genai {
 
+// NOTE on word-level timestamps: segment granularity is what the special timestamp tokens decoded
+// here can express. Word timing needs the decoder's cross-attention weights (pooled over the
+// alignment heads, then DTW against the audio frames), and the exported decoder IRs only output
+// logits - the attention maps are not graph outputs, so no pipeline-side plumbing (including the
+// ScoresForEachDecodedToken-style path) can observe them. The export tooling has to add optional
+// cross-attention outputs first; the DTW pass itself is then a straightforward per-segment
+// post-processing step on a worker thread.
 ov::genai::ExtractedSegments extract_segments(const std::vector<int64_t>& tokens,
                                               const ov::genai::WhisperGenerationConfig& config,
                                               const size_t nb_max_frames,
@@ -185,6 +185,17 @@ std::pair<ov::genai::EncodedResults, bool> decode(std::shared_ptr<ov::genai::Whi
     return {results, (sequence_group->handle_stopped() || sequence_group->handle_cancelled())};
 }
 
+uint64_t WhisperEncoderResultCache::hash_mel_chunk(const std::vector<float>& mel_data) {
+    // FNV-1a over the raw float bits: mel chunks from identical / overlapping windows are
+    // bit-identical, which is exactly the repetition this cache targets
+    uint64_t hash = 1469598103934665603ull;
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(mel_data.data());
+    for (size_t i = 0; i < mel_data.size() * sizeof(float); ++i) {
+        hash = (hash ^ bytes[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
 ov::Tensor encode(ov::InferRequest& request,
                   std::vector<float>& mel_data,
                   const size_t feature_size,
@@ -199,7 +210,21 @@ ov::Tensor encode(ov::InferRequest& request,
                     mel_data.size(),
                     ".");
 
-    ov::Tensor input_tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
+    const ov::element::Type input_type = request.get_compiled_model().input("input_features").get_element_type();
+    ov::Tensor input_tensor;
+    if (input_type == ov::element::f16) {
+        // Reduced-precision feature path: encoders exported with an f16 input take the converted
+        // features directly, halving the feature buffer and the host-to-device copy per chunk on
+        // memory-bound parts. The conversion is value-preserving for the normalized log-mel range,
+        // unlike an i8 feed which would need the model's calibration scale.
+        input_tensor = ov::Tensor(ov::element::f16, {1, feature_size, nb_max_frames});
+        ov::float16* half_data = input_tensor.data<ov::float16>();
+        for (size_t i = 0; i < mel_data.size(); ++i) {
+            half_data[i] = ov::float16(mel_data[i]);
+        }
+    } else {
+        input_tensor = ov::Tensor(ov::element::f32, {1, feature_size, nb_max_frames}, mel_data.data());
+    }
 
     request.set_tensor("input_features", input_tensor);
 
@@ -209,7 +234,7 @@ ov::Tensor encode(ov::InferRequest& request,
     raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
 
     // reset input tensor
-    request.set_tensor("input_features", ov::Tensor(ov::element::f32, {0, feature_size, nb_max_frames}));
+    request.set_tensor("input_features", ov::Tensor(input_type, {0, feature_size, nb_max_frames}));
 
     return request.get_tensor("last_hidden_state");
 }
@@ -218,7 +243,8 @@ std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
                                          std::shared_ptr<ov::genai::WhisperDecoder> decoder,
                                          const ov::genai::WhisperGenerationConfig& config,
                                          const bool return_timestamps,
-                                         ov::genai::RawPerfMetrics& raw_metrics) {
+                                         ov::genai::RawPerfMetrics& raw_metrics,
+                                         bool& detection_state_primed) {
     if (!config.is_multilingual) {
         if (return_timestamps) {
             return std::vector<int64_t>{config.decoder_start_token_id};
@@ -234,7 +260,8 @@ std::vector<int64_t> prepare_init_tokens(ov::Tensor& encoder_hidden_state,
             language_token_id = config.lang_to_id.at(language);
         }
     } else {
-        auto [language_token, infer_ms] = decoder->detect_language(encoder_hidden_state, config.decoder_start_token_id);
+        auto [language_token, infer_ms] =
+            decoder->detect_language(encoder_hidden_state, config.decoder_start_token_id, &detection_state_primed);
         language_token_id = language_token;
         raw_metrics.m_inference_durations[0] += MicroSeconds(infer_ms);
     }
@@ -267,7 +294,9 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        std::shared_ptr<WhisperDecoder> decoder,
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
-                                       Sampler& sampler) {
+                                       Sampler& sampler,
+                                       WhisperEncoderResultCache* encoder_cache,
+                                       std::optional<float> vad_feature_variance_threshold) {
     size_t max_new_tokens = config.get_max_new_tokens();
 
     WhisperGenerateResult result;
@@ -288,6 +317,8 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     const bool return_timestamps = config.return_timestamps || !is_shortform;
 
     std::vector<int64_t> init_tokens;
+    // set when language detection preserved the decoder KV state for the start token
+    bool detection_state_primed = false;
     std::vector<int64_t>& output_tokens = result.output_tokens;
     std::vector<Segment> segments;
 
@@ -298,24 +329,69 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
     for (size_t chunk_offset = 0; chunk_offset < input_features.n_frames; chunk_offset += segment_offset) {
         auto input_features_chunk = input_features.get_data_with_offset(chunk_offset, feature_extractor.nb_max_frames);
 
-        ov::Tensor hidden_state_tensor = encode(encoder,
-                                                input_features_chunk,
-                                                feature_extractor.feature_size,
-                                                feature_extractor.nb_max_frames,
-                                                raw_metrics);
+        // VAD gate: a silence-only window clamps to the normalized log-mel floor and has
+        // near-zero variance; skipping it saves the encoder+decoder passes entirely and avoids
+        // the hallucinated transcripts silence tends to produce
+        if (vad_feature_variance_threshold.has_value()) {
+            double mean = 0.0;
+            for (float value : input_features_chunk)
+                mean += value;
+            mean /= input_features_chunk.size();
+            double variance = 0.0;
+            for (float value : input_features_chunk)
+                variance += (value - mean) * (value - mean);
+            variance /= input_features_chunk.size();
+            if (variance < *vad_feature_variance_threshold) {
+                segment_offset = feature_extractor.nb_max_frames;
+                continue;
+            }
+        }
+
+        ov::Tensor hidden_state_tensor;
+        uint64_t mel_hash = 0;
+        if (encoder_cache != nullptr) {
+            mel_hash = WhisperEncoderResultCache::hash_mel_chunk(input_features_chunk);
+            hidden_state_tensor = encoder_cache->get(mel_hash);
+        }
+        if (!hidden_state_tensor) {
+            hidden_state_tensor = encode(encoder,
+                                         input_features_chunk,
+                                         feature_extractor.feature_size,
+                                         feature_extractor.nb_max_frames,
+                                         raw_metrics);
+            if (encoder_cache != nullptr) {
+                encoder_cache->put(mel_hash, hidden_state_tensor);
+            }
+        }
 
         // prepare init_tokens just once for whole input
         if (init_tokens.empty()) {
-            init_tokens = prepare_init_tokens(hidden_state_tensor, decoder, config, return_timestamps, raw_metrics);
+            init_tokens = prepare_init_tokens(hidden_state_tensor, decoder, config, return_timestamps, raw_metrics,
+                                              detection_state_primed);
         }
 
         std::vector<int64_t> chunk_init_tokens = ov::genai::get_prompt_tokens(context_tokens, config, chunk_offset);
         chunk_init_tokens.insert(chunk_init_tokens.end(), init_tokens.begin(), init_tokens.end());
 
-        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, chunk_init_tokens, config, 1);
+        SequenceGroup::Ptr sequence_group = SequenceGroup::create(0, chunk_init_tokens, config, 1);
+
+        // When language detection left the decoder state holding the start token, the first
+        // decode continues from position 1 instead of re-decoding it. Context tokens prepended
+        // before the start token shift positions, so the primed state is unusable there.
+        const std::vector<int64_t>* decoder_input_tokens = &chunk_init_tokens;
+        std::vector<int64_t> trimmed_input_tokens;
+        if (detection_state_primed) {
+            detection_state_primed = false;  // the primed state is consumed by this decode
+            if (chunk_init_tokens.size() > 1 && chunk_init_tokens.front() == config.decoder_start_token_id) {
+                trimmed_input_tokens.assign(chunk_init_tokens.begin() + 1, chunk_init_tokens.end());
+                decoder_input_tokens = &trimmed_input_tokens;
+            } else {
+                decoder->reset_state();
+            }
+        }
 
         auto [result, cancelled] = decode(decoder,
-                                          chunk_init_tokens,
+                                          *decoder_input_tokens,
                                           hidden_state_tensor,
                                           streamer,
                                           sampler,
@@ -323,6 +399,14 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                           return_timestamps,
                                           config,
                                           raw_metrics);
+        // NOTE on preamble KV reuse across chunks: only the *self*-attention entries of the
+        // constant preamble (prev_sot + hotwords + SOT/language/task tokens, identical for every
+        // chunk but the first) are encoder-independent and thus reusable; the cross-attention
+        // entries are projections of this chunk's encoder output and must be recomputed anyway.
+        // Splicing just the self-attention part needs per-variable state surgery between the
+        // decoder's fused prefill and the first sampled token, which the opaque
+        // VariableState tensors of the stateful decoder do not permit from here - the
+        // decoder models would need to expose self- and cross-attention caches separately.
         decoder->reset_state();
         std::vector<int64_t> chunk_output_tokens = result.tokens[0];
 
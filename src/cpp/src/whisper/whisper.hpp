@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <list>
+#include <unordered_map>
+
 #include <openvino/openvino.hpp>
 
 #include "context_tokens.hpp"
@@ -23,6 +26,48 @@ struct Segment {
     std::vector<int64_t> m_tokens;
 };
 
+/**
+ * @brief Optional LRU cache of encoder outputs keyed by a hash of the mel chunk, so repeated or
+ * overlapping 30s windows (VAD re-segmentation, identical hold-music segments) skip the encoder.
+ * Stored outputs are deep copies: the encoder infer request reuses its output tensor.
+ * Lookup is purely hash-based (64-bit FNV-1a over the raw mel bits): windows must be bit-identical
+ * to hit, and the accidental-collision probability is negligible for benign audio.
+ */
+class WhisperEncoderResultCache {
+public:
+    explicit WhisperEncoderResultCache(size_t capacity) : m_capacity(capacity) {}
+
+    ov::Tensor get(uint64_t mel_hash) {
+        auto it = m_entries.find(mel_hash);
+        if (it == m_entries.end()) {
+            return {};
+        }
+        m_lru_order.splice(m_lru_order.begin(), m_lru_order, it->second.first);
+        return it->second.second;
+    }
+
+    void put(uint64_t mel_hash, const ov::Tensor& encoder_output) {
+        if (m_capacity == 0 || m_entries.count(mel_hash)) {
+            return;
+        }
+        if (m_entries.size() >= m_capacity) {
+            m_entries.erase(m_lru_order.back());
+            m_lru_order.pop_back();
+        }
+        ov::Tensor copy(encoder_output.get_element_type(), encoder_output.get_shape());
+        encoder_output.copy_to(copy);
+        m_lru_order.push_front(mel_hash);
+        m_entries.emplace(mel_hash, std::make_pair(m_lru_order.begin(), std::move(copy)));
+    }
+
+    static uint64_t hash_mel_chunk(const std::vector<float>& mel_data);
+
+private:
+    size_t m_capacity;
+    std::list<uint64_t> m_lru_order;
+    std::unordered_map<uint64_t, std::pair<std::list<uint64_t>::iterator, ov::Tensor>> m_entries;
+};
+
 struct WhisperGenerateResult {
     std::vector<int64_t> output_tokens;
     std::optional<std::vector<Segment>> segments = std::nullopt;
@@ -37,7 +82,9 @@ WhisperGenerateResult whisper_generate(const ov::genai::WhisperGenerationConfig&
                                        std::shared_ptr<WhisperDecoder> decoder,
                                        WhisperFeatureExtractor& feature_extractor,
                                        const std::shared_ptr<StreamerBase> streamer,
-                                       Sampler& sampler);
+                                       Sampler& sampler,
+                                       WhisperEncoderResultCache* encoder_cache = nullptr,
+                                       std::optional<float> vad_feature_variance_threshold = std::nullopt);
 
 }  // namespace genai
 }  // namespace ov
@@ -138,11 +138,12 @@ static void log_mel_spectrogram_worker_thread(int ith,
                                               const std::vector<float>& mel_filter,
                                               WhisperFeatures& features,
                                               const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
+                                              const std::vector<float>& cos_vals,
+                                              int first_frame) {
     std::vector<float> fft_in(frame_size, 0.0);
     std::vector<float> fft_out(2 * frame_size);
     int n_fft = 1 + (frame_size / 2);
-    int i = ith;
+    int i = first_frame + ith;
 
     OPENVINO_ASSERT(mel_filter.size() == n_fft * features.feature_size);
 
@@ -345,12 +346,11 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                               const size_t n_threads,
                                               const std::vector<float>& mel_filter,
                                               const std::vector<float>& sin_vals,
-                                              const std::vector<float>& cos_vals) {
-    // Hanning window (Use cosf to eliminate difference)
-    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
-    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
-    std::vector<float> hann;
-    hann_window(n_fft, true, hann);
+                                              const std::vector<float>& cos_vals,
+                                              const std::vector<float>& hann,
+                                              size_t first_frame_to_compute = 0,
+                                              const std::vector<float>* previous_log_mel = nullptr,
+                                              std::vector<float>* log_mel_out = nullptr) {
 
     const size_t reflect_pad_size = n_fft / 2;
     auto padded_raw_speech = pad(raw_speech, sampling_rate * 30, reflect_pad_size);
@@ -362,13 +362,25 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
     features.n_frames = (padded_raw_speech.size() - n_fft) / hop_length;
     features.data.resize(features.feature_size * features.n_frames);
 
+    if (previous_log_mel != nullptr && first_frame_to_compute > 0) {
+        // reuse the stable (unchanged-audio) frames of the previous incremental call; the layout
+        // is [feature, frame], so the stable columns are copied row by row
+        OPENVINO_ASSERT(previous_log_mel->size() == features.data.size(), "incremental state does not match the current frame count");
+        for (size_t j = 0; j < features.feature_size; ++j) {
+            std::copy_n(previous_log_mel->begin() + j * features.n_frames, first_frame_to_compute,
+                        features.data.begin() + j * features.n_frames);
+        }
+    }
+
     {
         std::vector<std::thread> workers(n_threads - 1);
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw] = std::thread(log_mel_spectrogram_worker_thread,
                                       iw + 1,
                                       std::cref(hann),
-                                      padded_raw_speech,
+                                      // by reference: the workers are joined below, and the
+                                      // previous by-value pass copied ~2MB of samples per thread
+                                      std::cref(padded_raw_speech),
                                       raw_speech.size() + reflect_pad_size,
                                       n_fft,
                                       hop_length,
@@ -376,7 +388,8 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                       std::cref(mel_filter),
                                       std::ref(features),
                                       std::cref(sin_vals),
-                                      std::cref(cos_vals));
+                                      std::cref(cos_vals),
+                                      static_cast<int>(first_frame_to_compute));
         }
 
         // main thread
@@ -390,13 +403,20 @@ WhisperFeatures mel_spectrogram_convert_audio(const std::vector<float>& raw_spee
                                           mel_filter,
                                           features,
                                           sin_vals,
-                                          cos_vals);
+                                          cos_vals,
+                                          static_cast<int>(first_frame_to_compute));
 
         for (int iw = 0; iw < n_threads - 1; ++iw) {
             workers[iw].join();
         }
     }
 
+    if (log_mel_out != nullptr) {
+        // hand out the unnormalized frames: normalization below is global over all frames and
+        // changes as audio grows, so only the pre-normalization data is reusable incrementally
+        *log_mel_out = features.data;
+    }
+
     // clamping and normalization
     double mmax = -1e20;
     for (int i = 0; i < features.feature_size * features.n_frames; i++) {
@@ -444,6 +464,10 @@ WhisperFeatureExtractor::WhisperFeatureExtractor(const std::filesystem::path& pr
     init_parameters(preprocessor_json_path);
     fill_sin_cos_table(sin_vals, cos_vals, n_fft);
     init_mel_filter();
+    // Hanning window (Use cosf to eliminate difference)
+    // ref: https://pytorch.org/docs/stable/generated/torch.hann_window.html
+    // ref: https://github.com/openai/whisper/blob/main/whisper/audio.py#L147
+    hann_window(n_fft, true, hann_window_values);
 }
 
 void WhisperFeatureExtractor::init_parameters(const std::filesystem::path& preprocessor_json_path) {
@@ -479,8 +503,54 @@ void WhisperFeatureExtractor::init_mel_filter() {
     }
 }
 
+WhisperFeatures WhisperFeatureExtractor::extract_incremental(const std::vector<float>& raw_speech,
+                                                             IncrementalState& state) {
+    OPENVINO_ASSERT(raw_speech.size() >= state.n_samples_seen,
+                    "extract_incremental expects the audio buffer to extend the previous call");
+    size_t n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+    const size_t reflect_pad_size = n_fft / 2;
+
+    // frames are identical across calls while the padded buffer length (and thus the frame grid)
+    // is unchanged; for audio shorter than the 30s minimum the grid is always the same
+    size_t padded_len = std::max(raw_speech.size(), sampling_rate * 30) + 2 * reflect_pad_size;  // mirrors the pad() call in the driver
+    size_t expected_frames = (padded_len - n_fft) / hop_length;
+    size_t expected_size = feature_size * expected_frames;
+
+    size_t first_frame_to_compute = 0;
+    const std::vector<float>* previous_log_mel = nullptr;
+    if (state.n_stable_frames > 0 && state.log_mel.size() == expected_size) {
+        first_frame_to_compute = std::min(state.n_stable_frames, expected_frames);
+        previous_log_mel = &state.log_mel;
+    }
+
+    auto features = mel_spectrogram_convert_audio(raw_speech,
+                                                  sampling_rate,
+                                                  feature_size,
+                                                  n_fft,
+                                                  hop_length,
+                                                  n_threads,
+                                                  mel_filter,
+                                                  sin_vals,
+                                                  cos_vals,
+                                                  hann_window_values,
+                                                  first_frame_to_compute,
+                                                  previous_log_mel,
+                                                  &state.log_mel);
+
+    // a frame is stable once its analysis window lies entirely within the received samples:
+    // frame i covers original samples [i * hop - pad, i * hop - pad + n_fft)
+    state.n_samples_seen = raw_speech.size();
+    // the leading reflection is final only once reflect_pad_size + 1 real samples exist
+    state.n_stable_frames = (raw_speech.size() >= reflect_pad_size + 1 && raw_speech.size() + reflect_pad_size >= n_fft)
+        ? std::min((raw_speech.size() + reflect_pad_size - n_fft) / hop_length + 1, expected_frames)
+        : 0;
+    return features;
+}
+
 WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_speech) {
-    size_t n_threads = std::min(4, (int32_t)std::thread::hardware_concurrency());
+    // the spectrogram is frame-parallel (~3000 independent frames per 30s chunk), so scale over
+    // all hardware threads instead of the previous fixed cap of 4
+    size_t n_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
     return mel_spectrogram_convert_audio(raw_speech,
                                          sampling_rate,
                                          feature_size,
@@ -489,7 +559,8 @@ WhisperFeatures WhisperFeatureExtractor::extract(const std::vector<float>& raw_s
                                          n_threads,
                                          mel_filter,
                                          sin_vals,
-                                         cos_vals);
+                                         cos_vals,
+                                         hann_window_values);
 }
 
 }  // namespace genai
@@ -51,10 +51,31 @@ public:
      */
     WhisperFeatures extract(const std::vector<float>& raw_speech);
 
+    /**
+     * @brief Incremental extraction state for streaming audio: unnormalized log-mel frames of the
+     * audio seen so far plus how many of them are final (their analysis windows lie entirely
+     * within already received samples, so growing the audio cannot change them).
+     */
+    struct IncrementalState {
+        std::vector<float> log_mel;
+        size_t n_stable_frames = 0;
+        size_t n_samples_seen = 0;
+    };
+
+    /**
+     * @brief Like extract(), but for a growing audio buffer of a streaming session: frames whose
+     * windows are fully covered by previously seen samples are reused from `state` instead of
+     * being recomputed, so per-chunk cost is bounded by the freshly arrived audio. `raw_speech`
+     * must extend the audio of the previous call with the same state.
+     */
+    WhisperFeatures extract_incremental(const std::vector<float>& raw_speech, IncrementalState& state);
+
 private:
     std::vector<float> sin_vals;
     std::vector<float> cos_vals;
     std::vector<float> mel_filter;
+    // Hann window precomputed once and shared across extract calls
+    std::vector<float> hann_window_values;
 
     void init_mel_filter();
     void init_parameters(const std::filesystem::path& preprocessor_json_path);
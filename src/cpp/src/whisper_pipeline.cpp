@@ -19,6 +19,15 @@
 #include "whisper_pipeline_base.hpp"
 #include "whisper_pipeline_static.hpp"
 
+// NOTE on continuous batching for Whisper: the continuous batching stack (Scheduler/BlockManager/
+// ModelRunner) is built around decoder-only models whose KV cache is rewritten into paged form by
+// SDPAToPagedAttention. Whisper is encoder-decoder: the decoder holds both self-attention caches
+// (pageable in principle) and per-request cross-attention caches bound to the encoder output,
+// which the paged attention transformation and the PagedAttention op do not model. Until the
+// transformation learns encoder-decoder graphs, a CB Whisper backend would have to keep
+// cross-attention KV outside the block manager per request, which is exactly the static batching
+// we have; encoder-call batching across requests is the piece that can be built independently and
+// should start at WhisperPipelineStatefulImpl's encode path.
 namespace {
 ov::genai::OptionalWhisperGenerationConfig get_config_from_map(const ov::AnyMap& config_map) {
     if (config_map.count("generation_config")) {
@@ -56,12 +65,31 @@ public:
           m_sampler(m_tokenizer) {
         ov::Core core = utils::singleton_core();
 
+        // optional encoder output cache for workloads re-transcribing repeated/overlapping windows
+        auto mutable_properties = properties;
+        auto cache_capacity_it = mutable_properties.find("encoder_cache_capacity");
+        if (cache_capacity_it != mutable_properties.end()) {
+            size_t capacity = cache_capacity_it->second.as<size_t>();
+            if (capacity > 0) {
+                m_encoder_cache = std::make_unique<WhisperEncoderResultCache>(capacity);
+            }
+            mutable_properties.erase(cache_capacity_it);
+        }
+
+        // optional VAD gate: windows whose normalized log-mel variance is below the threshold are
+        // treated as silence and skip encoder/decoder inference entirely
+        auto vad_threshold_it = mutable_properties.find("vad_feature_variance_threshold");
+        if (vad_threshold_it != mutable_properties.end()) {
+            m_vad_feature_variance_threshold = vad_threshold_it->second.as<float>();
+            mutable_properties.erase(vad_threshold_it);
+        }
+
         ov::CompiledModel compiled_model =
-            core.compile_model(models_path / "openvino_encoder_model.xml", device, properties);
+            core.compile_model(models_path / "openvino_encoder_model.xml", device, mutable_properties);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "whisper encoder model");
         m_encoder = init_model(compiled_model);
 
-        m_decoder = WhisperDecoder::from_path(models_path, device, properties);
+        m_decoder = WhisperDecoder::from_path(models_path, device, mutable_properties);
 
         // If eos_token_id was not provided, take value
         if (m_generation_config.eos_token_id == -1) {
@@ -95,7 +123,9 @@ public:
                                                            m_decoder,
                                                            m_feature_extractor,
                                                            streamer,
-                                                           m_sampler);
+                                                           m_sampler,
+                                                           m_encoder_cache.get(),
+                                                           m_vad_feature_variance_threshold);
         auto decode_start_time = std::chrono::steady_clock::now();
         WhisperDecodedResults result{std::vector{m_tokenizer.decode(generate_result.output_tokens)}, std::vector{1.f}};
         generate_result.perf_metrics.raw_metrics.detokenization_durations.emplace_back(
@@ -133,6 +163,8 @@ public:
 
 private:
     ov::InferRequest m_encoder;
+    std::unique_ptr<WhisperEncoderResultCache> m_encoder_cache;
+    std::optional<float> m_vad_feature_variance_threshold;
     std::shared_ptr<ov::genai::WhisperDecoder> m_decoder;
     Sampler m_sampler;
 };
@@ -4,7 +4,13 @@
 #include "whisper_pipeline_static.hpp"
 
 #include <chrono>
+#include <fstream>
+#include <future>
+#include <map>
 #include <regex>
+#include <sstream>
+
+#include "openvino/core/version.hpp"
 
 #include "debug_utils.hpp"
 #include "openvino/runtime/intel_npu/properties.hpp"
@@ -819,6 +825,60 @@ std::shared_ptr<ov::Model> prepare_decoder_with_past_model(std::shared_ptr<ov::M
     return decoder_with_past_model;
 }
 
+// Stable cache key for a compiled blob: model tag, compile properties and the OpenVINO build,
+// so a driver/runtime update or a property change never resurrects a stale blob
+std::string blob_cache_key(const std::string& model_tag, const ov::AnyMap& properties) {
+    std::string content = model_tag + "|" + ov::get_openvino_version().buildNumber;
+    std::map<std::string, std::string> sorted_properties;
+    for (const auto& [name, value] : properties) {
+        try {
+            sorted_properties[name] = value.as<std::string>();
+        } catch (const ov::Exception&) {
+            // non-stringifiable properties do not affect the key
+        }
+    }
+    for (const auto& [name, value] : sorted_properties) {
+        content += "|" + name + "=" + value;
+    }
+    std::stringstream key;
+    key << model_tag << "_" << std::hex << std::hash<std::string>{}(content);
+    return key.str();
+}
+
+// Compiles the model for NPU or, when blob_cache_dir is set, imports a previously exported
+// compiled blob keyed by blob_cache_key, exporting on a cache miss. NPU compilation dominates
+// construction time, so a warm cache makes reconstruction close to blob-read speed.
+ov::CompiledModel compile_with_blob_cache(const std::shared_ptr<ov::Model>& model,
+                                          const std::string& model_tag,
+                                          const ov::AnyMap& properties,
+                                          const std::filesystem::path& blob_cache_dir) {
+    ov::Core core = ov::genai::utils::singleton_core();
+    if (blob_cache_dir.empty()) {
+        return core.compile_model(model, "NPU", properties);
+    }
+    const auto blob_path = blob_cache_dir / (blob_cache_key(model_tag, properties) + ".blob");
+    if (std::filesystem::exists(blob_path)) {
+        try {
+            std::ifstream fin(blob_path, std::ios::in | std::ios::binary);
+            OPENVINO_ASSERT(fin.is_open(), "Blob file can't be opened: ", blob_path);
+            return core.import_model(fin, "NPU", properties);
+        } catch (const std::exception&) {
+            // a corrupt or incompatible blob falls back to compilation and is re-exported below
+        }
+    }
+    ov::CompiledModel compiled = core.compile_model(model, "NPU", properties);
+    try {
+        std::filesystem::create_directories(blob_cache_dir);
+        std::ofstream fout(blob_path, std::ios::out | std::ios::binary);
+        if (fout.is_open()) {
+            compiled.export_model(fout);
+        }
+    } catch (const std::exception&) {
+        // failing to populate the cache must not fail construction
+    }
+    return compiled;
+}
+
 }  // namespace
 
 namespace ov {
@@ -828,8 +888,11 @@ ov::InferRequest DecoderCache::get_model(uint8_t input_ids_size) {
     if (m_cache.find(input_ids_size) == m_cache.cend()) {
         reshape_input_ids(m_decoder_model, input_ids_size);
 
-        ov::Core core = utils::singleton_core();
-        ov::CompiledModel compiled_model = core.compile_model(m_decoder_model, "NPU", m_properties);
+        ov::CompiledModel compiled_model =
+            compile_with_blob_cache(m_decoder_model,
+                                    "whisper_decoder_" + std::to_string(input_ids_size),
+                                    m_properties,
+                                    m_blob_cache_dir);
         ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder model");
         m_cache.emplace(input_ids_size, compiled_model.create_infer_request());
     }
@@ -843,6 +906,12 @@ WhisperPipeline::StaticWhisperPipeline::StaticWhisperPipeline(const std::filesys
     , m_sampler(m_tokenizer) {
     ov::Core core = utils::singleton_core();
 
+    // When BLOB_CACHE_DIR is set, compiled blobs of every submodel are exported there and
+    // imported on subsequent constructions, skipping NPU compilation on warm starts
+    ov::AnyMap compile_properties = properties;
+    const std::filesystem::path blob_cache_dir =
+        utils::pop_or_default(compile_properties, "BLOB_CACHE_DIR", std::string{});
+
     auto encoder_model = core.read_model(models_path / "openvino_encoder_model.xml", {}, properties);
 
     std::shared_ptr<ov::Model> decoder_model;
@@ -879,17 +948,19 @@ WhisperPipeline::StaticWhisperPipeline::StaticWhisperPipeline(const std::filesys
     preprocess_decoder(decoder_model);
     preprocess_decoder(decoder_with_past_model);
 
-    ov::CompiledModel compiled_model;
-    compiled_model = core.compile_model(encoder_model, "NPU", properties);
+    // The decoder-with-past is not needed until the first decode loop, so its (long) NPU
+    // compilation runs in the background and overlaps feature extraction, the first encoder
+    // run and init-ids preparation; generate() joins it right before decoding
+    m_decoder_with_past_compilation = std::async(std::launch::async, [decoder_with_past_model, compile_properties, blob_cache_dir]() {
+        return compile_with_blob_cache(decoder_with_past_model, "whisper_decoder_with_past", compile_properties, blob_cache_dir);
+    });
+
+    ov::CompiledModel compiled_model = compile_with_blob_cache(encoder_model, "whisper_encoder", compile_properties, blob_cache_dir);
     ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper encoder model");
     m_models.encoder = compiled_model.create_infer_request();
 
     // Will compile decoder model when it's needed 
-    m_decoder_cache = DecoderCache(decoder_model, properties);
-
-    compiled_model = core.compile_model(decoder_with_past_model, "NPU", properties);
-    ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder with past model");
-    m_models.decoder_with_past = compiled_model.create_infer_request();
+    m_decoder_cache = DecoderCache(decoder_model, compile_properties, blob_cache_dir);
 
     // If eos_token_id was not provided, take value
     if (m_generation_config.eos_token_id == -1) {
@@ -899,6 +970,14 @@ WhisperPipeline::StaticWhisperPipeline::StaticWhisperPipeline(const std::filesys
     m_sampler.set_seed(m_generation_config.rng_seed);
 }
 
+void WhisperPipeline::StaticWhisperPipeline::ensure_decoder_with_past() {
+    if (m_decoder_with_past_compilation.valid()) {
+        ov::CompiledModel compiled_model = m_decoder_with_past_compilation.get();
+        ov::genai::utils::print_compiled_model_properties(compiled_model, "Static Whisper decoder with past model");
+        m_models.decoder_with_past = compiled_model.create_infer_request();
+    }
+}
+
 WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
     const RawSpeechInput& raw_speech_input,
     OptionalWhisperGenerationConfig generation_config,
@@ -967,7 +1046,9 @@ WhisperDecodedResults WhisperPipeline::StaticWhisperPipeline::generate(
             m_models.decoder = m_decoder_cache.get_model(init_ids.size());
         }
 
-        SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, init_ids, config, 1);
+        ensure_decoder_with_past();
+
+        SequenceGroup::Ptr sequence_group = SequenceGroup::create(0, init_ids, config, 1);
 
         auto [results, cancelled] = full_decode(hidden_state_tensor,
                                                 config,
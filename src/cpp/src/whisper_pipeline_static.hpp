@@ -4,6 +4,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <string>
 
 #include "openvino/genai/streamer_base.hpp"
@@ -19,15 +20,17 @@ namespace genai {
 class DecoderCache {
 public:
     DecoderCache() = default;
-    DecoderCache(std::shared_ptr<ov::Model> model, ov::AnyMap properties)
+    DecoderCache(std::shared_ptr<ov::Model> model, ov::AnyMap properties, std::filesystem::path blob_cache_dir = {})
      : m_decoder_model(model)
-     , m_properties(properties) {}
+     , m_properties(properties)
+     , m_blob_cache_dir(std::move(blob_cache_dir)) {}
 
     ov::InferRequest get_model(uint8_t input_ids_size);
 private:
     std::unordered_map<uint8_t, ov::InferRequest> m_cache;
     std::shared_ptr<ov::Model> m_decoder_model;
     ov::AnyMap m_properties;
+    std::filesystem::path m_blob_cache_dir;
 };
 
 class WhisperPipeline::StaticWhisperPipeline : public WhisperPipeline::WhisperPipelineImplBase {
@@ -39,8 +42,13 @@ public:
                                    const std::shared_ptr<StreamerBase> streamer) override;
 
 private:
+    // joins the background decoder-with-past compilation started by the constructor; no-op
+    // once the infer request is materialized
+    void ensure_decoder_with_past();
+
     WhisperInitializedModels m_models;
     DecoderCache m_decoder_cache;
+    std::future<ov::CompiledModel> m_decoder_with_past_compilation;
     Sampler m_sampler;
 };
 
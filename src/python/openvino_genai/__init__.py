@@ -89,5 +89,6 @@ from .py_openvino_genai import (
     GenerationStatus,
     SchedulerConfig,
     CacheEvictionConfig,
-    AggregationMode
+    AggregationMode,
+    KVCachePlacementPolicy
 )
@@ -5,7 +5,7 @@ from __future__ import annotations
 import openvino._pyopenvino
 import os
 import typing
-__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
+__all__ = ['Adapter', 'AdapterConfig', 'AggregationMode', 'AutoencoderKL', 'BlockManagerStats', 'CLIPTextModel', 'CLIPTextModelWithProjection', 'CacheEvictionConfig', 'ChunkStreamerBase', 'ContinuousBatchingPipeline', 'CppStdGenerator', 'DecodedResults', 'EncodedGenerationResult', 'EncodedResults', 'FluxTransformer2DModel', 'GenerationConfig', 'GenerationFinishReason', 'GenerationHandle', 'GenerationOutput', 'GenerationResult', 'GenerationStatus', 'Generator', 'Image2ImagePipeline', 'ImageGenerationConfig', 'ImageGenerationPerfMetrics', 'InpaintingPipeline', 'KVCachePlacementPolicy', 'LLMPipeline', 'MeanStdPair', 'PerfMetrics', 'PhiloxGenerator', 'PipelineMetrics', 'RawImageGenerationPerfMetrics', 'RawPerfMetrics', 'SD3Transformer2DModel', 'Scheduler', 'SchedulerConfig', 'SchedulingDecisionRecord', 'SpeculativeDecodingSnapshot', 'StepPhaseTimings', 'StopCriteria', 'StreamerBase', 'StreamingStatus', 'T5EncoderModel', 'Text2ImagePipeline', 'TextStreamer', 'TokenizedInputs', 'Tokenizer', 'TorchGenerator', 'UNet2DConditionModel', 'VLMDecodedResults', 'VLMPerfMetrics', 'VLMPipeline', 'VLMRawPerfMetrics', 'WhisperDecodedResultChunk', 'WhisperDecodedResults', 'WhisperGenerationConfig', 'WhisperPerfMetrics', 'WhisperPipeline', 'WhisperRawPerfMetrics', 'draft_model', 'get_version']
 class Adapter:
     """
     Immutable LoRA Adapter that carries the adaptation matrices and serves as unique adapter identifier.
@@ -119,8 +119,9 @@ class AggregationMode:
       NORM_SUM
     """
     NORM_SUM: typing.ClassVar[AggregationMode]  # value = <AggregationMode.NORM_SUM: 1>
+    SNAP_KV: typing.ClassVar[AggregationMode]  # value = <AggregationMode.SNAP_KV: 2>
     SUM: typing.ClassVar[AggregationMode]  # value = <AggregationMode.SUM: 0>
-    __members__: typing.ClassVar[dict[str, AggregationMode]]  # value = {'SUM': <AggregationMode.SUM: 0>, 'NORM_SUM': <AggregationMode.NORM_SUM: 1>}
+    __members__: typing.ClassVar[dict[str, AggregationMode]]  # value = {'SUM': <AggregationMode.SUM: 0>, 'NORM_SUM': <AggregationMode.NORM_SUM: 1>, 'SNAP_KV': <AggregationMode.SNAP_KV: 2>}
     def __eq__(self, other: typing.Any) -> bool:
         ...
     def __getstate__(self) -> int:
@@ -216,6 +217,36 @@ class AutoencoderKL:
         ...
     def reshape(self, batch_size: int, height: int, width: int) -> AutoencoderKL:
         ...
+class BlockManagerStats:
+    """
+    Snapshot of KV block manager telemetry counters: pool occupancy, prefix-cache reuse/eviction rates and copy-on-write activity
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def free_blocks(self) -> int:
+        ...
+    @property
+    def num_blocks_allocated(self) -> int:
+        ...
+    @property
+    def num_blocks_freed(self) -> int:
+        ...
+    @property
+    def num_blocks_overwritten(self) -> int:
+        ...
+    @property
+    def num_blocks_restored(self) -> int:
+        ...
+    @property
+    def num_cow_copies(self) -> int:
+        ...
+    @property
+    def overwritable_blocks(self) -> int:
+        ...
+    @property
+    def total_blocks(self) -> int:
+        ...
 class CLIPTextModel:
     """
     CLIPTextModel class.
@@ -337,6 +368,9 @@ class CacheEvictionConfig:
     """
     aggregation_mode: AggregationMode
     apply_rotation: bool
+    landmark_score_percentile: float
+    snapkv_kernel_size: int
+    snapkv_window_size: int
     def __init__(self, start_size: int, recent_size: int, max_cache_size: int, aggregation_mode: AggregationMode, apply_rotation: bool = False) -> None:
         ...
     def get_evictable_size(self) -> int:
@@ -399,14 +433,48 @@ class ContinuousBatchingPipeline:
         ...
     def get_config(self) -> GenerationConfig:
         ...
+    def embed(self, prompts: list[str]) -> list[openvino._pyopenvino.Tensor]:
+        """
+        Runs a prompt-only pass and returns the final hidden state of each prompt's last token; requires construction with enable_hidden_state_output.
+        """
+    def warmup(self, prompt_lengths: list[int] = [64]) -> None:
+        """
+        Runs synthetic prefill+decode iterations across the given prompt lengths so the first real request does not pay cold-start costs.
+        """
+    def get_recent_scheduling_decisions(self) -> list[SchedulingDecisionRecord]:
+        """
+        Returns recent per-step scheduling decision records (newest last, bounded history).
+        """
+    def get_speculative_decoding_snapshot(self) -> SpeculativeDecodingSnapshot:
+        """
+        Returns a live snapshot of speculative decoding acceptance and duration statistics; non-speculative pipelines return an empty snapshot.
+        """
+    def get_block_manager_stats(self) -> BlockManagerStats:
+        ...
     def get_metrics(self) -> PipelineMetrics:
         ...
+    def get_recent_step_timings(self, max_steps: int = 256) -> list[StepPhaseTimings]:
+        ...
     def get_tokenizer(self) -> Tokenizer:
         ...
     def has_non_finished_requests(self) -> bool:
         ...
+    @typing.overload
+    def pin_prompt_prefix(self, input_ids: openvino._pyopenvino.Tensor) -> int:
+        ...
+    @typing.overload
+    def pin_prompt_prefix(self, prompt: str) -> int:
+        ...
     def step(self) -> None:
         ...
+    @typing.overload
+    def unpin_prompt_prefix(self, input_ids: openvino._pyopenvino.Tensor) -> int:
+        ...
+    @typing.overload
+    def unpin_prompt_prefix(self, prompt: str) -> int:
+        ...
+    def update_scheduler_limits(self, config: SchedulerConfig) -> None:
+        ...
 class CppStdGenerator(Generator):
     """
     This class wraps std::mt19937 pseudo-random generator.
@@ -606,6 +674,7 @@ class GenerationConfig:
     logprobs: int
     max_length: int
     max_new_tokens: int
+    max_unread_stream_outputs: int
     max_ngram_size: int
     min_new_tokens: int
     no_repeat_ngram_size: int
@@ -615,7 +684,9 @@ class GenerationConfig:
     num_return_sequences: int
     presence_penalty: float
     repetition_penalty: float
+    request_timeout_s: float
     rng_seed: int
+    scheduling_priority: int
     stop_criteria: StopCriteria
     stop_strings: set[str]
     stop_token_ids: set[int]
@@ -699,6 +770,8 @@ class GenerationHandle:
         ...
     def read_all(self) -> list[GenerationOutput]:
         ...
+    def read_pending(self) -> dict[int, GenerationOutput]:
+        ...
     def stop(self) -> None:
         ...
 class GenerationOutput:
@@ -1108,6 +1181,47 @@ class InpaintingPipeline:
         ...
     def set_scheduler(self, scheduler: Scheduler) -> None:
         ...
+class KVCachePlacementPolicy:
+    """
+    Physical memory placement policy for CPU KV cache tensors
+                                   :param KVCachePlacementPolicy.DEFAULT: leave page placement to the default allocator behavior
+                                   :param KVCachePlacementPolicy.INTERLEAVED: interleave KV cache pages over NUMA nodes via parallel first-touch initialization, recommended for multi-socket CPU serving
+    
+    Members:
+    
+      DEFAULT
+    
+      INTERLEAVED
+    """
+    DEFAULT: typing.ClassVar[KVCachePlacementPolicy]  # value = <KVCachePlacementPolicy.DEFAULT: 0>
+    INTERLEAVED: typing.ClassVar[KVCachePlacementPolicy]  # value = <KVCachePlacementPolicy.INTERLEAVED: 1>
+    __members__: typing.ClassVar[dict[str, KVCachePlacementPolicy]]  # value = {'DEFAULT': <KVCachePlacementPolicy.DEFAULT: 0>, 'INTERLEAVED': <KVCachePlacementPolicy.INTERLEAVED: 1>}
+    def __eq__(self, other: typing.Any) -> bool:
+        ...
+    def __getstate__(self) -> int:
+        ...
+    def __hash__(self) -> int:
+        ...
+    def __index__(self) -> int:
+        ...
+    def __init__(self, value: int) -> None:
+        ...
+    def __int__(self) -> int:
+        ...
+    def __ne__(self, other: typing.Any) -> bool:
+        ...
+    def __repr__(self) -> str:
+        ...
+    def __setstate__(self, state: int) -> None:
+        ...
+    def __str__(self) -> str:
+        ...
+    @property
+    def name(self) -> str:
+        ...
+    @property
+    def value(self) -> int:
+        ...
 class LLMPipeline:
     """
     This class is used for generation with LLMs
@@ -1282,6 +1396,10 @@ class LLMPipeline:
         ...
     def start_chat(self, system_message: str = '') -> None:
         ...
+    def warmup(self, prompt_lengths: list[int] = [64]) -> None:
+        """
+        Runs synthetic prefill+decode iterations across the given prompt lengths so the first real request does not pay cold-start costs.
+        """
 class MeanStdPair:
     def __init__(self) -> None:
         ...
@@ -1375,6 +1493,20 @@ class PerfMetrics:
     @property
     def raw_metrics(self) -> RawPerfMetrics:
         ...
+class PhiloxGenerator(Generator):
+    """
+    Counter-based (Philox4x32-10) random generator: draws are a pure function of (seed, stream, counter), so parallel streams of one seed are order-independent and reproducible.
+    """
+    def __init__(self, seed: int, stream: int = 0) -> None:
+        ...
+    def next(self) -> float:
+        ...
+    def randn_tensor(self, shape: openvino._pyopenvino.Shape) -> openvino._pyopenvino.Tensor:
+        ...
+    def seed(self, new_seed: int) -> None:
+        ...
+    def set_stream(self, stream: int) -> None:
+        ...
 class PipelineMetrics:
     """
     
@@ -1623,7 +1755,10 @@ class SchedulerConfig:
         cache_size:                 total size of KV cache in GB.
         block_size:                 block size for KV cache.
         dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
-    
+        max_prefill_tokens_ratio:   maximum share of max_num_batched_tokens which prompt (prefill) tokens
+            can occupy within a single scheduler iteration when dynamic_split_fuse is enabled. Values below 1.0
+            bound the delay which a long incoming prompt can add to decode iterations of running sequences.
+
         vLLM-like settings:
         max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
         enable_prefix_caching:      Enable caching of KV-blocks.
@@ -1636,13 +1771,92 @@ class SchedulerConfig:
     cache_eviction_config: CacheEvictionConfig
     cache_size: int
     dynamic_split_fuse: bool
+    enable_kv_cache_offload: bool
+    enable_predictive_admission: bool
     enable_prefix_caching: bool
     max_num_batched_tokens: int
+    kv_cache_placement: KVCachePlacementPolicy
+    max_block_share_per_request: float
     max_num_seqs: int
+    max_prefill_tokens_ratio: float
+    num_full_precision_boundary_layers: int
     num_kv_blocks: int
+    step_time_slo_ms: float
     use_cache_eviction: bool
     def __init__(self) -> None:
         ...
+class SchedulingDecisionRecord:
+    """
+    One scheduling decision per pipeline step: scheduled/skipped requests with reasons
+    """
+    class SkipReason:
+        """
+        Members:
+
+          WAITING
+
+          TOKEN_BUDGET
+
+          BLOCK_SHORTAGE
+        """
+        BLOCK_SHORTAGE: typing.ClassVar[SchedulingDecisionRecord.SkipReason]
+        TOKEN_BUDGET: typing.ClassVar[SchedulingDecisionRecord.SkipReason]
+        WAITING: typing.ClassVar[SchedulingDecisionRecord.SkipReason]
+    @property
+    def cache_usage_percent(self) -> float:
+        ...
+    @property
+    def num_preemptions(self) -> int:
+        ...
+    @property
+    def scheduled_request_ids(self) -> list[int]:
+        ...
+    @property
+    def skipped_request_ids(self) -> list[tuple[int, SchedulingDecisionRecord.SkipReason]]:
+        ...
+    @property
+    def step(self) -> int:
+        ...
+    @property
+    def total_scheduled_tokens(self) -> int:
+        ...
+class SpeculativeDecodingSnapshot:
+    """
+    Live snapshot of speculative decoding acceptance and duration statistics, pollable while requests run
+    """
+    @property
+    def acceptance_rate_ewma_per_request(self) -> dict[int, float]:
+        ...
+    @property
+    def acceptance_rate_histogram(self) -> list[int]:
+        ...
+    @property
+    def draft_duration_ms(self) -> float:
+        ...
+    @property
+    def main_duration_ms(self) -> float:
+        ...
+class StepPhaseTimings:
+    """
+    Per-step phase timings (microseconds) recorded by the continuous batching step loop for live latency attribution
+    """
+    def __init__(self) -> None:
+        ...
+    @property
+    def infer_duration(self) -> float:
+        ...
+    @property
+    def postprocess_duration(self) -> float:
+        ...
+    @property
+    def sample_duration(self) -> float:
+        ...
+    @property
+    def schedule_duration(self) -> float:
+        ...
+    @property
+    def step_id(self) -> int:
+        ...
 class StopCriteria:
     """
     
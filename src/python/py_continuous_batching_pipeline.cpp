@@ -60,6 +60,9 @@ auto scheduler_config_docstring = R"(
     cache_size:                 total size of KV cache in GB.
     block_size:                 block size for KV cache.
     dynamic_split_fuse:         whether to split prompt / generate to different scheduling phases.
+    max_prefill_tokens_ratio:   maximum share of max_num_batched_tokens which prompt (prefill) tokens
+        can occupy within a single scheduler iteration when dynamic_split_fuse is enabled. Values below 1.0
+        bound the delay which a long incoming prompt can add to decode iterations of running sequences.
 
     vLLM-like settings:
     max_num_seqs:               max number of scheduled sequences (you can think of it as "max batch size").
@@ -211,8 +214,11 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("can_read", &GenerationHandleImpl::can_read)
         .def("stop", &GenerationHandleImpl::stop)
         .def("cancel", &GenerationHandleImpl::cancel)
-        .def("read", &GenerationHandleImpl::read)
-        .def("read_all", &GenerationHandleImpl::read_all);
+        // blocking reads release the GIL while waiting; read_pending delivers the whole backlog
+        // with a single acquisition, which is the batched pull-based iteration path for servers
+        .def("read", &GenerationHandleImpl::read, py::call_guard<py::gil_scoped_release>())
+        .def("read_pending", &GenerationHandleImpl::read_pending, py::call_guard<py::gil_scoped_release>())
+        .def("read_all", &GenerationHandleImpl::read_all, py::call_guard<py::gil_scoped_release>());
     OPENVINO_SUPPRESS_DEPRECATED_START
     generation_handle.def("drop", &GenerationHandleImpl::drop);
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -223,13 +229,24 @@ void init_continuous_batching_pipeline(py::module_& m) {
                                :param AggregationMode.SUM: In this mode the importance scores of each token will be summed after each step of generation
                                :param AggregationMode.NORM_SUM: Same as SUM, but the importance scores are additionally divided by the lifetime (in tokens generated) of a given token in cache)")
             .value("SUM", AggregationMode::SUM)
-            .value("NORM_SUM", AggregationMode::NORM_SUM);
+            .value("NORM_SUM", AggregationMode::NORM_SUM)
+            .value("SNAP_KV", AggregationMode::SNAP_KV);
+
+    py::enum_<ov::genai::KVCachePlacementPolicy>(m, "KVCachePlacementPolicy",
+                            R"(Physical memory placement policy for CPU KV cache tensors
+                               :param KVCachePlacementPolicy.DEFAULT: leave page placement to the default allocator behavior
+                               :param KVCachePlacementPolicy.INTERLEAVED: interleave KV cache pages over NUMA nodes via parallel first-touch initialization, recommended for multi-socket CPU serving)")
+            .value("DEFAULT", ov::genai::KVCachePlacementPolicy::DEFAULT)
+            .value("INTERLEAVED", ov::genai::KVCachePlacementPolicy::INTERLEAVED);
 
     py::class_<CacheEvictionConfig>(m, "CacheEvictionConfig", cache_eviction_config_docstring)
             .def(py::init<>([](const size_t start_size, size_t recent_size, size_t max_cache_size, AggregationMode aggregation_mode, bool apply_rotation) {
                 return CacheEvictionConfig{start_size, recent_size, max_cache_size, aggregation_mode, apply_rotation}; }),
                  py::arg("start_size"), py::arg("recent_size"), py::arg("max_cache_size"), py::arg("aggregation_mode"), py::arg("apply_rotation") = false)
             .def_readwrite("aggregation_mode", &CacheEvictionConfig::aggregation_mode)
+            .def_readwrite("snapkv_window_size", &CacheEvictionConfig::snapkv_window_size)
+            .def_readwrite("snapkv_kernel_size", &CacheEvictionConfig::snapkv_kernel_size)
+            .def_readwrite("landmark_score_percentile", &CacheEvictionConfig::landmark_score_percentile)
             .def_readwrite("apply_rotation", &CacheEvictionConfig::apply_rotation)
             .def("get_start_size", &CacheEvictionConfig::get_start_size)
             .def("get_recent_size", &CacheEvictionConfig::get_recent_size)
@@ -242,11 +259,61 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def_readwrite("num_kv_blocks", &SchedulerConfig::num_kv_blocks)
         .def_readwrite("cache_size", &SchedulerConfig::cache_size)
         .def_readwrite("dynamic_split_fuse", &SchedulerConfig::dynamic_split_fuse)
+        .def_readwrite("max_prefill_tokens_ratio", &SchedulerConfig::max_prefill_tokens_ratio)
+        .def_readwrite("kv_cache_placement", &SchedulerConfig::kv_cache_placement)
+        .def_readwrite("enable_kv_cache_offload", &SchedulerConfig::enable_kv_cache_offload)
+        .def_readwrite("num_full_precision_boundary_layers", &SchedulerConfig::num_full_precision_boundary_layers)
+        .def_readwrite("max_block_share_per_request", &SchedulerConfig::max_block_share_per_request)
+        .def_readwrite("enable_predictive_admission", &SchedulerConfig::enable_predictive_admission)
+        .def_readwrite("step_time_slo_ms", &SchedulerConfig::step_time_slo_ms)
         .def_readwrite("max_num_seqs", &SchedulerConfig::max_num_seqs)
         .def_readwrite("enable_prefix_caching", &SchedulerConfig::enable_prefix_caching)
         .def_readwrite("use_cache_eviction", &SchedulerConfig::use_cache_eviction)
         .def_readwrite("cache_eviction_config", &SchedulerConfig::cache_eviction_config);
 
+    py::class_<ov::genai::BlockManagerStats>(m, "BlockManagerStats",
+                            R"(Snapshot of KV block manager telemetry counters: pool occupancy, prefix-cache reuse/eviction rates and copy-on-write activity)")
+            .def(py::init<>())
+            .def_readonly("total_blocks", &ov::genai::BlockManagerStats::total_blocks)
+            .def_readonly("free_blocks", &ov::genai::BlockManagerStats::free_blocks)
+            .def_readonly("overwritable_blocks", &ov::genai::BlockManagerStats::overwritable_blocks)
+            .def_readonly("num_blocks_allocated", &ov::genai::BlockManagerStats::num_blocks_allocated)
+            .def_readonly("num_blocks_freed", &ov::genai::BlockManagerStats::num_blocks_freed)
+            .def_readonly("num_blocks_restored", &ov::genai::BlockManagerStats::num_blocks_restored)
+            .def_readonly("num_blocks_overwritten", &ov::genai::BlockManagerStats::num_blocks_overwritten)
+            .def_readonly("num_cow_copies", &ov::genai::BlockManagerStats::num_cow_copies);
+
+    py::class_<ov::genai::SchedulingDecisionRecord> scheduling_decision_record(m, "SchedulingDecisionRecord",
+            "One scheduling decision per pipeline step: scheduled/skipped requests with reasons");
+    py::enum_<ov::genai::SchedulingDecisionRecord::SkipReason>(scheduling_decision_record, "SkipReason")
+            .value("WAITING", ov::genai::SchedulingDecisionRecord::SkipReason::WAITING)
+            .value("TOKEN_BUDGET", ov::genai::SchedulingDecisionRecord::SkipReason::TOKEN_BUDGET)
+            .value("BLOCK_SHORTAGE", ov::genai::SchedulingDecisionRecord::SkipReason::BLOCK_SHORTAGE);
+    scheduling_decision_record
+            .def_readonly("step", &ov::genai::SchedulingDecisionRecord::step)
+            .def_readonly("scheduled_request_ids", &ov::genai::SchedulingDecisionRecord::scheduled_request_ids)
+            .def_readonly("skipped_request_ids", &ov::genai::SchedulingDecisionRecord::skipped_request_ids)
+            .def_readonly("total_scheduled_tokens", &ov::genai::SchedulingDecisionRecord::total_scheduled_tokens)
+            .def_readonly("num_preemptions", &ov::genai::SchedulingDecisionRecord::num_preemptions)
+            .def_readonly("cache_usage_percent", &ov::genai::SchedulingDecisionRecord::cache_usage_percent);
+
+    py::class_<ov::genai::SpeculativeDecodingSnapshot>(m, "SpeculativeDecodingSnapshot",
+            "Live snapshot of speculative decoding acceptance and duration statistics,"
+            " pollable while requests run")
+            .def_readonly("draft_duration_ms", &ov::genai::SpeculativeDecodingSnapshot::draft_duration_ms)
+            .def_readonly("main_duration_ms", &ov::genai::SpeculativeDecodingSnapshot::main_duration_ms)
+            .def_readonly("acceptance_rate_ewma_per_request", &ov::genai::SpeculativeDecodingSnapshot::acceptance_rate_ewma_per_request)
+            .def_readonly("acceptance_rate_histogram", &ov::genai::SpeculativeDecodingSnapshot::acceptance_rate_histogram);
+
+    py::class_<ov::genai::StepPhaseTimings>(m, "StepPhaseTimings",
+                            R"(Per-step phase timings (microseconds) recorded by the continuous batching step loop for live latency attribution)")
+            .def(py::init<>())
+            .def_readonly("step_id", &ov::genai::StepPhaseTimings::step_id)
+            .def_readonly("schedule_duration", &ov::genai::StepPhaseTimings::schedule_duration)
+            .def_readonly("infer_duration", &ov::genai::StepPhaseTimings::infer_duration)
+            .def_readonly("sample_duration", &ov::genai::StepPhaseTimings::sample_duration)
+            .def_readonly("postprocess_duration", &ov::genai::StepPhaseTimings::postprocess_duration);
+
     py::class_<PipelineMetrics>(m, "PipelineMetrics", pipeline_metrics_docstring)
             .def(py::init<>())
             .def_readonly("requests", &PipelineMetrics::requests)
@@ -284,7 +351,21 @@ void init_continuous_batching_pipeline(py::module_& m) {
         .def("add_request", py::overload_cast<uint64_t, const ov::Tensor&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("input_ids"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("generation_config"))
         .def("add_request", py::overload_cast<uint64_t, const std::string&, const std::vector<ov::Tensor>&, const ov::genai::GenerationConfig&>(&ContinuousBatchingPipeline::add_request), py::arg("request_id"), py::arg("prompt"), py::arg("images"), py::arg("generation_config"))
+        .def("pin_prompt_prefix", py::overload_cast<const ov::Tensor&>(&ContinuousBatchingPipeline::pin_prompt_prefix), py::arg("input_ids"))
+        .def("pin_prompt_prefix", py::overload_cast<const std::string&>(&ContinuousBatchingPipeline::pin_prompt_prefix), py::arg("prompt"))
+        .def("unpin_prompt_prefix", py::overload_cast<const ov::Tensor&>(&ContinuousBatchingPipeline::unpin_prompt_prefix), py::arg("input_ids"))
+        .def("unpin_prompt_prefix", py::overload_cast<const std::string&>(&ContinuousBatchingPipeline::unpin_prompt_prefix), py::arg("prompt"))
         .def("step", &ContinuousBatchingPipeline::step)
+        .def("get_recent_step_timings", &ContinuousBatchingPipeline::get_recent_step_timings, py::arg("max_steps") = 256)
+        .def("get_block_manager_stats", &ContinuousBatchingPipeline::get_block_manager_stats)
+        .def("get_speculative_decoding_snapshot", &ContinuousBatchingPipeline::get_speculative_decoding_snapshot)
+        .def("get_recent_scheduling_decisions", &ContinuousBatchingPipeline::get_recent_scheduling_decisions)
+        .def("embed", &ContinuousBatchingPipeline::embed, py::arg("prompts"), py::call_guard<py::gil_scoped_release>())
+        .def("warmup",
+             &ContinuousBatchingPipeline::warmup,
+             py::arg("prompt_lengths") = std::vector<size_t>{64},
+             py::call_guard<py::gil_scoped_release>())
+        .def("update_scheduler_limits", &ContinuousBatchingPipeline::update_scheduler_limits, py::arg("config"))
         .def("has_non_finished_requests", &ContinuousBatchingPipeline::has_non_finished_requests)
 
 
@@ -88,6 +88,7 @@ void init_generation_config(py::module_& m) {
         .def(py::init<std::filesystem::path>(), py::arg("json_path"), "path where generation_config.json is stored")
         .def(py::init([](py::kwargs kwargs) { return *pyutils::update_config_from_kwargs(GenerationConfig(), kwargs); }))
         .def_readwrite("max_new_tokens", &GenerationConfig::max_new_tokens)
+        .def_readwrite("max_unread_stream_outputs", &GenerationConfig::max_unread_stream_outputs)
         .def_readwrite("max_length", &GenerationConfig::max_length)
         .def_readwrite("ignore_eos", &GenerationConfig::ignore_eos)
         .def_readwrite("min_new_tokens", &GenerationConfig::min_new_tokens)
@@ -107,6 +108,8 @@ void init_generation_config(py::module_& m) {
         .def_readwrite("presence_penalty", &GenerationConfig::presence_penalty)
         .def_readwrite("frequency_penalty", &GenerationConfig::frequency_penalty)
         .def_readwrite("rng_seed", &GenerationConfig::rng_seed)
+        .def_readwrite("scheduling_priority", &GenerationConfig::scheduling_priority)
+        .def_readwrite("request_timeout_s", &GenerationConfig::request_timeout_s)
         .def_readwrite("stop_strings", &GenerationConfig::stop_strings)
         .def_readwrite("echo", &GenerationConfig::echo)
         .def_readwrite("logprobs", &GenerationConfig::logprobs)
@@ -258,6 +258,16 @@ void init_image_generation_pipelines(py::module_& m) {
         .def("randn_tensor", &ov::genai::CppStdGenerator::randn_tensor, py::arg("shape"))
         .def("seed", &ov::genai::CppStdGenerator::seed, py::arg("new_seed"));
 
+    py::class_<ov::genai::PhiloxGenerator, ov::genai::Generator, std::shared_ptr<ov::genai::PhiloxGenerator>>(m, "PhiloxGenerator",
+        "Counter-based (Philox4x32-10) random generator: draws are a pure function of (seed, stream, counter), so parallel streams of one seed are order-independent and reproducible.")
+        .def(py::init([](uint64_t seed, uint64_t stream) {
+            return std::make_unique<ov::genai::PhiloxGenerator>(seed, stream);
+        }), py::arg("seed"), py::arg("stream") = 0)
+        .def("next", &ov::genai::PhiloxGenerator::next)
+        .def("randn_tensor", &ov::genai::PhiloxGenerator::randn_tensor, py::arg("shape"))
+        .def("seed", &ov::genai::PhiloxGenerator::seed, py::arg("new_seed"))
+        .def("set_stream", &ov::genai::PhiloxGenerator::set_stream, py::arg("stream"));
+
     py::class_<::TorchGenerator, ov::genai::CppStdGenerator, std::shared_ptr<::TorchGenerator>>(m, "TorchGenerator", "This class provides OpenVINO GenAI Generator wrapper for torch.Generator")
         .def(py::init([](uint32_t seed) {
             return std::make_unique<::TorchGenerator>(seed);
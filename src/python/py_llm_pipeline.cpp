@@ -233,6 +233,11 @@ void init_llm_pipeline(py::module_& m) {
         )
 
         .def("get_tokenizer", &LLMPipeline::get_tokenizer)
+        .def("warmup",
+             &LLMPipeline::warmup,
+             py::arg("prompt_lengths") = std::vector<size_t>{64},
+             py::call_guard<py::gil_scoped_release>(),
+             "Runs synthetic prefill+decode iterations across the given prompt lengths so the first real request does not pay cold-start costs")
         .def("start_chat", &LLMPipeline::start_chat, py::arg("system_message") = "")
         .def("finish_chat", &LLMPipeline::finish_chat)
         .def("get_generation_config", &LLMPipeline::get_generation_config, py::return_value_policy::copy)
@@ -0,0 +1,122 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// Microbenchmarks guarding BlockManager allocation-path performance under production-like
+// churn. Run with --benchmark_format=json and compare against the stored baseline
+// (see baselines/README.md) to gate regressions before merge.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "block_manager.hpp"
+#include "openvino/genai/generation_config.hpp"
+
+using namespace ov::genai;
+
+namespace {
+
+constexpr size_t BLOCK_SIZE = 32;
+
+SequenceGroup::Ptr make_group(uint64_t request_id, size_t prompt_len, size_t num_scheduled_tokens) {
+    std::vector<int64_t> prompt(prompt_len);
+    for (size_t i = 0; i < prompt_len; ++i) {
+        prompt[i] = static_cast<int64_t>((request_id * 1315423911u + i) % 32000);
+    }
+    auto group = SequenceGroup::create(request_id, prompt, GenerationConfig{}, BLOCK_SIZE);
+    group->schedule_tokens(num_scheduled_tokens);
+    return group;
+}
+
+}  // namespace
+
+// steady-state request churn: allocate a prompt's worth of blocks, then free the sequence -
+// the dominant allocator pattern of a serving pipeline without prefix caching
+static void BM_AllocFreeChurn(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const size_t blocks_per_request = state.range(1);
+    BlockManager block_manager(num_blocks, /*enable_prefix_caching=*/false, BLOCK_SIZE);
+
+    uint64_t request_id = 0;
+    for (auto _ : state) {
+        auto group = make_group(request_id++, blocks_per_request * BLOCK_SIZE, blocks_per_request * BLOCK_SIZE);
+        block_manager.append_slots(group);
+        block_manager.free_sequence((*group)[0]->get_id());
+    }
+    state.SetItemsProcessed(state.iterations() * blocks_per_request);
+}
+BENCHMARK(BM_AllocFreeChurn)->Args({100000, 16})->Args({100000, 128})->Unit(benchmark::kMicrosecond);
+
+// beam-style fork/free: one parent, fork the whole table N-1 times, free children - exercises
+// the refcount and per-sequence table paths that beam search hits every step
+static void BM_ForkFreeChurn(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const size_t beam_width = state.range(1);
+    BlockManager block_manager(num_blocks, /*enable_prefix_caching=*/false, BLOCK_SIZE);
+
+    auto group = make_group(0, 16 * BLOCK_SIZE, 16 * BLOCK_SIZE);
+    block_manager.append_slots(group);
+    const uint64_t parent_id = (*group)[0]->get_id();
+
+    uint64_t next_child_id = 1u << 20;
+    for (auto _ : state) {
+        std::vector<uint64_t> children;
+        for (size_t i = 1; i < beam_width; ++i) {
+            uint64_t child_id = next_child_id++;
+            block_manager.fork_sequence(parent_id, child_id);
+            children.push_back(child_id);
+        }
+        for (uint64_t child_id : children) {
+            block_manager.free_sequence(child_id);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * (beam_width - 1));
+}
+BENCHMARK(BM_ForkFreeChurn)->Args({100000, 4})->Args({100000, 8})->Unit(benchmark::kMicrosecond);
+
+// prefix-cache hit pattern: requests sharing a common prompt prefix free their blocks into the
+// hash store and the next request restores them - measures hashed allocation, store insertion
+// and restore lookup together
+static void BM_PrefixCacheRestoreChurn(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const size_t blocks_per_request = state.range(1);
+    BlockManager block_manager(num_blocks, /*enable_prefix_caching=*/true, BLOCK_SIZE);
+
+    for (auto _ : state) {
+        // identical request id => identical prompt => identical prefix hashes across iterations
+        auto group = make_group(7, blocks_per_request * BLOCK_SIZE, blocks_per_request * BLOCK_SIZE);
+        block_manager.restore_cached_blocks(group);
+        block_manager.append_slots(group);
+        block_manager.free_sequence((*group)[0]->get_id());
+    }
+    state.SetItemsProcessed(state.iterations() * blocks_per_request);
+}
+BENCHMARK(BM_PrefixCacheRestoreChurn)->Args({100000, 16})->Args({100000, 64})->Unit(benchmark::kMicrosecond);
+
+// hash-store pressure: fill the overwritable store with many distinct one-off prompts, then
+// keep allocating - every allocation must evict an LRU victim from a large store
+static void BM_HashStoreEvictionPressure(benchmark::State& state) {
+    const size_t num_blocks = state.range(0);
+    const size_t blocks_per_request = 8;
+    BlockManager block_manager(num_blocks, /*enable_prefix_caching=*/true, BLOCK_SIZE);
+
+    // occupy the pool with distinct freed prompts so the free list drains into the hash store
+    uint64_t request_id = 0;
+    const size_t fill_requests = num_blocks / blocks_per_request;
+    for (size_t i = 0; i < fill_requests; ++i) {
+        auto group = make_group(request_id++, blocks_per_request * BLOCK_SIZE, blocks_per_request * BLOCK_SIZE);
+        block_manager.append_slots(group);
+        block_manager.free_sequence((*group)[0]->get_id());
+    }
+
+    for (auto _ : state) {
+        auto group = make_group(request_id++, blocks_per_request * BLOCK_SIZE, blocks_per_request * BLOCK_SIZE);
+        block_manager.append_slots(group);
+        block_manager.free_sequence((*group)[0]->get_id());
+    }
+    state.SetItemsProcessed(state.iterations() * blocks_per_request);
+}
+BENCHMARK(BM_HashStoreEvictionPressure)->Args({100000})->Args({10000})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// Microbenchmarks guarding sampler-side hot paths. Run with
+// --benchmark_format=json and compare against a stored baseline to gate regressions.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include "logit_processor.hpp"
+
+using namespace LogitTransformers;
+
+namespace {
+
+std::vector<float> make_logits(size_t vocab_size, uint32_t seed = 42) {
+    std::mt19937 rng(seed);
+    std::normal_distribution<float> dist(0.f, 3.f);
+    std::vector<float> logits(vocab_size);
+    for (auto& value : logits)
+        value = dist(rng);
+    return logits;
+}
+
+}  // namespace
+
+static void BM_TopKFilter(benchmark::State& state) {
+    const size_t vocab_size = state.range(0);
+    const size_t top_k = state.range(1);
+    auto source = make_logits(vocab_size);
+    std::vector<float> scratch(vocab_size);
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), scratch.begin());
+        Logits logits(scratch.data(), vocab_size);
+        TopKFilter filter(top_k);
+        filter.apply(logits);
+        benchmark::DoNotOptimize(logits.m_vector.data());
+    }
+}
+BENCHMARK(BM_TopKFilter)->Args({32000, 50})->Args({128000, 50})->Args({256000, 50});
+
+static void BM_TopPFilter(benchmark::State& state) {
+    const size_t vocab_size = state.range(0);
+    auto source = make_logits(vocab_size);
+    std::vector<float> scratch(vocab_size);
+    // top_p expects probabilities: softmax once outside the loop shape
+    TemperatureLogitTransform temperature(1.0);
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), scratch.begin());
+        Logits logits(scratch.data(), vocab_size);
+        temperature.apply(logits);
+        TopPFilter filter(0.9);
+        filter.apply(logits);
+        benchmark::DoNotOptimize(logits.m_vector.data());
+    }
+}
+BENCHMARK(BM_TopPFilter)->Arg(32000)->Arg(128000)->Arg(256000);
+
+static void BM_FusedPenalties(benchmark::State& state) {
+    const size_t vocab_size = state.range(0);
+    const size_t num_generated = state.range(1);
+    auto source = make_logits(vocab_size);
+    std::vector<float> scratch(vocab_size);
+
+    auto prompt_ids = std::make_shared<std::set<int64_t>>();
+    auto generated_counts = std::make_shared<std::map<int64_t, size_t>>();
+    std::mt19937 rng(7);
+    for (size_t i = 0; i < num_generated; ++i) {
+        prompt_ids->insert(rng() % vocab_size);
+        (*generated_counts)[rng() % vocab_size]++;
+    }
+
+    FusedPenaltyTransform fused(1.2f, 0.4f, 0.2f);
+    fused.set_unique_prompt_token_ids(prompt_ids);
+    fused.set_unique_generated_token_ids(generated_counts);
+
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), scratch.begin());
+        Logits logits(scratch.data(), vocab_size);
+        fused.apply(logits);
+        benchmark::DoNotOptimize(scratch.data());
+    }
+}
+BENCHMARK(BM_FusedPenalties)->Args({128000, 256})->Args({128000, 4096});
+
+static void BM_TemperatureSoftmax(benchmark::State& state) {
+    const size_t vocab_size = state.range(0);
+    auto source = make_logits(vocab_size);
+    std::vector<float> scratch(vocab_size);
+    TemperatureLogitTransform temperature(0.7);
+    for (auto _ : state) {
+        std::copy(source.begin(), source.end(), scratch.begin());
+        Logits logits(scratch.data(), vocab_size);
+        temperature.apply(logits);
+        benchmark::DoNotOptimize(scratch.data());
+    }
+}
+BENCHMARK(BM_TemperatureSoftmax)->Arg(32000)->Arg(128000)->Arg(256000);
+
+BENCHMARK_MAIN();
@@ -268,3 +268,30 @@ TEST(TestBlockAllocator, CalculatesUsagePercentageCorrectlyWithPrefixCaching) {
         allocator.free(prefix_hash_map[allocated_block.first]);
     }
 }
+
+TEST(TestBlockAllocator, ShrinksOnlyWhenTailBlocksAreFree) {
+    size_t num_layers = 2;
+    size_t initial_num_free_blocks = 8;
+    auto allocator = ov::genai::BlockAllocator(initial_num_free_blocks, false, num_layers);
+
+    // blocks 0 and 1 are taken, tail 4..7 is free => shrinking to 4 is possible
+    auto blocks_0 = allocator.allocate_block();
+    auto blocks_1 = allocator.allocate_block();
+
+    EXPECT_TRUE(allocator.try_shrink_to(4));
+    EXPECT_EQ(allocator.get_total_number_of_kv_blocks(), 4);
+    for (size_t i = 0; i < num_layers; i++) {
+        EXPECT_EQ(allocator.num_free_blocks(i), 2);
+    }
+
+    // blocks 2 and 3 are now owned, the tail is occupied => shrinking must fail and change nothing
+    auto blocks_2 = allocator.allocate_block();
+    auto blocks_3 = allocator.allocate_block();
+    EXPECT_FALSE(allocator.try_shrink_to(2));
+    EXPECT_EQ(allocator.get_total_number_of_kv_blocks(), 4);
+
+    allocator.free(blocks_0);
+    allocator.free(blocks_1);
+    allocator.free(blocks_2);
+    allocator.free(blocks_3);
+}
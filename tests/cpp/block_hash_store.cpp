@@ -52,3 +52,42 @@ TEST(TestBlockHashStore, general_test) {
     EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
     EXPECT_EQ(block_hash_store.num_blocks(), 0);
 }
+
+TEST(TestBlockHashStore, eviction_prefers_rarely_reused_blocks_and_skips_pinned) {
+    ov::genai::OverwritableBlocksHashStore block_hash_store(1);
+    auto block0 = std::make_shared<ov::genai::KVCacheBlock>(0);
+    block0->set_hash(77);
+    auto block1 = std::make_shared<ov::genai::KVCacheBlock>(1);
+    block1->set_hash(56);
+    auto block2 = std::make_shared<ov::genai::KVCacheBlock>(2);
+    block2->set_hash(23);
+    block_hash_store.add(ov::genai::BlocksPerLayer{block0});
+    block_hash_store.add(ov::genai::BlocksPerLayer{block1});
+    block_hash_store.add(ov::genai::BlocksPerLayer{block2});
+
+    // block0 is the oldest, but was reused before: restore and return it to the store
+    auto restored = block_hash_store.get_block_to_restore(77)[0];
+    EXPECT_EQ(restored->get_reuse_count(), 1);
+    restored->release();
+    block_hash_store.add(ov::genai::BlocksPerLayer{block0});
+
+    // eviction should prefer never-reused blocks over the reused one despite its age
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 1);
+    block1->release();
+
+    // pinned blocks are not evictable, but remain restorable
+    EXPECT_TRUE(block_hash_store.set_pinned(23, true));
+    EXPECT_FALSE(block_hash_store.set_pinned(44, true));
+    EXPECT_EQ(block_hash_store.num_blocks(), 2);
+    EXPECT_EQ(block_hash_store.num_evictable_blocks(), 1);
+
+    EXPECT_EQ(block_hash_store.get_lru_block_to_overwrite()[0]->get_index(), 0);
+    block0->release();
+    EXPECT_TRUE(block_hash_store.get_lru_block_to_overwrite().empty());
+
+    auto pinned_block = block_hash_store.get_block_to_restore(23)[0];
+    EXPECT_EQ(pinned_block->get_index(), 2);
+    EXPECT_TRUE(pinned_block->is_pinned());
+    EXPECT_EQ(block_hash_store.num_blocks(), 0);
+    EXPECT_EQ(block_hash_store.num_evictable_blocks(), 0);
+}
@@ -112,4 +112,57 @@ TEST(TestBlockManager, CanFreeBlocksFromSequence) {
     for (auto& sequence : sequence_group->get_sequences()) {
         bm.free_sequence(sequence->get_id());
     }
-}
\ No newline at end of file
+}
+TEST(TestBlockManager, multinomial_forks_share_prompt_blocks_copy_on_write) {
+    // n > 1 multinomial sampling forks sequences at prompt end; the forks must share the prompt
+    // blocks by reference count and diverge only on the written tail block
+    const size_t block_size = 4;
+    ov::genai::BlockManager bm = ov::genai::BlockManager(16, false, block_size);
+    // deliberately not block-aligned: the shared tail block is partially filled, so the first
+    // generated token exercises the copy-on-write divergence path
+    ov::genai::TokenIds prompt_ids(2 * block_size + 2);
+    for (size_t i = 0; i < prompt_ids.size(); ++i)
+        prompt_ids[i] = static_cast<int64_t>(i);
+
+    auto config = ov::genai::multinomial();
+    config.num_return_sequences = 4;
+    ov::genai::SequenceGroup::Ptr sequence_group = ov::genai::SequenceGroup::create(
+        0,
+        ov::Tensor(ov::element::i64, {prompt_ids.size()}, prompt_ids.data()),
+        config,
+        block_size);
+    auto parent = sequence_group->get_not_finished_sequences()[0];
+    auto parent_id = parent->get_id();
+    sequence_group->schedule_tokens(prompt_ids.size());
+    bm.append_slots(sequence_group);
+    EXPECT_EQ(bm.num_free_blocks(), 13);
+
+    // fork 3 children like create_n_forked_sequences does: no block copies, refcounts go up
+    std::vector<uint64_t> child_ids;
+    for (size_t i = 0; i < 3; ++i) {
+        auto child = sequence_group->fork_sequence(parent);
+        child_ids.push_back(child->get_id());
+        bm.fork_sequence(parent_id, child->get_id());
+    }
+    EXPECT_EQ(bm.num_free_blocks(), 13) << "forking must not copy any blocks";
+    for (auto child_id : child_ids) {
+        EXPECT_EQ(bm.get_block_table(child_id, 0).front()->get_references_count(), 4);
+    }
+
+    // first generated token per sequence: only the shared tail block is copied per diverging child
+    sequence_group->finish_iteration();
+    for (auto& sequence : sequence_group->get_running_sequences()) {
+        sequence->append_token(42, 0.f);
+    }
+    sequence_group->schedule_tokens(1);
+    auto copy_map = bm.append_slots(sequence_group);
+    size_t num_copies = 0;
+    for (const auto& src_and_dsts : copy_map) {
+        num_copies += src_and_dsts.second.size();
+    }
+    EXPECT_EQ(num_copies, 3) << "only the written tail block may be copied, prompt blocks stay shared";
+
+    for (auto& sequence : sequence_group->get_sequences()) {
+        bm.free_sequence(sequence->get_id());
+    }
+}
@@ -781,3 +781,35 @@ INSTANTIATE_TEST_SUITE_P(VariousPOCDumps,
                                          "cache_rotation_poc_ref_coefficients_per_block_1.txt",
                                          "cache_rotation_poc_ref_coefficients_per_block_2.txt",
                                          "cache_rotation_poc_ref_coefficients_per_block_3.txt"));
+
+TEST(CacheEvictionLandmarkTest, LandmarkBlockSurvivesEvictionDespiteLowAverage) {
+    size_t num_decoder_layers = 1;
+    ov::genai::CacheEvictionConfig config = {32, 32, 192, ov::genai::AggregationMode::SUM};
+    config.landmark_score_percentile = 0.99f;
+    auto algo = ov::genai::CacheEvictionAlgorithm(config, DEFAULT_BLOCK_SIZE, num_decoder_layers);
+
+    // overflow by one block so exactly one eviction is needed
+    auto scores = get_mock_scores(num_decoder_layers, algo.get_max_cache_size_after_eviction() + 1);
+    auto& scores_per_layer = scores[0];
+    fill_scores(scores_per_layer, 0, scores_per_layer.get_size(), 1.0);
+
+    // block 17 is otherwise the lowest-scored block, but holds one high-importance landmark token
+    size_t landmark_block_idx = 17;
+    fill_scores(scores_per_layer, DEFAULT_BLOCK_SIZE * landmark_block_idx,
+                DEFAULT_BLOCK_SIZE * (landmark_block_idx + 1), 0.0);
+    scores_per_layer.data<float>()[DEFAULT_BLOCK_SIZE * landmark_block_idx] = 100.0f;
+    // block 20 is uniformly low but holds no landmark - it should be the victim instead
+    fill_scores(scores_per_layer, DEFAULT_BLOCK_SIZE * 20, DEFAULT_BLOCK_SIZE * 21, 0.5);
+
+    algo.register_new_token_scores(scores);
+    auto evicted_blocks = algo.evict_logical_blocks();
+
+    ASSERT_EQ(evicted_blocks[0].size(), 1);
+    EXPECT_EQ(evicted_blocks[0].count(landmark_block_idx), 0);
+    EXPECT_EQ(evicted_blocks[0].count(20), 1);
+}
+
+TEST(CacheEvictionLandmarkTest, DisabledByDefault) {
+    ov::genai::CacheEvictionConfig config = DEFAULT_CACHE_EVICTION_CONFIG;
+    EXPECT_EQ(config.landmark_score_percentile, 0.0f);
+}
@@ -3,6 +3,7 @@
 //
 
 #include <gtest/gtest.h>
+#include <cstring>
 #include "openvino/runtime/core.hpp"
 #include "scheduler.hpp"
 #include "cache_manager.hpp"
@@ -108,3 +109,40 @@ TEST(TestCacheManager, test_dynamic_cache_increase) {
     cache_manager->allocate_cache_if_needed(block_manager.get_total_number_of_kv_blocks());
     ASSERT_EQ(get_total_allocated_bytes(cache_manager), 200 * block_size_in_bytes);
 }
+
+TEST(TestCacheManager, test_copy_blocks_coalescing) {
+    ov::Core core;
+    const size_t num_decoder_layers = 2;
+    const std::vector<KVHeadConfig> kv_cache_config(num_decoder_layers, KVHeadConfig { 12, 12, 64, 64 });
+
+    ov::InferRequest request = core.compile_model(get_dummy_model(core, num_decoder_layers)).create_infer_request();
+    auto cache_manager = std::make_shared<CacheManager>(request, kv_cache_config);
+    cache_manager->allocate_cache_if_needed(16);
+
+    // fill source blocks with a recognizable per-block pattern
+    auto key_cache = cache_manager->get_key_cache(0);
+    const size_t block_elements = key_cache.get_byte_size() / key_cache.get_shape()[0];
+    for (size_t block_id = 0; block_id < 4; ++block_id) {
+        std::memset(static_cast<uint8_t*>(key_cache.data()) + block_id * block_elements, static_cast<int>(block_id + 1), block_elements);
+    }
+
+    // blocks 0..3 -> 8..11 form one contiguous run, 0 -> 14 is copied separately
+    std::map<size_t, std::list<size_t>> block_copy_map;
+    block_copy_map[0] = {8, 14};
+    block_copy_map[1] = {9};
+    block_copy_map[2] = {10};
+    block_copy_map[3] = {11};
+    cache_manager->copy_blocks(block_copy_map);
+
+    auto check_block = [&](size_t dst_block_id, uint8_t expected_value) {
+        const uint8_t* data = static_cast<const uint8_t*>(cache_manager->get_key_cache(0).data()) + dst_block_id * block_elements;
+        for (size_t i = 0; i < block_elements; ++i) {
+            ASSERT_EQ(data[i], expected_value) << "mismatch in block " << dst_block_id << " at offset " << i;
+        }
+    };
+    check_block(8, 1);
+    check_block(9, 2);
+    check_block(10, 3);
+    check_block(11, 4);
+    check_block(14, 1);
+}
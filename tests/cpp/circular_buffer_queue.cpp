@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "circular_buffer_queue.hpp"
+
+using ov::genai::CircularBufferQueue;
+using ov::genai::CircularBufferQueueElementGuard;
+
+TEST(TestCircularBufferQueue, grows_lazily_up_to_cap_instead_of_blocking) {
+    size_t num_created = 0;
+    CircularBufferQueue<int> queue(1, [&num_created]() { return static_cast<int>(num_created++); }, 2);
+    EXPECT_EQ(queue.get_num_created_elements(), 1);
+
+    {
+        CircularBufferQueueElementGuard<int> first(&queue);
+        // the single eager element is busy: the second acquisition must grow the pool, not block
+        CircularBufferQueueElementGuard<int> second(&queue);
+        EXPECT_EQ(queue.get_num_created_elements(), 2);
+        EXPECT_NE(first.get(), second.get());
+    }
+
+    // at the cap the elements are recycled, no further growth
+    {
+        CircularBufferQueueElementGuard<int> first(&queue);
+        CircularBufferQueueElementGuard<int> second(&queue);
+        EXPECT_EQ(queue.get_num_created_elements(), 2);
+    }
+
+    auto histogram = queue.get_wait_histogram();
+    size_t total_acquisitions = 0;
+    for (auto counter : histogram)
+        total_acquisitions += counter;
+    EXPECT_EQ(total_acquisitions, 4);
+    // none of the acquisitions above had to wait
+    EXPECT_EQ(histogram[0], 4);
+}
+
+TEST(TestCircularBufferQueue, fixed_size_pool_keeps_previous_behavior) {
+    CircularBufferQueue<int> queue(2, []() { static int counter = 0; return counter++; });
+    EXPECT_EQ(queue.get_num_created_elements(), 2);
+    {
+        CircularBufferQueueElementGuard<int> first(&queue);
+        CircularBufferQueueElementGuard<int> second(&queue);
+        EXPECT_EQ(queue.get_num_created_elements(), 2);
+    }
+}
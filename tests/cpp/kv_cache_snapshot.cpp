@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "kv_cache_snapshot.hpp"
+
+using namespace ov::genai::utils;
+
+namespace {
+
+ov::Tensor make_test_tensor(float seed) {
+    ov::Tensor tensor(ov::element::f32, {2, 3, 4});
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = seed + static_cast<float>(i);
+    }
+    return tensor;
+}
+
+}  // namespace
+
+TEST(TestKVCacheSnapshot, round_trips_tensors_and_tokens) {
+    std::vector<ov::Tensor> states = {make_test_tensor(1.0f), make_test_tensor(100.0f)};
+    std::vector<int64_t> tokens = {5, 6, 7, 8, 9};
+    constexpr uint64_t model_hash = 0xDEADBEEFCAFEBABEull;
+
+    std::stringstream stream;
+    save_kv_cache_snapshot(stream, states, tokens, model_hash);
+
+    std::vector<ov::Tensor> restored_states;
+    std::vector<int64_t> restored_tokens;
+    ASSERT_TRUE(load_kv_cache_snapshot(stream, restored_states, restored_tokens, model_hash));
+
+    EXPECT_EQ(restored_tokens, tokens);
+    ASSERT_EQ(restored_states.size(), states.size());
+    for (size_t i = 0; i < states.size(); ++i) {
+        ASSERT_EQ(restored_states[i].get_shape(), states[i].get_shape());
+        ASSERT_EQ(restored_states[i].get_element_type(), states[i].get_element_type());
+        EXPECT_EQ(0, std::memcmp(restored_states[i].data(), states[i].data(), states[i].get_byte_size()));
+    }
+}
+
+TEST(TestKVCacheSnapshot, rejects_incompatible_snapshots) {
+    std::vector<ov::Tensor> states = {make_test_tensor(1.0f)};
+    std::vector<int64_t> tokens = {1, 2, 3};
+
+    std::stringstream stream;
+    save_kv_cache_snapshot(stream, states, tokens, /* model_hash = */ 42);
+
+    std::vector<ov::Tensor> restored_states;
+    std::vector<int64_t> restored_tokens;
+
+    // wrong model hash: KV tensors are only valid for the model that produced them
+    EXPECT_FALSE(load_kv_cache_snapshot(stream, restored_states, restored_tokens, /* expected_model_hash = */ 43));
+    EXPECT_TRUE(restored_states.empty());
+    EXPECT_TRUE(restored_tokens.empty());
+
+    // truncated stream
+    std::stringstream full_stream;
+    save_kv_cache_snapshot(full_stream, states, tokens, 42);
+    std::string payload = full_stream.str();
+    std::stringstream truncated(payload.substr(0, payload.size() / 2));
+    EXPECT_FALSE(load_kv_cache_snapshot(truncated, restored_states, restored_tokens, 42));
+
+    // garbage magic
+    std::stringstream garbage("not a snapshot at all");
+    EXPECT_FALSE(load_kv_cache_snapshot(garbage, restored_states, restored_tokens, 42));
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+
+#include "lockfree_intake_queue.hpp"
+
+TEST(TestLockfreeIntakeQueue, preserves_fifo_order) {
+    LockfreeIntakeQueue<int> queue;
+    for (int i = 0; i < 100; ++i)
+        queue.push(i);
+    EXPECT_EQ(queue.size_approx(), 100);
+
+    std::vector<int> drained;
+    queue.drain_to(drained);
+    ASSERT_EQ(drained.size(), 100);
+    for (int i = 0; i < 100; ++i)
+        EXPECT_EQ(drained[i], i);
+    EXPECT_EQ(queue.size_approx(), 0);
+}
+
+TEST(TestLockfreeIntakeQueue, concurrent_producers_lose_no_items) {
+    LockfreeIntakeQueue<size_t> queue;
+    constexpr size_t num_producers = 8;
+    constexpr size_t items_per_producer = 1000;
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; ++p) {
+        producers.emplace_back([&queue, p]() {
+            for (size_t i = 0; i < items_per_producer; ++i)
+                queue.push(p * items_per_producer + i);
+        });
+    }
+
+    std::vector<size_t> drained;
+    while (drained.size() < num_producers * items_per_producer)
+        queue.drain_to(drained);
+
+    for (auto& producer : producers)
+        producer.join();
+
+    std::sort(drained.begin(), drained.end());
+    for (size_t i = 0; i < drained.size(); ++i)
+        EXPECT_EQ(drained[i], i);
+    EXPECT_EQ(queue.size_approx(), 0);
+}
@@ -343,3 +343,75 @@ INSTANTIATE_TEST_SUITE_P(VariousInputs,
                          EOSPenaltyTransformTest,
                          testing::ValuesIn(EOS_PENALTY_TRANSFORM_TEST_CASES));
 
+
+TEST(FusedPenaltyTransformTest, MatchesSequentialPenaltyApplication) {
+    constexpr size_t size = 6;
+    const float initial[size] = { 1.0f, -2.0f, 3.0f, -0.1f, 0.5f, 4.0f };
+    const TokenIds prompt_ids{ 0, 2, 4 };
+    const TokenIds generated_ids{ 2, 2, 3, 5 };
+    const float repetition_penalty = 1.3f, presence_penalty = 0.4f, frequency_penalty = 0.2f;
+
+    auto make_prompt_id_set = [&]() { return std::make_shared<std::set<int64_t>>(prompt_ids.begin(), prompt_ids.end()); };
+    auto make_generated_counts = [&]() {
+        auto counts = std::make_shared<std::map<int64_t, size_t>>();
+        for (auto id : generated_ids)
+            (*counts)[id]++;
+        return counts;
+    };
+
+    // reference: the three individual transforms applied in the LogitProcessor order
+    float reference[size];
+    std::copy_n(initial, size, reference);
+    {
+        auto logits = Logits(reference, size);
+        auto generated_counts = make_generated_counts();
+        auto repetition = RepetitionPenaltyTransform(repetition_penalty);
+        repetition.set_unique_prompt_token_ids(make_prompt_id_set());
+        repetition.set_unique_generated_token_ids(generated_counts);
+        repetition.apply(logits);
+        auto presence = PresencePenaltyTransform(presence_penalty);
+        presence.set_unique_generated_token_ids(generated_counts);
+        presence.apply(logits);
+        auto frequency = FrequencyPenaltyTransform(frequency_penalty);
+        frequency.set_unique_generated_token_ids(generated_counts);
+        frequency.apply(logits);
+    }
+
+    float fused_output[size];
+    std::copy_n(initial, size, fused_output);
+    {
+        auto logits = Logits(fused_output, size);
+        auto fused = FusedPenaltyTransform(repetition_penalty, presence_penalty, frequency_penalty);
+        fused.set_unique_prompt_token_ids(make_prompt_id_set());
+        fused.set_unique_generated_token_ids(make_generated_counts());
+        fused.apply(logits);
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        EXPECT_NEAR(fused_output[i], reference[i], 1e-6) << "mismatch at logit " << i;
+    }
+}
+
+TEST(NoRepeatNgramTransformTest, BansSeenNgramContinuationsIncrementally) {
+    NoRepeatNgramTransform transform(/* ngram_size = */ 3);
+    // history: 1 2 3 1 2 -> context (1, 2) has known follower 3
+    for (int64_t token : {1, 2, 3, 1, 2}) {
+        transform.accept_token(token);
+    }
+
+    float data[5] = {0.f, 1.f, 2.f, 3.f, 4.f};
+    Logits logits(data, 5);
+    transform.apply(logits);
+    EXPECT_EQ(data[3], -std::numeric_limits<float>::infinity());
+    EXPECT_EQ(data[1], 1.f);
+    EXPECT_EQ(data[2], 2.f);
+
+    // a different context bans nothing
+    transform.accept_token(4);
+    float data2[5] = {0.f, 1.f, 2.f, 3.f, 4.f};
+    Logits logits2(data2, 5);
+    transform.apply(logits2);
+    for (size_t i = 0; i < 5; ++i) {
+        EXPECT_EQ(data2[i], static_cast<float>(i));
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "sequence_group.hpp"
+
+using namespace ov::genai;
+
+TEST(TestObjectChunkPool, recycles_chunks) {
+    auto& pool = ObjectChunkPool<Sequence>::instance();
+
+    auto sequence = Sequence::create(0);
+    sequence.reset();
+    size_t free_chunks_after_release = pool.num_free_chunks();
+    EXPECT_GE(free_chunks_after_release, 1);
+
+    // a freshly created sequence must reuse the recycled chunk instead of allocating a new one
+    auto recycled = Sequence::create(1);
+    EXPECT_EQ(recycled->get_grouped_id(), 1);
+    EXPECT_EQ(pool.num_free_chunks(), free_chunks_after_release - 1);
+}
+
+TEST(TestObjectChunkPool, pooled_sequence_group_creation) {
+    std::vector<uint64_t> tokens = {0, 1, 2, 3};
+    auto sequence_group = SequenceGroup::create(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                ov::genai::greedy(), 4);
+    EXPECT_EQ(sequence_group->get_prompt_len(), 4);
+    sequence_group.reset();
+    EXPECT_GE(ObjectChunkPool<SequenceGroup>::instance().num_free_chunks(), 1);
+}
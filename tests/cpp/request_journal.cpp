@@ -0,0 +1,30 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "request_journal.hpp"
+
+using namespace ov::genai::utils;
+
+TEST(TestRequestJournal, round_trips_and_skips_torn_tail) {
+    std::stringstream journal;
+    append_request_journal_record(journal, {1, 42, {10, 11, 12}});
+    append_request_journal_record(journal, {2, 7, {20, 21}});
+
+    // simulate a crash mid-write of a third record: write only part of it
+    std::stringstream torn;
+    append_request_journal_record(torn, {3, 9, {30, 31, 32, 33}});
+    std::string torn_bytes = torn.str();
+    journal.write(torn_bytes.data(), torn_bytes.size() / 2);
+
+    auto records = read_request_journal(journal);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].request_id, 1);
+    EXPECT_EQ(records[0].rng_seed, 42);
+    EXPECT_EQ(records[0].input_ids, (std::vector<int64_t>{10, 11, 12}));
+    EXPECT_EQ(records[1].request_id, 2);
+    EXPECT_EQ(records[1].input_ids, (std::vector<int64_t>{20, 21}));
+}
@@ -300,3 +300,23 @@ TEST(SamplerValidationMode, prompt_phase) {
              expected{0, 1, 2, 3};
     ASSERT_EQ(sequence_groups.front()->get_sequences().front()->get_generated_ids(), expected);
 }
+
+TEST(SamplerStopTokenMatcherTest, DenseAndSparseMembership) {
+    StopTokenMatcher empty_matcher{std::set<int64_t>{}};
+    EXPECT_FALSE(empty_matcher.contains(0));
+
+    // compact id range takes the bitset path
+    StopTokenMatcher dense_matcher{std::set<int64_t>{2, 50256, 50257}};
+    EXPECT_TRUE(dense_matcher.contains(2));
+    EXPECT_TRUE(dense_matcher.contains(50256));
+    EXPECT_TRUE(dense_matcher.contains(50257));
+    EXPECT_FALSE(dense_matcher.contains(0));
+    EXPECT_FALSE(dense_matcher.contains(3));
+    EXPECT_FALSE(dense_matcher.contains(50258));
+
+    // a huge id span keeps the set lookup
+    StopTokenMatcher sparse_matcher{std::set<int64_t>{1, int64_t(1) << 40}};
+    EXPECT_TRUE(sparse_matcher.contains(1));
+    EXPECT_TRUE(sparse_matcher.contains(int64_t(1) << 40));
+    EXPECT_FALSE(sparse_matcher.contains(2));
+}
@@ -1114,4 +1114,37 @@ TEST(TestScheduler, prefix_caching_embeddings_test) {
          }
     }
 
-}
\ No newline at end of file
+}
+TEST(TestScheduler, chunked_prefill_respects_prefill_tokens_ratio) {
+    SchedulerConfig scheduler_config;
+    scheduler_config.max_num_batched_tokens = 32;
+    scheduler_config.num_kv_blocks = 100;
+    scheduler_config.dynamic_split_fuse = true;
+    scheduler_config.max_num_seqs = 5;
+    scheduler_config.max_prefill_tokens_ratio = 0.25f;
+
+    std::vector<uint64_t> tokens(32);
+    for (size_t i = 0; i < tokens.size(); ++i)
+        tokens[i] = i;
+    SequenceGroup::Ptr sequence_group = std::make_shared<SequenceGroup>(0, ov::Tensor(ov::element::i64, {tokens.size()}, tokens.data()),
+                                                                        ov::genai::greedy(), 4);
+    std::vector<SequenceGroup::Ptr> requests = {sequence_group};
+
+    Scheduler scheduler = Scheduler(4, init_cache_manager(scheduler_config), scheduler_config);
+
+    // 32 * 0.25 == 8 prompt tokens per iteration => prompt is processed in 4 chunks
+    for (size_t chunk = 0; chunk < 4; ++chunk) {
+        auto out = scheduler.schedule(requests);
+        EXPECT_EQ(out.m_total_num_scheduled_tokens, 8);
+        for (auto seq : requests)
+            seq->finish_iteration();
+    }
+
+    // prompt is fully processed, generation phase is not limited by the prefill budget
+    for (auto seq : requests) {
+        seq->get_running_sequences()[0]->append_token(16, 0.9);
+    }
+    auto out = scheduler.schedule(requests);
+    EXPECT_EQ(out.m_total_num_scheduled_tokens, 1);
+    EXPECT_FALSE(out.is_prompt);
+}
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "stop_string_automaton.hpp"
+
+using ov::genai::StopStringAutomaton;
+
+TEST(TestStopStringAutomaton, finds_earliest_ending_match) {
+    StopStringAutomaton automaton({"stop", "op", "banana"});
+
+    auto match = automaton.find_first("xx op yy");
+    ASSERT_TRUE(match.is_matched);
+    EXPECT_EQ(match.end_pos, 4);
+    EXPECT_EQ(match.length, 2);
+
+    // "stop" and "op" both end at the same position, the longer pattern wins
+    match = automaton.find_first("a stop");
+    ASSERT_TRUE(match.is_matched);
+    EXPECT_EQ(match.end_pos, 5);
+    EXPECT_EQ(match.length, 4);
+
+    match = automaton.find_first("bananas");
+    ASSERT_TRUE(match.is_matched);
+    EXPECT_EQ(match.end_pos, 5);
+    EXPECT_EQ(match.length, 6);
+
+    EXPECT_FALSE(automaton.find_first("no match here").is_matched);
+    EXPECT_FALSE(automaton.find_first("").is_matched);
+}
+
+TEST(TestStopStringAutomaton, handles_overlapping_patterns) {
+    StopStringAutomaton automaton({"aba", "ba"});
+
+    // both "aba" and "ba" end at index 2: the longer one is reported
+    auto match = automaton.find_first("aba");
+    ASSERT_TRUE(match.is_matched);
+    EXPECT_EQ(match.end_pos, 2);
+    EXPECT_EQ(match.length, 3);
+
+    // only "ba" ends at index 1 here
+    match = automaton.find_first("ba");
+    ASSERT_TRUE(match.is_matched);
+    EXPECT_EQ(match.end_pos, 1);
+    EXPECT_EQ(match.length, 2);
+}
@@ -0,0 +1,88 @@
+// Copyright (C) 2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "threadpool.hpp"
+
+TEST(ThreadPoolTest, SubmitReturnsResult) {
+    ThreadPool pool(2);
+    auto future = pool.submit([]() { return 40 + 2; });
+    EXPECT_EQ(future.get(), 42);
+}
+
+TEST(ThreadPoolTest, HighPriorityRunsBeforeLow) {
+    ThreadPool pool(1);
+    std::atomic<bool> release{false};
+    std::vector<int> order;
+    std::mutex order_mutex;
+
+    // occupy the single worker so both tasks are queued before either can run
+    auto blocker = pool.submit([&release]() {
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+    });
+    auto low = pool.submit_with_priority(ThreadPool::Priority::LOW, [&]() {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(0);
+    });
+    auto high = pool.submit_with_priority(ThreadPool::Priority::HIGH, [&]() {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(1);
+    });
+    release = true;
+    blocker.get();
+    low.get();
+    high.get();
+
+    ASSERT_EQ(order.size(), 2);
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 0);
+}
+
+TEST(ThreadPoolTest, ClientBudgetLimitsConcurrency) {
+    ThreadPool pool(4);
+    ThreadPool::Client client(pool, 2);
+    std::atomic<int> running{0};
+    std::atomic<int> max_running{0};
+
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 16; ++i) {
+        futures.push_back(client.submit([&running, &max_running]() {
+            int now = ++running;
+            int seen = max_running.load();
+            while (now > seen && !max_running.compare_exchange_weak(seen, now)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --running;
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    EXPECT_LE(max_running.load(), 2);
+    EXPECT_GE(max_running.load(), 1);
+}
+
+TEST(ThreadPoolTest, ClientRunsAllDeferredTasks) {
+    ThreadPool pool(2);
+    std::atomic<int> counter{0};
+    {
+        ThreadPool::Client client(pool, 1);
+        for (int i = 0; i < 32; ++i) {
+            client.submit([&counter]() { ++counter; });
+        }
+        // destructor joins everything submitted, including tasks deferred over budget
+    }
+    EXPECT_EQ(counter.load(), 32);
+}
+
+TEST(ThreadPoolTest, SharedPoolIsSingleInstance) {
+    EXPECT_EQ(&ThreadPool::shared(), &ThreadPool::shared());
+}
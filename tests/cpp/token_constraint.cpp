@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "token_constraint.hpp"
+
+using namespace ov::genai;
+using namespace LogitTransformers;
+
+namespace {
+
+// grammar "a* b": state 0 loops on 'a' and moves to state 1 on 'b'; state 1 accepts nothing further
+TableCharacterAutomaton make_a_star_b_automaton() {
+    std::vector<int32_t> table(2 * 256, -1);
+    table[0 * 256 + 'a'] = 0;
+    table[0 * 256 + 'b'] = 1;
+    return TableCharacterAutomaton(std::move(table), 2);
+}
+
+}  // namespace
+
+TEST(TestTokenLevelDFA, compiles_masks_and_transitions) {
+    std::vector<std::string> vocab = {"a", "b", "ab", "ba"};
+    auto dfa = std::make_shared<TokenLevelDFA>(vocab, make_a_star_b_automaton());
+
+    const uint64_t* mask = dfa->allowed_mask(dfa->initial_state());
+    EXPECT_EQ(mask[0], 0b0111); // "ba" starts with an inadmissible 'b'-then-'a' path
+
+    EXPECT_EQ(dfa->next_state(0, 0), 0);  // "a" loops
+    EXPECT_EQ(dfa->next_state(0, 1), 1);  // "b" finishes
+    EXPECT_EQ(dfa->next_state(0, 2), 1);  // "ab" finishes
+    EXPECT_EQ(dfa->next_state(0, 3), -1); // "ba" inadmissible
+}
+
+TEST(TestGrammarConstraintTransform, masks_logits_and_advances_state) {
+    std::vector<std::string> vocab = {"a", "b", "ab", "ba"};
+    auto dfa = std::make_shared<TokenLevelDFA>(vocab, make_a_star_b_automaton());
+    GrammarConstraintTransform constraint(dfa);
+
+    float data[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    Logits logits(data, 4);
+    constraint.apply(logits);
+    EXPECT_EQ(data[0], 1.0f);
+    EXPECT_EQ(data[1], 2.0f);
+    EXPECT_EQ(data[2], 3.0f);
+    EXPECT_EQ(data[3], -std::numeric_limits<float>::infinity());
+
+    constraint.accept_token(2); // "ab" moves the grammar into its final state
+    EXPECT_EQ(constraint.get_state(), 1);
+
+    float data2[4] = {1.0f, 2.0f, 3.0f, 4.0f};
+    Logits logits2(data2, 4);
+    constraint.apply(logits2);
+    for (size_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(data2[i], -std::numeric_limits<float>::infinity());
+    }
+
+    EXPECT_THROW(constraint.accept_token(3), ov::Exception);
+}
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <cmath>
+
+#include "whisper/whisper_feature_extractor.hpp"
+
+using ov::genai::WhisperFeatureExtractor;
+
+TEST(TestWhisperFeatureExtractor, incremental_extraction_matches_full_extraction) {
+    // default parameters are used when no preprocessor_config.json exists at the path
+    WhisperFeatureExtractor extractor("/nonexistent/preprocessor_config.json");
+
+    // 3 seconds of a synthetic waveform, fed in growing chunks
+    const size_t total_samples = 3 * extractor.sampling_rate;
+    std::vector<float> audio(total_samples);
+    for (size_t i = 0; i < total_samples; ++i) {
+        audio[i] = std::sin(0.01f * i) * 0.5f + std::sin(0.037f * i) * 0.25f;
+    }
+
+    WhisperFeatureExtractor::IncrementalState state;
+    for (size_t num_available : {extractor.sampling_rate / 2, extractor.sampling_rate * 2, total_samples}) {
+        std::vector<float> available(audio.begin(), audio.begin() + num_available);
+
+        auto incremental = extractor.extract_incremental(available, state);
+        auto reference = extractor.extract(available);
+
+        ASSERT_EQ(incremental.n_frames, reference.n_frames);
+        ASSERT_EQ(incremental.data.size(), reference.data.size());
+        for (size_t i = 0; i < reference.data.size(); ++i) {
+            ASSERT_FLOAT_EQ(incremental.data[i], reference.data[i]) << "mismatch at element " << i
+                << " with " << num_available << " available samples";
+        }
+    }
+}
@@ -308,7 +308,7 @@ public:
     }
 };
 
-void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled) {
+void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* dataset, std::string request_rate, GenerationInfoCollector* generation_info_collector, bool is_speculative_decoding_enabled, std::string arrival_trace_path) {
     double numeric_request_rate;
     std::random_device rd;
     std::mt19937 gen(rd());
@@ -331,13 +331,39 @@ void trafficSimulator(ov::genai::ContinuousBatchingPipeline* pipe, Dataset* data
     std::cout << "Average output len: " << dataset->get_average_output_len() << " tokens" << std::endl;
     */
 
+    // Open-loop arrival schedule: absolute submission deadlines are computed up front - either
+    // replayed from a trace file (one arrival offset in milliseconds per line) or synthesized
+    // from the Poisson process - and requests fire on schedule regardless of completions, so
+    // queueing under overload is measured instead of hidden by closed-loop pacing drift.
+    std::vector<double> arrival_offsets_ms(dataset->size(), 0.0);
+    if (!arrival_trace_path.empty()) {
+        std::ifstream trace_file(arrival_trace_path);
+        OPENVINO_ASSERT(trace_file.good(), "Cannot open arrival trace file: ", arrival_trace_path);
+        double offset_ms = 0.0;
+        size_t trace_idx = 0;
+        while (trace_idx < arrival_offsets_ms.size() && trace_file >> offset_ms) {
+            arrival_offsets_ms[trace_idx++] = offset_ms;
+        }
+        OPENVINO_ASSERT(trace_idx == arrival_offsets_ms.size(),
+                        "Arrival trace holds ", trace_idx, " offsets but the dataset has ", arrival_offsets_ms.size(), " requests");
+    } else if (numeric_request_rate > 0) {
+        double cumulative_ms = 0.0;
+        for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+            arrival_offsets_ms[request_id] = cumulative_ms;
+            cumulative_ms += distribution(gen) * 1000;
+        }
+    }
+
     std::cout << "Launching traffic simulator thread with request_rate: " << request_rate << std::endl;
-    generation_info_collector->set_start_time(std::chrono::steady_clock::now());
+    auto start_time = std::chrono::steady_clock::now();
+    generation_info_collector->set_start_time(start_time);
     for (size_t request_id = 0; request_id < dataset->size(); ++request_id) {
+        if (numeric_request_rate > 0 || !arrival_trace_path.empty()) {
+            // absolute deadlines avoid the cumulative drift of sleeping between submissions
+            std::this_thread::sleep_until(start_time + std::chrono::microseconds(static_cast<int64_t>(arrival_offsets_ms[request_id] * 1000)));
+        }
         std::cout << "Traffic thread adding request to the queue..." << std::endl;
         generation_info_collector->add_generation(pipe, dataset, request_id, is_speculative_decoding_enabled);
-        if (numeric_request_rate > 0)
-            std::this_thread::sleep_for(std::chrono::milliseconds(int(distribution(gen) * 1000)));
     }
     std::cout << "All requests sent, traffic simulation finished. Exiting thread." << std::endl;
 }
@@ -441,6 +467,7 @@ int main(int argc, char* argv[]) try {
     ("max_input_len", "Max input length take from dataset", cxxopts::value<size_t>()->default_value("1024"))
     ("max_output_len", "Max output length", cxxopts::value<size_t>()->default_value("2048"))
     ("request_rate", "Number of requests per second. If this is inf, then all the requests are sent at time 0. Otherwise, we use Poisson process to synthesize the request arrival times.", cxxopts::value<std::string>()->default_value("inf"))
+    ("arrival_trace", "Path to an open-loop arrival trace: one arrival offset in milliseconds per line, applied to dataset requests in order (overrides request_rate)", cxxopts::value<std::string>()->default_value(""))
     ("cache_size", "Size of memory used for KV cache in GB. Default: 16", cxxopts::value<size_t>()->default_value("16"))
     ("device", "Target device to run the model. Default: CPU", cxxopts::value<std::string>()->default_value("CPU"))
     ("device_config", "Plugin configuration JSON. Example: '{\"MODEL_DISTRIBUTION_POLICY\":\"TENSOR_PARALLEL\",\"PERF_COUNT\":true}' Default: {\"PERF_COUNT\":true}", cxxopts::value<std::string>()->default_value("{\"PERF_COUNT\":true}"))
@@ -523,14 +550,14 @@ int main(int argc, char* argv[]) try {
 
     std::atomic<bool> finishGenerationThread{false};
     if (request_rate == "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
+        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled, result["arrival_trace"].as<std::string>());
         trafficSimulatorThread.join();
     }
     
     std::thread lmmEngineThread(llmEngineLoop, &pipe, &dataset, &finishGenerationThread);
     std::thread statisticsReporterThread(statisticsReporter, &generation_info_collector, num_prompts);
     if (request_rate != "inf") {
-        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled);
+        std::thread trafficSimulatorThread(trafficSimulator, &pipe, &dataset, request_rate, &generation_info_collector, is_speculative_decoding_enabled, result["arrival_trace"].as<std::string>());
         trafficSimulatorThread.join();
     }
     statisticsReporterThread.join();
@@ -0,0 +1,233 @@
+// Copyright (C) 2023-2025 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+#include <cxxopts.hpp>
+
+#include "openvino/genai/continuous_batching_pipeline.hpp"
+#include "openvino/genai/llm_pipeline.hpp"
+
+namespace {
+
+std::vector<std::string> load_prompts(const std::string& dataset_path, size_t max_prompts) {
+    // one prompt per line; JSONL lines with a "prompt" field are accepted as well
+    std::vector<std::string> prompts;
+    std::ifstream dataset(dataset_path);
+    OPENVINO_ASSERT(dataset.good(), "Cannot open dataset file: ", dataset_path);
+    std::string line;
+    while (prompts.size() < max_prompts && std::getline(dataset, line)) {
+        if (line.empty())
+            continue;
+        if (line.front() == '{') {
+            auto parsed = nlohmann::json::parse(line, nullptr, /* allow_exceptions = */ false);
+            if (parsed.is_object() && parsed.contains("prompt")) {
+                prompts.push_back(parsed["prompt"].get<std::string>());
+                continue;
+            }
+        }
+        prompts.push_back(line);
+    }
+    OPENVINO_ASSERT(!prompts.empty(), "Dataset file holds no prompts: ", dataset_path);
+    return prompts;
+}
+
+struct SweepResult {
+    size_t num_assistant_tokens = 0;
+    float assistant_confidence_threshold = 0.f;
+    size_t total_generated_tokens = 0;
+    double total_duration_sec = 0.0;
+    double mean_ttft_ms = 0.0;
+    double mean_tpot_ms = 0.0;
+
+    double tokens_per_sec() const {
+        return total_duration_sec > 0.0 ? total_generated_tokens / total_duration_sec : 0.0;
+    }
+};
+
+SweepResult run_sweep_point(ov::genai::ContinuousBatchingPipeline& pipe,
+                            std::vector<std::string> prompts,
+                            size_t max_new_tokens,
+                            size_t num_assistant_tokens,
+                            float assistant_confidence_threshold) {
+    ov::genai::GenerationConfig generation_config = ov::genai::greedy();
+    generation_config.max_new_tokens = max_new_tokens;
+    generation_config.ignore_eos = true;
+    generation_config.num_assistant_tokens = num_assistant_tokens;
+    generation_config.assistant_confidence_threshold = assistant_confidence_threshold;
+
+    std::vector<ov::genai::GenerationConfig> sampling_params(prompts.size(), generation_config);
+
+    auto start = std::chrono::steady_clock::now();
+    auto results = pipe.generate(prompts, sampling_params);
+    auto end = std::chrono::steady_clock::now();
+
+    SweepResult sweep_result;
+    sweep_result.num_assistant_tokens = num_assistant_tokens;
+    sweep_result.assistant_confidence_threshold = assistant_confidence_threshold;
+    sweep_result.total_duration_sec = std::chrono::duration<double>(end - start).count();
+
+    double ttft_sum_ms = 0.0, tpot_sum_ms = 0.0;
+    size_t num_perf_samples = 0;
+    for (auto& result : results) {
+        auto& perf = result.perf_metrics;
+        ttft_sum_ms += perf.get_ttft().mean;
+        tpot_sum_ms += perf.get_tpot().mean;
+        sweep_result.total_generated_tokens += perf.get_num_generated_tokens();
+        ++num_perf_samples;
+    }
+    if (num_perf_samples > 0) {
+        sweep_result.mean_ttft_ms = ttft_sum_ms / num_perf_samples;
+        sweep_result.mean_tpot_ms = tpot_sum_ms / num_perf_samples;
+    }
+    return sweep_result;
+}
+
+std::vector<size_t> parse_size_list(const std::string& values) {
+    std::vector<size_t> result;
+    std::stringstream stream(values);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        result.push_back(std::stoul(item));
+    }
+    return result;
+}
+
+std::vector<float> parse_float_list(const std::string& values) {
+    std::vector<float> result;
+    std::stringstream stream(values);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        result.push_back(std::stof(item));
+    }
+    return result;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) try {
+    cxxopts::Options options("speculative_decoding_benchmark",
+                             "Sweeps speculative decoding parameters against a prompt set and reports net throughput per point");
+
+    options.add_options()
+        ("m,model", "Path to the main model directory", cxxopts::value<std::string>())
+        ("d,draft_model", "Comma-separated paths to candidate draft model directories; the tool benchmarks each and reports the best", cxxopts::value<std::string>())
+        ("dataset", "Path to a prompt file (one prompt per line, or JSONL with a 'prompt' field)", cxxopts::value<std::string>())
+        ("n,num_prompts", "Number of prompts to benchmark", cxxopts::value<size_t>()->default_value("16"))
+        ("max_new_tokens", "Tokens to generate per prompt", cxxopts::value<size_t>()->default_value("128"))
+        ("num_assistant_tokens", "Comma-separated fixed-K values to sweep", cxxopts::value<std::string>()->default_value("2,4,6,8"))
+        ("confidence_thresholds", "Comma-separated assistant_confidence_threshold values to sweep (0 = fixed-K mode only)", cxxopts::value<std::string>()->default_value("0"))
+        ("device", "Target device for both models", cxxopts::value<std::string>()->default_value("CPU"))
+        ("draft_device", "Target device for the draft model (defaults to --device)", cxxopts::value<std::string>()->default_value(""))
+        ("cache_size", "KV cache size in GB", cxxopts::value<size_t>()->default_value("8"))
+        ("selection_cache", "Path to a JSON file caching the selected draft per device + target model; when the entry exists the sweep is skipped", cxxopts::value<std::string>()->default_value(""))
+        ("h,help", "Print usage");
+
+    auto parsed = options.parse(argc, argv);
+    if (parsed.count("help") || !parsed.count("model") || !parsed.count("draft_model") || !parsed.count("dataset")) {
+        std::cout << options.help() << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    const auto model_path = parsed["model"].as<std::string>();
+    const auto draft_model_paths = [&]() {
+        std::vector<std::string> paths;
+        std::stringstream stream(parsed["draft_model"].as<std::string>());
+        std::string item;
+        while (std::getline(stream, item, ','))
+            paths.push_back(item);
+        return paths;
+    }();
+    const auto device = parsed["device"].as<std::string>();
+    auto draft_device = parsed["draft_device"].as<std::string>();
+    if (draft_device.empty()) {
+        draft_device = device;
+    }
+
+    const auto prompts = load_prompts(parsed["dataset"].as<std::string>(), parsed["num_prompts"].as<size_t>());
+    const auto max_new_tokens = parsed["max_new_tokens"].as<size_t>();
+    const auto assistant_token_counts = parse_size_list(parsed["num_assistant_tokens"].as<std::string>());
+    const auto confidence_thresholds = parse_float_list(parsed["confidence_thresholds"].as<std::string>());
+
+    ov::genai::SchedulerConfig scheduler_config;
+    scheduler_config.cache_size = parsed["cache_size"].as<size_t>();
+
+    // selection cache: skip the sweep entirely when a cached choice for this device + target exists
+    const auto selection_cache_path = parsed["selection_cache"].as<std::string>();
+    const std::string selection_key = device + "|" + model_path;
+    if (!selection_cache_path.empty()) {
+        std::ifstream cache_file(selection_cache_path);
+        if (cache_file.good()) {
+            auto cache = nlohmann::json::parse(cache_file, nullptr, /* allow_exceptions = */ false);
+            if (cache.is_object() && cache.contains(selection_key)) {
+                std::cout << "cached selection for '" << selection_key << "': " << cache[selection_key].dump() << std::endl;
+                return EXIT_SUCCESS;
+            }
+        }
+    }
+
+    std::cout << "draft_model,num_assistant_tokens,confidence_threshold,total_tokens,duration_sec,tokens_per_sec,mean_ttft_ms,mean_tpot_ms" << std::endl;
+    std::vector<SweepResult> sweep_results;
+    std::vector<std::string> sweep_draft_paths;
+    for (const auto& draft_model_path : draft_model_paths) {
+        ov::genai::ContinuousBatchingPipeline pipe(model_path, scheduler_config, device,
+                                                   {ov::genai::draft_model(draft_model_path, draft_device)});
+        for (float threshold : confidence_thresholds) {
+            for (size_t num_assistant_tokens : assistant_token_counts) {
+                // fixed-K and confidence-threshold modes are mutually exclusive in GenerationConfig
+                size_t effective_k = threshold > 0.f ? 0 : num_assistant_tokens;
+                auto result = run_sweep_point(pipe, prompts, max_new_tokens, effective_k, threshold);
+                sweep_results.push_back(result);
+                sweep_draft_paths.push_back(draft_model_path);
+                std::cout << draft_model_path << "," << result.num_assistant_tokens << "," << result.assistant_confidence_threshold << ","
+                          << result.total_generated_tokens << "," << result.total_duration_sec << ","
+                          << result.tokens_per_sec() << "," << result.mean_ttft_ms << "," << result.mean_tpot_ms
+                          << std::endl;
+                if (threshold > 0.f) {
+                    // in threshold mode the K sweep is degenerate, one point is enough
+                    break;
+                }
+            }
+        }
+    }
+
+    OPENVINO_ASSERT(!sweep_results.empty(), "Nothing was swept: check --num_assistant_tokens / --confidence_thresholds");
+    auto best = std::max_element(sweep_results.begin(), sweep_results.end(),
+        [](const SweepResult& lhs, const SweepResult& rhs) { return lhs.tokens_per_sec() < rhs.tokens_per_sec(); });
+    const auto& best_draft = sweep_draft_paths[std::distance(sweep_results.begin(), best)];
+    std::cout << "best point: draft_model=" << best_draft
+              << " num_assistant_tokens=" << best->num_assistant_tokens
+              << " confidence_threshold=" << best->assistant_confidence_threshold
+              << " tokens_per_sec=" << best->tokens_per_sec() << std::endl;
+
+    if (!selection_cache_path.empty()) {
+        nlohmann::json cache = nlohmann::json::object();
+        {
+            std::ifstream cache_file(selection_cache_path);
+            if (cache_file.good()) {
+                auto parsed_cache = nlohmann::json::parse(cache_file, nullptr, /* allow_exceptions = */ false);
+                if (parsed_cache.is_object())
+                    cache = parsed_cache;
+            }
+        }
+        cache[selection_key] = {
+            {"draft_model", best_draft},
+            {"num_assistant_tokens", best->num_assistant_tokens},
+            {"confidence_threshold", best->assistant_confidence_threshold},
+            {"tokens_per_sec", best->tokens_per_sec()},
+        };
+        std::ofstream out(selection_cache_path);
+        out << cache.dump(2) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+} catch (const std::exception& error) {
+    std::cerr << "Non OpenVINO exception: " << error.what() << std::endl;
+    return EXIT_FAILURE;
+}